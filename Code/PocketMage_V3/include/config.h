@@ -11,8 +11,12 @@
 
 // CONFIGURATION & SETTINGS
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////|
-#define KB_COOLDOWN 50                          // Keypress cooldown
 #define FULL_REFRESH_AFTER 5                    // Full refresh after N partial refreshes (CHANGE WITH CAUTION)
+#define PARTIAL_WINDOW_REFRESHES 20             // Full refresh after N windowed partial refreshes (ghosting)
+#define PARTIAL_WINDOW_ROW 24                   // Height of the typical partial window (px)
+#define REFRESH_COALESCE_MS 150                 // Queued refreshes within this time become one (ms)
+#define REFRESH_MAX_WAIT_MS 600                 // Longest a queued refresh waits (ms)
+#define DIFF_MAX_WINDOWS 2                      // Partial windows a refresh of a changed frame may send
 #define MAX_FILES 10                            // Number of files to store
 #define FORMAT_SPIFFS_IF_FAILED true            // Format the SPIFFS filesystem if mount fails
 #define SLEEPMODE "TEXT"                        // TEXT, SPLASH, CLOCK
@@ -21,6 +25,11 @@
 #define TOUCH_TIMEOUT_MS 1200                   // Delay after scrolling to return to typing mode (ms)
 #define SYS_METADATA_FILE "/sys/SDMMC_META.txt" // File path to the file system metadata file
 #define POWER_SAVE_FREQ 40                      // CPU freq for power save mode
+#define EDIT_LOG_INTERVAL_MS 3000               // TXT writes typed edits to the SD log this often (ms)
+#define EDIT_LOG_MAX_BYTES 32768                // TXT starts its edit log over from a checkpoint past this
+#define FONT_DIR "/assets/fonts/"               // TXT font packs (.pmf, see tools/gfxfont2pmf.py)
+#define FONT_CACHE_BYTES 49152                  // Heap TXT keeps loaded font packs in (B)
+#define TXT_BUILTIN_FONTS 0                     // 0: 7b stand-ins for missing packs (~270 KB less flash), 1: TXT keeps its fonts compiled in
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////|
 
 // PIN DEFINITION
@@ -14,8 +14,8 @@
 // ===================== SYSTEM STATE =====================
 extern Preferences prefs;                       // NVS preferencesv
 extern TaskHandle_t einkHandlerTaskHandle;      // E-Ink handler task
-extern int OLEDFPSMillis;                       // Last OLED FPS update time
-extern int KBBounceMillis;                      // Last keyboard debounce time
+extern TaskHandle_t einkRefreshTaskHandle;      // Sends frames to the e-ink panel
+extern TaskHandle_t oledTaskHandle;             // OLED compositor task
 extern volatile bool newState;                  // App state changed
 extern volatile bool disableTimeout;            // Disable timeout globally
 extern bool fileLoaded;     
@@ -76,6 +76,8 @@ void TXT_INIT_JournalMode();
 void processKB_TXT_NEW();
 void einkHandler_TXT_NEW();
 void saveMarkdownFile(const String& path);
+bool syncEditLog(String path);
+void recoverEditLog();
 
 // <HOME.cpp>
 void HOME_INIT();
@@ -0,0 +1,161 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+// ===================== BITMAP STREAM =====================
+/*
+BitmapStream:
+@Description
+  Decodes a 1-bit bitmap a chunk at a time and hands it on one row at a time, so a
+  background can go from the SD card to the display without holding the whole image.
+  Rows are packed MSB first with 1 = black, the layout image2cpp exports with "Invert
+  Image Colors" set, which is what drawBitmap() takes.
+
+  Two formats:
+    .bin  raw rows, as image2cpp exports them (9600 bytes for 320x240)
+    .rle  "PMR1", width and height (uint16 little endian), then the raw rows
+          compressed with PackBits: a count byte n < 128 is followed by n + 1
+          literal bytes, n > 128 by one byte repeated 257 - n times, 128 is unused.
+          Runs may cross rows. Mostly white or black screens shrink to a few KB.
+
+  Row memory is MAX_ROW_BYTES, the rest of the state is a few counters.
+
+  Usage:
+    BitmapStream<40> bmp;
+    if (!bmp.begin(header, n)) ... // .rle: the first RLE_HEADER bytes
+    bmp.beginRaw(320, 240);        // .bin
+    while (!bmp.done() && (n = f.read(chunk, sizeof(chunk))))
+      bmp.feed(chunk, n, [](uint16_t y, const uint8_t* row, uint16_t w) { ... });
+*/
+
+static constexpr size_t RLE_HEADER = 8;
+
+template<size_t MAX_ROW_BYTES>
+class BitmapStream {
+public:
+  // .bin: no header, the size comes from the caller
+  bool beginRaw(uint16_t width, uint16_t height) { return start(width, height, false); }
+
+  // .rle: reads the header, false if it isn't one or the rows don't fit
+  bool begin(const uint8_t* header, size_t n) {
+    if (n < RLE_HEADER || memcmp(header, "PMR1", 4) != 0) return false;
+    const uint16_t w = header[4] | (header[5] << 8);
+    const uint16_t h = header[6] | (header[7] << 8);
+    return start(w, h, true);
+  }
+
+  uint16_t width()  const { return width_; }
+  uint16_t height() const { return height_; }
+  // All rows were handed on
+  bool     done()   const { return y_ >= height_; }
+
+  // Decodes n bytes of the file, calling row(y, bits, width) for every row completed.
+  // Bytes past the last row are ignored
+  template<class RowFn>
+  void feed(const uint8_t* p, size_t n, RowFn&& row) {
+    const uint8_t* end = p + n;
+    while (p < end && !done()) {
+      if (!compressed_) {
+        p += put(p, end - p, row);
+      } else if (left_ == 0) {
+        const uint8_t c = *p++;
+        if (c < 128)       { left_ = c + 1;   repeat_ = false; }
+        else if (c > 128)  { left_ = 257 - c; repeat_ = true;  needValue_ = true; }
+      } else if (repeat_) {
+        if (needValue_) {
+          value_     = *p++;
+          needValue_ = false;
+        }
+        // the whole run, it needs no more input
+        while (left_ && !done()) left_ -= fill(value_, left_, row);
+      } else {
+        const size_t avail = end - p;
+        const size_t take  = put(p, avail < left_ ? avail : left_, row);
+        p     += take;
+        left_ -= take;
+      }
+    }
+  }
+
+private:
+  bool start(uint16_t w, uint16_t h, bool compressed) {
+    width_      = w;
+    height_     = h;
+    rowBytes_   = (w + 7) / 8;
+    compressed_ = compressed;
+    y_ = fillAt_ = left_ = 0;
+    needValue_  = false;
+    if (!w || !h || rowBytes_ > MAX_ROW_BYTES) {
+      height_ = 0;
+      return false;
+    }
+    return true;
+  }
+
+  // Copies up to n bytes into the row, returns how many were used
+  template<class RowFn>
+  size_t put(const uint8_t* p, size_t n, RowFn& row) {
+    const size_t room = rowBytes_ - fillAt_;
+    const size_t take = n < room ? n : room;
+    memcpy(row_ + fillAt_, p, take);
+    fillAt_ += take;
+    if (fillAt_ == rowBytes_) emit(row);
+    return take;
+  }
+  template<class RowFn>
+  size_t fill(uint8_t v, size_t n, RowFn& row) {
+    const size_t room = rowBytes_ - fillAt_;
+    const size_t take = n < room ? n : room;
+    memset(row_ + fillAt_, v, take);
+    fillAt_ += take;
+    if (fillAt_ == rowBytes_) emit(row);
+    return take;
+  }
+  template<class RowFn>
+  void emit(RowFn& row) {
+    row(y_, row_, width_);
+    y_++;
+    fillAt_ = 0;
+  }
+
+  uint8_t  row_[MAX_ROW_BYTES];
+  uint16_t width_ = 0, height_ = 0, rowBytes_ = 0;
+  uint16_t y_ = 0, fillAt_ = 0;
+  bool     compressed_ = false;
+  // PackBits state, kept across chunks
+  uint16_t left_      = 0;
+  uint8_t  value_     = 0;
+  bool     repeat_    = false;
+  bool     needValue_ = false;
+};
+
+// PackBits-compresses raw rows into an .rle file, the format BitmapStream reads (used by
+// the tests; bg2rle.py does the same on the host)
+inline std::vector<uint8_t> encodeBitmapRle(const uint8_t* bits, uint16_t width,
+                                            uint16_t height) {
+  std::vector<uint8_t> out = {'P', 'M', 'R', '1', (uint8_t)(width & 0xFF),
+                              (uint8_t)(width >> 8), (uint8_t)(height & 0xFF),
+                              (uint8_t)(height >> 8)};
+  const size_t n = (size_t)((width + 7) / 8) * height;
+  size_t i = 0;
+  while (i < n) {
+    size_t run = 1;
+    while (i + run < n && run < 128 && bits[i + run] == bits[i]) run++;
+    if (run >= 2) {
+      out.push_back((uint8_t)(257 - run));
+      out.push_back(bits[i]);
+      i += run;
+      continue;
+    }
+    // literals until the next run of two or more
+    size_t lit = 1;
+    while (i + lit < n && lit < 128 &&
+           !(i + lit + 1 < n && bits[i + lit] == bits[i + lit + 1])) lit++;
+    out.push_back((uint8_t)(lit - 1));
+    out.insert(out.end(), bits + i, bits + i + lit);
+    i += lit;
+  }
+  return out;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ===================== BUFFERED WRITER =====================
+/*
+BufferedWriter:
+@Description
+  Collects small writes into one large buffer and hands it to a sink (an Arduino File)
+  in big blocks, which SDMMC handles far faster than one write per line. Keeps a
+  CRC-32 and a byte count of everything written so the result can be checked later.
+
+  Full buffers are written as they are, so with a buffer that's a multiple of 512
+  bytes every write but the last covers whole SD sectors.
+
+  Usage:
+    static uint8_t buf[16384];
+    BufferedWriter<File> out(file, buf, sizeof(buf));
+    out.write((const uint8_t*)"# Title\r\n", 9);
+    if (out.flush()) save(out.size(), out.crc());
+*/
+
+// CRC-32 (IEEE, as used by zip and PNG). Nibble table, 64 bytes of flash
+inline uint32_t crc32Update(uint32_t crc, const void* data, size_t n) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  for (size_t i = 0; i < n; i++) {
+    crc = table[(crc ^ p[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (p[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+template <typename Sink>
+class BufferedWriter {
+public:
+  BufferedWriter(Sink& sink, uint8_t* buf, size_t cap) : sink_(sink), buf_(buf), cap_(cap) {}
+
+  size_t write(uint8_t c) { return write(&c, 1); }
+
+  size_t write(const uint8_t* p, size_t n) {
+    if (!ok_) return 0;
+    crc_ = crc32Update(crc_, p, n);
+    size_ += n;
+    const size_t total = n;
+    while (n > 0) {
+      size_t room = cap_ - used_;
+      if (room == 0) {
+        if (!drain()) return 0;
+        room = cap_;
+      }
+      const size_t k = n < room ? n : room;
+      memcpy(buf_ + used_, p, k);
+      used_ += k;
+      p += k;
+      n -= k;
+    }
+    return total;
+  }
+
+  size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+
+  // Send what's buffered, false if the sink took less than it was given at any point
+  bool flush() { return drain() && ok_; }
+
+  bool     ok()   const { return ok_; }
+  uint32_t size() const { return size_; }  // bytes written, including buffered ones
+  uint32_t crc()  const { return crc_; }
+
+private:
+  bool drain() {
+    if (used_ > 0 && sink_.write(buf_, used_) != used_) ok_ = false;
+    used_ = 0;
+    return ok_;
+  }
+
+  Sink&    sink_;
+  uint8_t* buf_;
+  size_t   cap_;
+  size_t   used_ = 0;
+  uint32_t size_ = 0;
+  uint32_t crc_  = 0;
+  bool     ok_   = true;
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// ===================== DIRTY RECTS =====================
+/*
+DirtyRects:
+@Description
+  Collects the screen areas that need redrawing and turns them into as few e-ink
+  partial windows as makes sense. Top and bottom are widened to multiples of 8 (the
+  rotated panel's y runs along the controller's byte columns). Areas that overlap
+  or touch after that become one window. Past maxRects the two areas whose union
+  wastes the least are combined, so a redraw never sends more than maxRects windows.
+
+  Usage:
+    std::vector<DirtyRect> dirty;
+    addDirtyRect(dirty, {left, top, width, height}, 4, display.height());
+    for (const DirtyRect& r : dirty) display.setPartialWindow(r.x, r.y, r.w, r.h); ...
+*/
+
+struct DirtyRect {
+  int x, y, w, h;
+
+  int right()  const { return x + w; }
+  int bottom() const { return y + h; }
+  long area()  const { return (long)w * h; }
+  bool touches(const DirtyRect& o) const {
+    return x <= o.right() && o.x <= right() && y <= o.bottom() && o.y <= bottom();
+  }
+  bool overlaps(const DirtyRect& o) const {
+    return x < o.right() && o.x < right() && y < o.bottom() && o.y < bottom();
+  }
+  DirtyRect unite(const DirtyRect& o) const {
+    const int l = x < o.x ? x : o.x, t = y < o.y ? y : o.y;
+    const int r = right() > o.right() ? right() : o.right();
+    const int b = bottom() > o.bottom() ? bottom() : o.bottom();
+    return {l, t, r - l, b - t};
+  }
+};
+
+inline void addDirtyRect(std::vector<DirtyRect>& rects, DirtyRect r, size_t maxRects,
+                         int screenH) {
+  // 8-align vertically, clipped to the screen
+  int top = r.y < 0 ? 0 : r.y - (r.y % 8);
+  int bottom = r.bottom() > screenH ? screenH : r.bottom();
+  if (bottom % 8) bottom += 8 - (bottom % 8);
+  if (bottom > screenH) bottom = screenH;
+  if (r.w <= 0 || bottom <= top) return;
+  r.y = top;
+  r.h = bottom - top;
+
+  // Fold in everything it touches, the result may touch more
+  for (size_t i = 0; i < rects.size();) {
+    if (rects[i].touches(r)) {
+      r = r.unite(rects[i]);
+      rects.erase(rects.begin() + i);
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  rects.push_back(r);
+
+  while (rects.size() > maxRects && rects.size() > 1) {
+    size_t bi = 0, bj = 1;
+    long waste = -1;
+    for (size_t i = 0; i < rects.size(); i++) {
+      for (size_t j = i + 1; j < rects.size(); j++) {
+        const long w = rects[i].unite(rects[j]).area() - rects[i].area() - rects[j].area();
+        if (waste < 0 || w < waste) {
+          waste = w;
+          bi = i;
+          bj = j;
+        }
+      }
+    }
+    const DirtyRect u = rects[bi].unite(rects[bj]);
+    rects.erase(rects.begin() + bj);
+    rects.erase(rects.begin() + bi);
+    addDirtyRect(rects, u, maxRects, screenH);
+  }
+}
+
+// Total pixels the windows cover
+inline long dirtyArea(const std::vector<DirtyRect>& rects) {
+  long a = 0;
+  for (const DirtyRect& r : rects) a += r.area();
+  return a;
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <textMetrics.h>  // GFXfont
+
+// ===================== DISPLAY LIST =====================
+/*
+DisplayList:
+@Description
+  Records the Adafruit GFX calls used to draw a page so they can be replayed later,
+  e.g. laid out on the input loop and drawn by the e-ink task. Only the calls the
+  apps use are covered. Text is kept in one pool and fonts by pointer, so a page is a
+  couple of vectors that keep their capacity across clear(). A font has to outlive every
+  page that sets it: fonts in flash always do, font packs (fontPack.h) are only freed
+  once no page that uses them can be replayed.
+
+  Usage:
+    DisplayList page;
+    page.setFont(&FreeSerif9pt8b);
+    page.setCursor(10, 20);
+    page.print("hello");
+    page.drawFastHLine(0, 24, 320, GxEPD_BLACK);
+    page.replay(display);
+*/
+
+class DisplayList {
+public:
+  enum Kind : uint8_t { SET_FONT, SET_CURSOR, TEXT, FILL_RECT, HLINE, VLINE, FILL_CIRCLE };
+
+  struct Op {
+    Kind     kind;
+    int16_t  x, y, w, h;  // w is the radius for FILL_CIRCLE
+    uint16_t color;
+    uint32_t text;        // TEXT: offset into the pool, length in w
+    const GFXfont* font;
+  };
+
+  void clear() {
+    ops_.clear();
+    text_.clear();
+  }
+  bool   empty() const { return ops_.empty(); }
+  size_t size()  const { return ops_.size(); }
+  const std::vector<Op>& ops() const { return ops_; }
+
+  void setFont(const GFXfont* f) { push(SET_FONT, 0, 0, 0, 0, 0)->font = f; }
+  void setCursor(int16_t x, int16_t y) { push(SET_CURSOR, x, y, 0, 0, 0); }
+
+  // Characters written back to back share one TEXT op
+  size_t write(uint8_t c) {
+    if (ops_.empty() || ops_.back().kind != TEXT)
+      push(TEXT, 0, 0, 0, 0, 0)->text = text_.size();
+    text_.push_back((char)c);
+    ops_.back().w++;
+    return 1;
+  }
+  size_t print(const char* s) {
+    size_t n = strlen(s);
+    for (size_t i = 0; i < n; i++) write((uint8_t)s[i]);
+    return n;
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    push(FILL_RECT, x, y, w, h, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    push(HLINE, x, y, w, 0, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    push(VLINE, x, y, 0, h, color);
+  }
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+    push(FILL_CIRCLE, x, y, r, 0, color);
+  }
+
+  // Issue the recorded calls on a GFX display
+  template <typename GFX>
+  void replay(GFX& d) const {
+    for (const Op& op : ops_) {
+      switch (op.kind) {
+        case SET_FONT:    d.setFont(op.font); break;
+        case SET_CURSOR:  d.setCursor(op.x, op.y); break;
+        case TEXT:
+          for (int16_t i = 0; i < op.w; i++) d.write((uint8_t)text_[op.text + i]);
+          break;
+        case FILL_RECT:   d.fillRect(op.x, op.y, op.w, op.h, op.color); break;
+        case HLINE:       d.drawFastHLine(op.x, op.y, op.w, op.color); break;
+        case VLINE:       d.drawFastVLine(op.x, op.y, op.h, op.color); break;
+        case FILL_CIRCLE: d.fillCircle(op.x, op.y, op.w, op.color); break;
+      }
+    }
+  }
+
+private:
+  Op* push(Kind kind, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    ops_.push_back({kind, x, y, w, h, color, 0, nullptr});
+    return &ops_.back();
+  }
+
+  std::vector<Op>   ops_;
+  std::vector<char> text_;
+};
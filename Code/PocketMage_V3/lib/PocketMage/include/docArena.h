@@ -0,0 +1,194 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+#include <type_traits>
+
+#if defined(ESP_PLATFORM) && defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+
+// ===================== DOC ARENA =====================
+/*
+DocArena:
+@Description
+  Owns the small allocations of one open document (paragraph text, word and line
+  spans) so they stay out of the shared heap. Memory comes from a few large chunks
+  (PSRAM when the board has it). Freed blocks go on a free list for their power of two
+  size class and get reused by the same document. reset() drops the whole document
+  in one go when the next one is loaded.
+
+  Over a long session the heap then only sees a handful of chunk sized blocks come
+  and go instead of thousands of small ones, which is what fragmented it before.
+  Blocks bigger than DOC_ARENA_MAX_BLOCK go to the heap directly but are counted.
+
+  used()/peak() report what the document holds and the most it ever held, reserved()
+  what the arena took from the heap to provide it.
+
+  Usage:
+    DocArena arena;
+    void* p = arena.alloc(24);
+    arena.free(p, 24);
+    std::vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(&arena)};
+    ...
+    v = {};           // everything allocated from the arena must be gone...
+    arena.reset();    // ...before it's reset
+*/
+#define DOC_ARENA_CHUNK     4096
+#define DOC_ARENA_MAX_BLOCK 1024  // largest size class, bigger blocks use the heap
+#define DOC_ARENA_CLASSES   8     // 8, 16, ... DOC_ARENA_MAX_BLOCK bytes
+
+class DocArena {
+public:
+  DocArena() = default;
+  ~DocArena() { releaseChunks(nullptr); }
+  DocArena(const DocArena&) = delete;
+  DocArena& operator=(const DocArena&) = delete;
+
+  void* alloc(size_t n) {
+    if (n == 0) n = 1;
+    if (n > DOC_ARENA_MAX_BLOCK) {
+      void* p = sysAlloc(n);
+      if (p) track(n, n);
+      return p;
+    }
+
+    const int c = sizeClass(n);
+    const size_t size = (size_t)8 << c;
+    if (FreeBlock* b = free_[c]) {
+      free_[c] = b->next;
+      track(size, 0);
+      return b;
+    }
+
+    if (!chunks_ || bump_ + size > chunks_->size) {
+      if (!addChunk()) return nullptr;
+    }
+    void* p = chunks_->data() + bump_;
+    bump_ += size;
+    track(size, 0);
+    return p;
+  }
+
+  // n must be the size passed to alloc()
+  void free(void* p, size_t n) {
+    if (!p) return;
+    if (n == 0) n = 1;
+    if (n > DOC_ARENA_MAX_BLOCK) {
+      sysFree(p);
+      used_ -= n;
+      reserved_ -= n;
+      return;
+    }
+    const int c = sizeClass(n);
+    FreeBlock* b = (FreeBlock*)p;
+    b->next = free_[c];
+    free_[c] = b;
+    used_ -= (size_t)8 << c;
+  }
+
+  // Forget every allocation, keeping one chunk for the next document
+  void reset() {
+    Chunk* keep = chunks_;
+    while (keep && keep->next) keep = keep->next;  // the first chunk, chunks are pushed in front
+    releaseChunks(keep);
+    chunks_ = keep;
+    if (keep) keep->next = nullptr;
+    bump_ = 0;
+    for (FreeBlock*& f : free_) f = nullptr;
+    used_ = 0;
+    peak_ = 0;
+    reserved_ = keep ? keep->size + sizeof(Chunk) : 0;
+  }
+
+  size_t used()     const { return used_; }
+  size_t peak()     const { return peak_; }
+  size_t reserved() const { return reserved_; }
+
+private:
+  struct Chunk {
+    Chunk* next;
+    size_t size;
+    uint8_t* data() { return (uint8_t*)(this + 1); }
+  };
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  static int sizeClass(size_t n) {
+    int c = 0;
+    while (((size_t)8 << c) < n) c++;
+    return c;
+  }
+
+  static void* sysAlloc(size_t n) {
+#if defined(ESP_PLATFORM) && defined(BOARD_HAS_PSRAM)
+    if (void* p = heap_caps_malloc(n, MALLOC_CAP_SPIRAM)) return p;
+#endif
+    return malloc(n);
+  }
+  static void sysFree(void* p) { ::free(p); }
+
+  bool addChunk() {
+    Chunk* c = (Chunk*)sysAlloc(sizeof(Chunk) + DOC_ARENA_CHUNK);
+    if (!c) return false;
+    c->next = chunks_;
+    c->size = DOC_ARENA_CHUNK;
+    chunks_ = c;
+    bump_ = 0;
+    reserved_ += sizeof(Chunk) + DOC_ARENA_CHUNK;
+    return true;
+  }
+
+  void releaseChunks(Chunk* keep) {
+    for (Chunk* c = chunks_; c;) {
+      Chunk* next = c->next;
+      if (c != keep) sysFree(c);
+      c = next;
+    }
+  }
+
+  void track(size_t n, size_t heap) {
+    used_ += n;
+    reserved_ += heap;
+    if (used_ > peak_) peak_ = used_;
+  }
+
+  Chunk*     chunks_ = nullptr;  // newest first, bump_ is the fill of the newest
+  size_t     bump_   = 0;
+  FreeBlock* free_[DOC_ARENA_CLASSES] = {};
+  size_t     used_     = 0;
+  size_t     peak_     = 0;
+  size_t     reserved_ = 0;
+};
+
+// std allocator over a DocArena, falls back to the heap when no arena is given
+template <typename T>
+struct ArenaAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  DocArena* arena = nullptr;
+
+  ArenaAllocator() = default;
+  explicit ArenaAllocator(DocArena* a) : arena(a) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& o) : arena(o.arena) {}
+
+  T* allocate(size_t n) {
+    return (T*)(arena ? arena->alloc(n * sizeof(T)) : ::operator new(n * sizeof(T)));
+  }
+  void deallocate(T* p, size_t n) {
+    if (arena)
+      arena->free(p, n * sizeof(T));
+    else
+      ::operator delete(p);
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& o) const { return arena == o.arena; }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& o) const { return arena != o.arena; }
+};
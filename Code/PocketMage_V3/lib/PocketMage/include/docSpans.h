@@ -0,0 +1,230 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// ===================== DOC SPANS =====================
+/*
+DocSpans:
+@Description
+  Where each line of a paged document is on the card. A span is a run of consecutive
+  lines of one file: the base file (the note as it was loaded or saved, seeked through
+  its line index) or the overlay, an append-only file that edited lines are written to
+  when they're paged out. The lines before and after the window are span lists in
+  document order, so paging is moving lines between them and the window, and saving is
+  streaming the spans around the window.
+
+  Every window line remembers where it was read from until it's edited. Paging lines
+  out hands the unedited ones back as spans without writing anything; the caller
+  appends only the edited ones to the overlay first (overlayLine()), in order. Overlay
+  line offsets are kept here, one per line written, until reset().
+
+  Usage:
+    DocSpans spans;
+    spans.reset(lineCount);            // note just indexed, window empty
+    spans.load(first, last, read);     // parse the lines in read into the window
+    spans.changed(i);                  // window line i was edited
+    if (spans.edited(0)) spans.overlayLine(start, end);  // appended it to the overlay
+    spans.dropFront(1);
+    spans.above(n, read);              // lines to page in above the window
+    spans.takeAbove(n);
+*/
+
+enum DocSpanFile : uint8_t { DOC_BASE, DOC_OVERLAY };
+
+struct DocSpan {
+  uint8_t  file;   // DocSpanFile
+  uint32_t first;  // line in that file
+  uint32_t count;  // 0 for an edited window line, it isn't on the card
+};
+
+class DocSpans {
+public:
+  // The base file has count lines and none of them is in the window
+  void reset(uint32_t count) {
+    before_.clear();
+    window_.clear();
+    after_.clear();
+    overlay_.clear();
+    overlayEnd_ = 0;
+    if (count) after_.push_back({DOC_BASE, 0, count});
+  }
+
+  uint32_t before() const { return lines(before_); }
+  uint32_t after()  const { return lines(after_); }
+  uint32_t window() const { return (uint32_t)window_.size(); }
+  // Every line is in the window
+  bool     empty()  const { return before_.empty() && after_.empty(); }
+
+  // Window line i has edits the card doesn't
+  bool edited(uint32_t i) const { return i < window_.size() && !window_[i].count; }
+
+  // Edits to the window, same numbering as EditLog
+  void changed(uint32_t i) {
+    if (i < window_.size()) window_[i] = {DOC_BASE, 0, 0};
+  }
+  void inserted(uint32_t i) {
+    if (i <= window_.size()) window_.insert(window_.begin() + i, {DOC_BASE, 0, 0});
+  }
+  void erased(uint32_t i) {
+    if (i < window_.size()) window_.erase(window_.begin() + i);
+  }
+
+  // An edited line was appended to the overlay at [start, end)
+  void overlayLine(uint32_t start, uint32_t end) {
+    overlay_.push_back(start);
+    overlayEnd_ = end;
+  }
+  uint32_t overlayLines() const { return (uint32_t)overlay_.size(); }
+  // Byte offset of overlay line n, the end of the overlay for n == overlayLines()
+  uint32_t overlayOffset(uint32_t n) const {
+    return n < overlay_.size() ? overlay_[n] : overlayEnd_;
+  }
+
+  // The n window lines at its front / back leave the window. The edited ones among
+  // them were just appended to the overlay, in order
+  void dropFront(uint32_t n) {
+    if (n > window_.size()) n = (uint32_t)window_.size();
+    std::vector<DocSpan> dropped = placed(0, n);
+    window_.erase(window_.begin(), window_.begin() + n);
+    append(before_, dropped);
+  }
+  void dropBack(uint32_t n) {
+    if (n > window_.size()) n = (uint32_t)window_.size();
+    const uint32_t first = (uint32_t)window_.size() - n;
+    std::vector<DocSpan> dropped = placed(first, n);
+    window_.erase(window_.begin() + first, window_.end());
+    append(dropped, after_);
+    after_.swap(dropped);
+  }
+
+  // Spans of the last n lines before the window / the first n after it
+  void above(uint32_t n, std::vector<DocSpan>& out) const {
+    std::vector<DocSpan> rest(before_);
+    out.clear();
+    cutBack(rest, n, out);
+  }
+  void below(uint32_t n, std::vector<DocSpan>& out) const {
+    std::vector<DocSpan> rest(after_);
+    out.clear();
+    cutFront(rest, n, out);
+  }
+  // Those lines were read into the window
+  void takeAbove(uint32_t n) {
+    std::vector<DocSpan> taken;
+    cutBack(before_, n, taken);
+    std::vector<DocSpan> lines = perLine(taken);
+    window_.insert(window_.begin(), lines.begin(), lines.end());
+  }
+  void takeBelow(uint32_t n) {
+    std::vector<DocSpan> taken;
+    cutFront(after_, n, taken);
+    std::vector<DocSpan> lines = perLine(taken);
+    window_.insert(window_.end(), lines.begin(), lines.end());
+  }
+
+  // Make document lines [first, last) the window, which has to be empty (dropped).
+  // out gets the spans to read them from
+  void load(uint32_t first, uint32_t last, std::vector<DocSpan>& out) {
+    std::vector<DocSpan> all;
+    append(all, before_);
+    append(all, after_);
+    before_.clear();
+    after_.clear();
+
+    cutFront(all, first, before_);
+    out.clear();
+    cutFront(all, last > first ? last - first : 0, out);
+    after_.swap(all);
+    window_ = perLine(out);
+  }
+
+  const std::vector<DocSpan>& beforeSpans() const { return before_; }
+  const std::vector<DocSpan>& afterSpans()  const { return after_; }
+
+private:
+  static uint32_t lines(const std::vector<DocSpan>& spans) {
+    uint32_t n = 0;
+    for (const DocSpan& s : spans) n += s.count;
+    return n;
+  }
+
+  // Joins s onto the last span when it carries on where that one stops
+  static void push(std::vector<DocSpan>& spans, const DocSpan& s) {
+    if (!s.count) return;
+    if (!spans.empty()) {
+      DocSpan& last = spans.back();
+      if (last.file == s.file && last.first + last.count == s.first) {
+        last.count += s.count;
+        return;
+      }
+    }
+    spans.push_back(s);
+  }
+  static void append(std::vector<DocSpan>& to, const std::vector<DocSpan>& from) {
+    for (const DocSpan& s : from) push(to, s);
+  }
+
+  static std::vector<DocSpan> perLine(const std::vector<DocSpan>& spans) {
+    std::vector<DocSpan> out;
+    for (const DocSpan& s : spans)
+      for (uint32_t i = 0; i < s.count; i++) out.push_back({s.file, s.first + i, 1});
+    return out;
+  }
+
+  // Spans of window lines [first, first + n), edited ones numbered as the last
+  // overlay lines in order
+  std::vector<DocSpan> placed(uint32_t first, uint32_t n) const {
+    uint32_t edits = 0;
+    for (uint32_t i = first; i < first + n; i++)
+      if (!window_[i].count) edits++;
+    uint32_t next = edits <= overlay_.size() ? (uint32_t)overlay_.size() - edits : 0;
+
+    std::vector<DocSpan> spans;
+    for (uint32_t i = first; i < first + n; i++) {
+      if (window_[i].count) push(spans, window_[i]);
+      else push(spans, {DOC_OVERLAY, next++, 1});
+    }
+    return spans;
+  }
+
+  // Moves the first n lines of from to the end of out
+  static void cutFront(std::vector<DocSpan>& from, uint32_t n, std::vector<DocSpan>& out) {
+    size_t i = 0;
+    for (; i < from.size() && n; i++) {
+      DocSpan& s = from[i];
+      if (s.count > n) {
+        push(out, {s.file, s.first, n});
+        s.first += n;
+        s.count -= n;
+        break;
+      }
+      push(out, s);
+      n -= s.count;
+    }
+    from.erase(from.begin(), from.begin() + i);
+  }
+  // Moves the last n lines of from to the front of out
+  static void cutBack(std::vector<DocSpan>& from, uint32_t n, std::vector<DocSpan>& out) {
+    std::vector<DocSpan> taken;
+    while (!from.empty() && n) {
+      DocSpan& s = from.back();
+      if (s.count > n) {
+        taken.insert(taken.begin(), {s.file, s.first + s.count - n, n});
+        s.count -= n;
+        break;
+      }
+      taken.insert(taken.begin(), s);
+      n -= s.count;
+      from.pop_back();
+    }
+    append(taken, out);
+    out.swap(taken);
+  }
+
+  std::vector<DocSpan>  before_;
+  std::vector<DocSpan>  window_;    // one per window line, where it was read from
+  std::vector<DocSpan>  after_;
+  std::vector<uint32_t> overlay_;   // start of each overlay line
+  uint32_t              overlayEnd_ = 0;
+};
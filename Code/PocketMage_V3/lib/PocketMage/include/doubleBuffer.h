@@ -0,0 +1,69 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// ===================== DOUBLE BUFFER =====================
+/*
+DoubleBuffer:
+@Description
+  Hands snapshots from one writer task to one reader task without locks. The writer
+  fills the back buffer and publishes it with an atomic index flip, the reader pins
+  the published buffer while it uses it. Neither side ever waits on the other.
+
+  While the reader holds a buffer the writer can still fill and publish the other
+  one. Only a second publish during the same read has nowhere to go: beginWrite()
+  returns nullptr and the writer tries again later (its data is still dirty).
+
+  Usage:
+    DoubleBuffer<Frame> frames;
+    // writer (input loop)
+    if (Frame* f = frames.beginWrite()) { fill(*f); frames.publish(); }
+    // reader (e-ink task)
+    if (frames.version() != shown) {
+      const Frame& f = frames.acquire(&shown);
+      draw(f);
+      frames.release();
+    }
+*/
+
+template <typename T>
+class DoubleBuffer {
+public:
+  // Writer: buffer to fill, nullptr while the reader is still using it
+  T* beginWrite() {
+    const int back = 1 - front_.load();
+    if (reading_.load() == back) return nullptr;
+    return &slots_[back];
+  }
+
+  // Writer: make the buffer returned by beginWrite() the one the reader gets
+  void publish() {
+    const int back = 1 - front_.load();
+    versions_[back] = version_.load() + 1;
+    version_.store(versions_[back]);
+    front_.store(back);
+  }
+
+  // Version of the latest published buffer, 0 before the first publish
+  uint32_t version() const { return version_.load(); }
+
+  // Reader: pin the latest buffer, it won't change until release()
+  const T& acquire(uint32_t* version = nullptr) {
+    int i;
+    do {
+      i = front_.load();
+      reading_.store(i);
+    } while (front_.load() != i);  // flipped before the pin landed, the old one may be rewritten
+    if (version) *version = versions_[i];
+    return slots_[i];
+  }
+
+  void release() { reading_.store(-1); }
+
+private:
+  T                     slots_[2];
+  uint32_t              versions_[2] = {0, 0};
+  std::atomic<int>      front_{0};
+  std::atomic<int>      reading_{-1};
+  std::atomic<uint32_t> version_{0};
+};
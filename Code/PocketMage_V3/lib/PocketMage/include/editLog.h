@@ -0,0 +1,119 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+// ===================== EDIT LOG =====================
+/*
+EditLog:
+@Description
+  Collects edits to a line based document between two writes of a write-ahead log.
+  Keystrokes only mark a line as changed, so a batch holds each touched line once no
+  matter how much was typed into it. Inserted and erased lines are kept in order.
+
+  pack() writes a batch as text lines:
+    I <n>          insert an empty line before line n
+    D <n>          erase line n
+    S <n> <text>   line n now holds text
+    C <seq>        end of batch, a batch without one was cut short
+  Applying the I/D ops in order to the previous state gives the new line layout, the
+  S ops then fill in every line that changed (numbered after all the I/D ops).
+
+  Usage:
+    EditLog log;
+    log.changed(4);                    // typed into line 4
+    log.inserted(5);                   // ENTER
+    String batch;
+    log.pack(batch, seq, [&](String& out, uint32_t line) { out += textOf(line); });
+
+    EditLogOp op;
+    const char* text = parseEditLogLine(line, op);  // replay, text is set for 'S'
+    if (!editLogOpFits(op, lineCount)) reject();
+*/
+
+struct EditLogOp {
+  char     kind = 0;  // 'I', 'D', 'S' or 'C', 0 if the line isn't an op
+  uint32_t n    = 0;  // line, or batch number for 'C'
+};
+
+// Parse one log line, returns where the text of an 'S' op starts (nullptr otherwise)
+inline const char* parseEditLogLine(const char* s, EditLogOp& op) {
+  op = EditLogOp();
+  if (!strchr("IDSC", s[0]) || s[0] == 0 || s[1] != ' ')
+    return nullptr;
+  char* end = nullptr;
+  const unsigned long n = strtoul(s + 2, &end, 10);
+  if (end == s + 2)
+    return nullptr;
+  op.kind = s[0];
+  op.n    = (uint32_t)n;
+  if (op.kind != 'S')
+    return nullptr;
+  return *end == ' ' ? end + 1 : end;
+}
+
+// Whether op can be applied to lines lines: I may add one at the end, D and S have to
+// name a line that's there. A log with one that can't doesn't belong to the document
+inline bool editLogOpFits(const EditLogOp& op, uint32_t lines) {
+  return op.kind == 'I' ? op.n <= lines : op.n < lines;
+}
+
+class EditLog {
+public:
+  bool empty() const { return ops_.empty() && changed_.empty(); }
+
+  void clear() {
+    ops_.clear();
+    changed_.clear();
+  }
+
+  void changed(uint32_t line) {
+    auto it = std::lower_bound(changed_.begin(), changed_.end(), line);
+    if (it == changed_.end() || *it != line)
+      changed_.insert(it, line);
+  }
+
+  // A new line at line, its text is logged with the changed lines
+  void inserted(uint32_t line) {
+    ops_.push_back({'I', line});
+    for (uint32_t& c : changed_)
+      if (c >= line) c++;
+    changed(line);
+  }
+
+  void erased(uint32_t line) {
+    ops_.push_back({'D', line});
+    auto it = std::lower_bound(changed_.begin(), changed_.end(), line);
+    if (it != changed_.end() && *it == line)
+      it = changed_.erase(it);
+    for (; it != changed_.end(); ++it) (*it)--;
+  }
+
+  const std::vector<uint32_t>& changedLines() const { return changed_; }
+
+  // Append the batch to out and clear. textOf(out, line) appends the text of line
+  template <typename Out, typename TextFn>
+  void pack(Out& out, uint32_t seq, TextFn textOf) {
+    char num[16];
+    for (const EditLogOp& op : ops_) {
+      snprintf(num, sizeof(num), "%c %lu\n", op.kind, (unsigned long)op.n);
+      out += num;
+    }
+    for (uint32_t line : changed_) {
+      snprintf(num, sizeof(num), "S %lu ", (unsigned long)line);
+      out += num;
+      textOf(out, line);
+      out += "\n";
+    }
+    snprintf(num, sizeof(num), "C %lu\n", (unsigned long)seq);
+    out += num;
+    clear();
+  }
+
+private:
+  std::vector<EditLogOp> ops_;      // I and D, in the order they happened
+  std::vector<uint32_t>  changed_;  // sorted, numbered after all of ops_
+};
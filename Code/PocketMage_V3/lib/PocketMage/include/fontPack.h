@@ -0,0 +1,290 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <textMetrics.h>  // GFXfont
+
+// ===================== FONT PACK =====================
+/*
+FontPack / FontCache:
+@Description
+  GFXfonts kept on the SD card as .pmf packs instead of in the app image. A pack is
+  loaded the first time it is used and dropped again, least recently used first, once
+  the loaded packs pass the cache budget. tools/gfxfont2pmf.py makes packs from the
+  GFXfont headers.
+
+  A pack is "PMF1", first and last char (uint16), yAdvance, a zero byte and the bitmap
+  size (uint32), then 7 bytes per glyph (bitmapOffset uint16, width, height, xAdvance,
+  xOffset, yOffset) and the bitmap, all little endian. Those are the GFXfont fields, so
+  a loaded pack is drawn by Adafruit GFX like a compiled font.
+
+  Every pack has a FontHandle for as long as the cache lives. use() returns the pack's
+  own GFXfont while it's loaded and the fallback otherwise, switching between them is
+  one pointer store, a loaded GFXfont is never rewritten. Packs used by the frame being
+  laid out and the two before it (the one published and the one the e-ink task may
+  still draw) are not evicted, the cache goes over budget instead. A pack that can't be
+  loaded is replaced by the fallback until clear().
+
+  Frames are counted with nextFrame(). Only the task that lays out calls the cache, and
+  it calls clear() only once no frame drawn from the cache is left to the e-ink task.
+
+  Usage:
+    FontCache cache(48 * 1024, loadPackFromSD, micros);
+    FontHandle* h = cache.handle("/assets/fonts/FreeSerif9pt8b.pmf", &FreeSerif9pt7b);
+    out.setFont(cache.use(h));   // the pack, or the fallback
+    cache.nextFrame();           // after publishing a frame
+*/
+#define FONT_PACK_HEADER   14
+#define FONT_PACK_GLYPH    7
+#define FONT_PACK_PATH_LEN 48
+
+struct FontPackHeader {
+  uint16_t first       = 0;
+  uint16_t last        = 0;
+  uint8_t  yAdvance    = 0;
+  uint32_t bitmapBytes = 0;
+
+  size_t glyphs() const { return (last >= first) ? (size_t)(last - first + 1) : 0; }
+  // Memory a loaded pack takes, glyph table and bitmap in one block
+  size_t loadedBytes() const { return glyphs() * sizeof(GFXglyph) + bitmapBytes; }
+};
+
+inline bool parseFontPackHeader(const uint8_t* p, size_t n, FontPackHeader& h) {
+  if (n < FONT_PACK_HEADER || memcmp(p, "PMF1", 4) != 0) return false;
+  h.first       = p[4] | (p[5] << 8);
+  h.last        = p[6] | (p[7] << 8);
+  h.yAdvance    = p[8];
+  h.bitmapBytes = p[10] | (p[11] << 8) | ((uint32_t)p[12] << 16) | ((uint32_t)p[13] << 24);
+  // 8b GFXfonts top out around 30 KB, anything far past that is not a pack
+  return h.glyphs() > 0 && h.glyphs() <= 256 && h.bitmapBytes <= 0xFFFF;
+}
+
+// Reads a pack through read(dst, n) (returns bytes read) into one block from
+// alloc(bytes), and points font at it. False, with nothing allocated left behind, if the
+// pack is damaged or memory runs out
+template<class ReadFn, class AllocFn>
+bool loadFontPack(ReadFn&& read, AllocFn&& alloc, GFXfont& font, uint8_t*& block,
+                  size_t& bytes) {
+  uint8_t buf[16 * FONT_PACK_GLYPH];
+  FontPackHeader h;
+  if (read(buf, FONT_PACK_HEADER) != FONT_PACK_HEADER ||
+      !parseFontPackHeader(buf, FONT_PACK_HEADER, h))
+    return false;
+
+  bytes = h.loadedBytes();
+  block = alloc(bytes);
+  if (!block) return false;
+  GFXglyph* glyphs = reinterpret_cast<GFXglyph*>(block);
+  uint8_t*  bitmap = block + h.glyphs() * sizeof(GFXglyph);
+
+  // glyph records are packed on the card, GFXglyph is padded in memory
+  bool ok = true;
+  for (size_t i = 0; ok && i < h.glyphs();) {
+    const size_t batch = (h.glyphs() - i < 16) ? h.glyphs() - i : 16;
+    if (read(buf, batch * FONT_PACK_GLYPH) != batch * FONT_PACK_GLYPH) {
+      ok = false;
+      break;
+    }
+    for (size_t j = 0; j < batch; j++, i++) {
+      const uint8_t* r = buf + j * FONT_PACK_GLYPH;
+      GFXglyph& g    = glyphs[i];
+      g.bitmapOffset = r[0] | (r[1] << 8);
+      g.width        = r[2];
+      g.height       = r[3];
+      g.xAdvance     = r[4];
+      g.xOffset      = (int8_t)r[5];
+      g.yOffset      = (int8_t)r[6];
+      // drawing it would read past the bitmap
+      if (g.bitmapOffset + ((size_t)g.width * g.height + 7) / 8 > h.bitmapBytes) ok = false;
+    }
+  }
+  if (ok && read(bitmap, h.bitmapBytes) == h.bitmapBytes) {
+    font.bitmap   = bitmap;
+    font.glyph    = glyphs;
+    font.first    = h.first;
+    font.last     = h.last;
+    font.yAdvance = h.yAdvance;
+    return true;
+  }
+  free(block);
+  block = nullptr;
+  return false;
+}
+
+// Pack bytes for a GFXfont, what gfxfont2pmf.py writes (used by the tests)
+inline std::vector<uint8_t> encodeFontPack(const GFXfont& f) {
+  const size_t n = (f.last >= f.first) ? f.last - f.first + 1 : 0;
+  uint32_t bitmapBytes = 0;
+  for (size_t i = 0; i < n; i++) {
+    const GFXglyph& g = f.glyph[i];
+    const uint32_t end = g.bitmapOffset + ((uint32_t)g.width * g.height + 7) / 8;
+    if (end > bitmapBytes) bitmapBytes = end;
+  }
+  std::vector<uint8_t> out = {'P', 'M', 'F', '1',
+                              (uint8_t)f.first, (uint8_t)(f.first >> 8),
+                              (uint8_t)f.last,  (uint8_t)(f.last >> 8),
+                              f.yAdvance, 0,
+                              (uint8_t)bitmapBytes, (uint8_t)(bitmapBytes >> 8),
+                              (uint8_t)(bitmapBytes >> 16), (uint8_t)(bitmapBytes >> 24)};
+  for (size_t i = 0; i < n; i++) {
+    const GFXglyph& g = f.glyph[i];
+    out.insert(out.end(), {(uint8_t)g.bitmapOffset, (uint8_t)(g.bitmapOffset >> 8), g.width,
+                           g.height, g.xAdvance, (uint8_t)g.xOffset, (uint8_t)g.yOffset});
+  }
+  out.insert(out.end(), f.bitmap, f.bitmap + bitmapBytes);
+  return out;
+}
+
+struct FontHandle {
+  GFXfont                 font = {};      // the pack, only valid while loaded
+  const GFXfont*          fallback;
+  const GFXfont* volatile cur;            // what use() returns, &font or fallback
+  uint8_t*       block   = nullptr;
+  uint32_t       bytes   = 0;
+  uint32_t       lastUse = 0;     // use() count when last used, for LRU
+  uint32_t       frame   = 0;     // frame it was last used in
+  bool           failed  = false;
+  char           path[FONT_PACK_PATH_LEN];
+
+  bool loaded() const { return block != nullptr; }
+};
+
+struct FontCacheStats {
+  uint32_t hits       = 0;  // use() of a loaded pack
+  uint32_t misses     = 0;  // use() that had to load one
+  uint32_t failures   = 0;  // loads that fell back
+  uint32_t evictions  = 0;
+  uint32_t overBudget = 0;  // loads that couldn't make room
+  uint32_t loadUs     = 0;  // first-use latency, all loads
+  uint32_t loadUsMax  = 0;
+
+  uint32_t hitPercent() const {
+    return (hits + misses) ? (uint32_t)((uint64_t)hits * 100 / (hits + misses)) : 100;
+  }
+  uint32_t loadUsAvg() const {
+    const uint32_t loads = misses - failures;
+    return loads ? loadUs / loads : 0;
+  }
+};
+
+class FontCache {
+public:
+  // Loads path through loadFontPack() with cache.allocate() as alloc
+  typedef bool (*LoadFn)(const char* path, FontCache& cache, GFXfont& font, uint8_t*& block,
+                         size_t& bytes);
+  typedef uint32_t (*ClockFn)();  // microseconds
+
+  static constexpr uint32_t KEEP_FRAMES = 3;
+
+  FontCache(size_t budget, LoadFn load, ClockFn clock)
+      : budget_(budget), load_(load), clock_(clock) {}
+  ~FontCache() {
+    for (size_t i = 0; i < count_; i++) free(handles_[i].block);
+  }
+  FontCache(const FontCache&) = delete;
+  FontCache& operator=(const FontCache&) = delete;
+
+  // Handle for the pack at path, the same one every time. nullptr once MAX_FONT_PACKS
+  // are known, use() then returns nullptr too
+  FontHandle* handle(const char* path, const GFXfont* fallback) {
+    for (size_t i = 0; i < count_; i++) {
+      if (strcmp(handles_[i].path, path) == 0) return &handles_[i];
+    }
+    if (count_ >= MAX_FONT_PACKS || strlen(path) >= FONT_PACK_PATH_LEN) return nullptr;
+    FontHandle& h = handles_[count_++];
+    strcpy(h.path, path);
+    h.fallback = fallback;
+    h.cur      = fallback;
+    return &h;
+  }
+
+  // Font to draw and measure h with, loading the pack if it isn't
+  const GFXfont* use(FontHandle* h) {
+    if (!h) return nullptr;
+    h->lastUse = ++tick_;
+    h->frame   = frame_;
+    if (h->loaded()) {
+      stats_.hits++;
+      return h->cur;
+    }
+    if (h->failed) return h->cur;
+
+    stats_.misses++;
+    const uint32_t t0 = clock_();
+    GFXfont  font  = {};
+    uint8_t* block = nullptr;
+    size_t   bytes = 0;
+    if (!load_(h->path, *this, font, block, bytes)) {
+      h->failed = true;
+      stats_.failures++;
+      return h->cur;
+    }
+    const uint32_t us = clock_() - t0;
+    stats_.loadUs += us;
+    if (us > stats_.loadUsMax) stats_.loadUsMax = us;
+
+    h->block = block;
+    h->bytes = bytes;
+    h->font  = font;  // not drawn from while unloaded
+    h->cur   = &h->font;
+    used_   += bytes;
+    return h->cur;
+  }
+
+  // Memory for a pack about to be loaded, evicting packs no frame needs to make room
+  uint8_t* allocate(size_t bytes) {
+    while (used_ + bytes > budget_ && evictOldest()) {}
+    if (used_ + bytes > budget_) stats_.overBudget++;
+    uint8_t* p;
+    // the heap may be fragmented even when under budget
+    while (!(p = (uint8_t*)malloc(bytes)) && evictOldest()) {}
+    return p;
+  }
+
+  // A frame was published, the packs it used stay for KEEP_FRAMES frames
+  void nextFrame() { frame_++; }
+
+  // Drops every pack and forgets failed loads (leaving the app, a new SD card). Only once
+  // the e-ink task holds no frame that was laid out with the cache
+  void clear() {
+    for (size_t i = 0; i < count_; i++) {
+      if (handles_[i].loaded()) evict(handles_[i]);
+      handles_[i].failed = false;
+    }
+  }
+
+  size_t used()   const { return used_; }
+  size_t budget() const { return budget_; }
+  const FontCacheStats& stats() const { return stats_; }
+
+private:
+  bool evictOldest() {
+    FontHandle* oldest = nullptr;
+    for (size_t i = 0; i < count_; i++) {
+      FontHandle& h = handles_[i];
+      if (!h.loaded() || frame_ - h.frame < KEEP_FRAMES) continue;
+      if (!oldest || h.lastUse < oldest->lastUse) oldest = &h;
+    }
+    if (!oldest) return false;
+    evict(*oldest);
+    return true;
+  }
+  void evict(FontHandle& h) {
+    h.cur = h.fallback;
+    free(h.block);
+    h.block = nullptr;
+    used_  -= h.bytes;
+    h.bytes = 0;
+    stats_.evictions++;
+  }
+  FontHandle     handles_[MAX_FONT_PACKS];
+  size_t         count_  = 0;
+  size_t         budget_;
+  size_t         used_   = 0;
+  uint32_t       tick_   = 0;
+  uint32_t       frame_  = 0;
+  LoadFn         load_;
+  ClockFn        clock_;
+  FontCacheStats stats_;
+};
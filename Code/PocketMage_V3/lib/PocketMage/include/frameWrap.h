@@ -0,0 +1,117 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include <textMetrics.h>
+#include <wordWrap.h>
+
+// ===================== FRAME WRAP =====================
+/*
+FrameWrap:
+@Description
+  Splits text frame lines into the slices drawn on each row and remembers where the
+  slices end, so redrawing a frame after a scroll or a new choice measures nothing.
+
+  sliceThatFits() gives the length of the next slice: as much as fits in the width,
+  ending after the last space when the line goes on. It grows the width one glyph at
+  a time from the font's advance table instead of measuring the slice again for
+  every character.
+
+  WrapCache holds the slice ends of one source. use() keeps them while the source,
+  its version, the width and the font are the same and drops them otherwise. Lines
+  are measured the first time they're drawn.
+
+  Usage:
+    frame.wrap.use(src, src->version(), src->size(), width, font);
+    const uint16_t* ends;
+    size_t n = frame.wrap.slices(line, lv.ptr, len, fontMetrics(font), ends);
+    // slice k is [k ? ends[k - 1] : 0, ends[k])
+*/
+
+// Length of the longest start of s (at least 1 char) that is no wider than maxWidth
+inline size_t sliceThatFits(const char* s, size_t n, const FontMetrics& fm, int maxWidth) {
+  if (!s || n == 0) return 0;
+
+  LineBox box;
+  size_t best = 0, lastSpace = SIZE_MAX;
+  size_t i = 0;
+  while (i < n) {
+    const char c = s[i];
+    // newline: either end before it, or consume 1 char if it's first
+    if (c == '\n' || c == '\r') return (best > 0) ? best : 1;
+    if (c == ' ') lastSpace = i;
+
+    box.add(fm.glyph((uint8_t)c));
+    if ((int)box.width() > maxWidth) break;
+    best = ++i;
+  }
+
+  if (best == 0) return 1;
+  if (i < n && lastSpace != SIZE_MAX && lastSpace + 1 <= best) return lastSpace + 1;
+  return best;
+}
+
+class WrapCache {
+public:
+  // Start over unless this is what the cached slices were measured for
+  void use(const void* source, uint32_t version, size_t lines, int width, const void* font) {
+    if (source != source_ || version != version_ || width != width_ || font != font_) {
+      source_  = source;
+      version_ = version;
+      width_   = width;
+      font_    = font;
+      entries_.clear();
+      ends_.clear();
+    }
+    // Between version changes sources only grow at the end
+    entries_.resize(lines);
+  }
+
+  bool measured(size_t line) const {
+    return line < entries_.size() && entries_[line].count != UNMEASURED;
+  }
+
+  // Slice ends of line (within the line), measuring text the first time. Returns the count
+  size_t slices(size_t line, const char* text, size_t len, const FontMetrics& fm,
+                const uint16_t*& ends) {
+    static const uint16_t none = 0;
+    ends = &none;
+    if (line >= entries_.size()) return 0;
+
+    Entry& e = entries_[line];
+    if (e.count == UNMEASURED) {
+      e.first = (uint32_t)ends_.size();
+      size_t pos = 0;
+      while (pos < len && ends_.size() - e.first < UNMEASURED - 1) {
+        const size_t take = sliceThatFits(text + pos, len - pos, fm, width_);
+        if (take == 0) break;
+        pos += take;
+        ends_.push_back((uint16_t)pos);
+      }
+      e.count = (uint16_t)(ends_.size() - e.first);
+    }
+    ends = ends_.data() + e.first;
+    return e.count;
+  }
+
+  size_t measuredLines() const {
+    size_t n = 0;
+    for (const Entry& e : entries_) n += e.count != UNMEASURED;
+    return n;
+  }
+
+private:
+  static const uint16_t UNMEASURED = 0xFFFF;
+  struct Entry {
+    uint32_t first = 0;           // into ends_
+    uint16_t count = UNMEASURED;  // slices
+  };
+
+  const void*           source_  = nullptr;
+  uint32_t              version_ = 0;
+  int                   width_   = -1;
+  const void*           font_    = nullptr;
+  std::vector<Entry>    entries_;
+  std::vector<uint16_t> ends_;
+};
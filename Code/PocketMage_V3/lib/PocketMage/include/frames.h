@@ -3,54 +3,17 @@
 #include <Adafruit_GFX.h>
 #include <vector>
 #include <GxEPD2_BW.h>
+#include <frameWrap.h>
+#include <dirtyRects.h>
+#include <textSource.h>
 
 // ===================== FRAME CLASS =====================
 # define MAX_FRAMES 100
 # define X_OFFSET 4
+# define FRAME_MAX_WINDOWS 4   // partial windows per redraw, more dirty areas get merged
+# define FRAME_ROW_PAD 4       // px redrawn above and below a changed row for descenders
 #pragma region textSource
-// bit flags for alignment or future options
-enum LineFlags : uint8_t { LF_NONE=0, LF_RIGHT= 1<<0, LF_CENTER= 1<<1 };
-struct LineView {
-  const char* ptr;   // points to NUL-terminated string in RAM or PROGMEM
-  uint16_t    len;   // byte length (no need to include '\0')
-  uint8_t     flags; // LineFlags
-};
-// read-only interface for any line list (PROGMEM table, arena, etc.)
-struct TextSource {
-  virtual ~TextSource() {}
-  virtual size_t   size() const = 0;
-  virtual LineView line(size_t i) const = 0; 
-};
-template<size_t MAX_LINES, size_t BUF_BYTES>
-struct FixedArenaSource : TextSource {
-  char     buf[BUF_BYTES];
-  uint16_t off[MAX_LINES];
-  uint16_t len_[MAX_LINES];
-  uint8_t  flags_[MAX_LINES];
-  size_t   nLines = 0;
-  size_t   used   = 0;
-
-  size_t size() const override { return nLines; }
-
-  LineView line(size_t i) const override {
-    return { buf + off[i], len_[i], flags_[i] };
-  }
-
-  void clear() { nLines = 0; used = 0; }
-
-  // Returns false if out of capacity; caller can choose to drop the oldest, etc.
-  bool pushLine(const char* s, uint16_t L, uint8_t flags = LF_NONE) {
-    if (nLines >= MAX_LINES || used + L + 1 > BUF_BYTES) return false;
-    memcpy(buf + used, s, L);
-    buf[used + L] = '\0';
-    off[nLines]   = (uint16_t)used;
-    len_[nLines]  = L;
-    flags_[nLines]= flags;
-    used         += L + 1;
-    nLines++;
-    return true;
-  }
-};
+// TextSource, FixedArenaSource and RingArenaSource are in textSource.h
 struct ProgmemTableSource : TextSource {
   // table is a PROGMEM array of PROGMEM pointers to '\0'-terminated strings
   const char* const* table; // PROGMEM
@@ -110,6 +73,29 @@ extern ProgmemTableSource helpSrc;
 
 #pragma endregion
 #pragma region frameSetup
+// What a frame showed when it was drawn, einkFramesDynamic() compares it to find changes
+struct FrameState {
+  const void*    content = nullptr;  // source or bitmap
+  uint32_t       version = 0;
+  long           total   = -1;
+  long           start   = 0;        // visible source lines [start, end)
+  long           end     = 0;
+  int            choice  = -1;
+  bool           current = false;    // CurrentFrameState, which shows the choice
+  bool           invert  = false;
+  bool           box     = false;
+  int            left = 0, right = 0, top = 0, bottom = 0;
+  const GFXfont* font    = nullptr;
+
+  // same except for the choice
+  bool sameLayout(const FrameState& o) const {
+    return content == o.content && version == o.version && total == o.total &&
+           start == o.start && end == o.end && current == o.current && invert == o.invert &&
+           box == o.box && left == o.left && right == o.right && top == o.top &&
+           bottom == o.bottom && font == o.font;
+  }
+};
+
 class Frame {
 public:
   // what kind of content this frame holds
@@ -139,6 +125,12 @@ public:
   const TextSource* source = nullptr;  // for text frames
   const uint8_t* bitmap    = nullptr;  // for bitmap frames
   const GFXfont *font = (GFXfont *)&FreeSerif9pt7b;
+  WrapCache wrap;                      // slices of source lines, see frameWrap.h
+
+  // redraw bookkeeping
+  bool       drawn = false;            // false: redraw all of it next time
+  FrameState shown;                    // state when last drawn
+  FrameState next;                     // state being drawn
 
   
   // base constructor for common fields
@@ -169,6 +161,8 @@ public:
 
   bool hasText()   const { return kind == Kind::text   && source; }
   bool hasBitmap() const { return kind == Kind::bitmap && bitmap; }
+  // content changed in a way the source's size() and version() don't show
+  void markDirty() { drawn = false; }
 };
 
 extern Frame testBitmapScreen;
@@ -184,13 +178,17 @@ extern std::vector<Frame*> frames;
 // <FRAMES.cpp>
   // main functions
 void einkFramesDynamic(std::vector<Frame*> &frames, bool doFull_);
+void layoutFrame(Frame &frame, const GFXfont *font);
+void addFrameDirty(std::vector<DirtyRect> &dirty, Frame &frame, const FontMetrics &fm, bool doFull_);
+void drawFrame(Frame &frame, const TextSource *src, const FontMetrics &fm, bool doFull_);
   // text boxes
 std::vector<String> formatText(Frame &frame,int maxTextWidth);
+void drawLineInFrame(const char* s, size_t len, uint8_t flags, int lineIndex, Frame &frame,
+                     const FontMetrics &fm, bool clearLine);
 void drawLineInFrame(String &srcLine, int lineIndex, Frame &frame, int usableY, bool clearLine, bool isPartial);
 void drawFrameBox(int usableX, int usableY, int usableWidth, int usableHeight,bool invert);
 int computeCursorX(Frame &frame, bool rightAlign, bool centerAlign, int16_t x1, uint16_t lineWidth);
   // String formatting
-static size_t sliceThatFits(const char* s, size_t n, int maxTextWidth);
 std::vector<String> sourceToVector(const TextSource* src);
 String frameChoiceString(const Frame& f);  
   //scroll
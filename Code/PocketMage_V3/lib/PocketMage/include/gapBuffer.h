@@ -0,0 +1,183 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <docArena.h>
+
+// ===================== GAP BUFFER =====================
+/*
+GapBuffer:
+@Description
+  Editable text with one attribute byte per character (bold/italic flags for TXT).
+  Free space (the gap) sits at the last edit position, so typing, deleting and
+  moving a few characters is O(1) amortized anywhere in the text. Characters and
+  attributes share a single heap block that doubles when full.
+
+  Reading with at()/attrAt() never moves the gap. contiguous() may move it so a
+  span can be handed to code that wants a plain pointer (font measuring).
+  Given a DocArena the block comes from it instead of the heap.
+
+  Usage:
+    GapBuffer buf;
+    buf.insert(0, "hello", 5, 0);
+    buf.insert(5, '!', 0);
+    buf.erase(0, 1);                         // "ello!"
+    const char* p = buf.contiguous(1, 3);    // "llo", not null terminated
+*/
+#define GAPBUFFER_MAX_SIZE 0xFFFF  // spans into the buffer are 16 bit
+#define GAPBUFFER_MIN_GROW 16
+
+class GapBuffer {
+public:
+  GapBuffer() = default;
+  explicit GapBuffer(DocArena* arena) : arena_(arena) {}
+  ~GapBuffer() { release(); }
+
+  GapBuffer(const GapBuffer&) = delete;
+  GapBuffer& operator=(const GapBuffer&) = delete;
+  GapBuffer(GapBuffer&& o) noexcept { take(o); }
+  GapBuffer& operator=(GapBuffer&& o) noexcept {
+    if (this != &o) {
+      release();
+      take(o);
+    }
+    return *this;
+  }
+
+  size_t size()     const { return cap_ - gapLen(); }
+  bool   empty()    const { return size() == 0; }
+  size_t capacity() const { return cap_; }
+
+  char at(size_t i) const { return text_[phys(i)]; }
+  uint8_t attrAt(size_t i) const { return attr_[phys(i)]; }
+
+  void setAttr(size_t pos, size_t n, uint8_t attr) {
+    for (size_t i = pos; i < pos + n && i < size(); i++) attr_[phys(i)] = attr;
+  }
+
+  bool insert(size_t pos, char c, uint8_t attr) { return insert(pos, &c, 1, attr); }
+
+  bool insert(size_t pos, const char* s, size_t n, uint8_t attr) {
+    if (pos > size()) pos = size();
+    if (!reserve(n)) return false;
+    moveGap(pos);
+    memcpy(text_ + gapStart_, s, n);
+    memset(attr_ + gapStart_, attr, n);
+    gapStart_ += n;
+    return true;
+  }
+
+  // Append n characters that each carry their own attribute
+  bool append(const char* s, const uint8_t* attrs, size_t n) {
+    if (!reserve(n)) return false;
+    moveGap(size());
+    memcpy(text_ + gapStart_, s, n);
+    memcpy(attr_ + gapStart_, attrs, n);
+    gapStart_ += n;
+    return true;
+  }
+
+  void erase(size_t pos, size_t n) {
+    if (pos >= size()) return;
+    if (n > size() - pos) n = size() - pos;
+    moveGap(pos);
+    gapEnd_ += n;
+  }
+
+  void clear() {
+    gapStart_ = 0;
+    gapEnd_   = cap_;
+  }
+
+  // Give back unused space, e.g. after loading a paragraph that won't be edited
+  void shrinkToFit(size_t slack = 0) {
+    const size_t n = size();
+    if (cap_ - n <= slack) return;
+    resize(n + slack);
+  }
+
+  // Pointer to characters [pos, pos + n), moving the gap out of the way if needed
+  const char* contiguous(size_t pos, size_t n) {
+    if (pos + n > gapStart_ && pos < gapStart_) moveGap(pos + n);
+    return text_ ? text_ + phys(pos) : "";
+  }
+
+  // Copy characters out without touching the gap, returns the count copied
+  size_t copy(char* dst, size_t pos, size_t n) const {
+    size_t i = 0;
+    for (; i < n && pos + i < size(); i++) dst[i] = at(pos + i);
+    return i;
+  }
+
+private:
+  size_t gapLen() const { return gapEnd_ - gapStart_; }
+  size_t phys(size_t i) const { return i < gapStart_ ? i : i + gapLen(); }
+
+  void moveGap(size_t pos) {
+    if (pos < gapStart_) {
+      const size_t n = gapStart_ - pos;
+      memmove(text_ + gapEnd_ - n, text_ + pos, n);
+      memmove(attr_ + gapEnd_ - n, attr_ + pos, n);
+      gapStart_ -= n;
+      gapEnd_   -= n;
+    } else if (pos > gapStart_) {
+      const size_t n = pos - gapStart_;
+      memmove(text_ + gapStart_, text_ + gapEnd_, n);
+      memmove(attr_ + gapStart_, attr_ + gapEnd_, n);
+      gapStart_ += n;
+      gapEnd_   += n;
+    }
+  }
+
+  bool reserve(size_t n) {
+    if (gapLen() >= n) return true;
+    const size_t need = size() + n;
+    if (need > GAPBUFFER_MAX_SIZE) return false;
+    size_t grow = cap_ * 2;
+    if (grow < need + GAPBUFFER_MIN_GROW) grow = need + GAPBUFFER_MIN_GROW;
+    if (grow > GAPBUFFER_MAX_SIZE) grow = GAPBUFFER_MAX_SIZE;
+    return resize(grow);
+  }
+
+  // Reallocate to newCap, leaving the gap at the end
+  bool resize(size_t newCap) {
+    const size_t n = size();
+    char* block = (char*)(arena_ ? arena_->alloc(newCap * 2) : malloc(newCap * 2));
+    if (!block && newCap) return false;
+    uint8_t* attrs = (uint8_t*)(block + newCap);
+    for (size_t i = 0; i < n; i++) {
+      block[i] = at(i);
+      attrs[i] = attrAt(i);
+    }
+    release();
+    text_     = block;
+    attr_     = attrs;
+    cap_      = newCap;
+    gapStart_ = n;
+    gapEnd_   = newCap;
+    return true;
+  }
+
+  void release() {
+    if (!text_) return;
+    if (arena_)
+      arena_->free(text_, cap_ * 2);
+    else
+      free(text_);
+  }
+
+  void take(GapBuffer& o) {
+    arena_ = o.arena_;
+    text_ = o.text_; attr_ = o.attr_; cap_ = o.cap_;
+    gapStart_ = o.gapStart_; gapEnd_ = o.gapEnd_;
+    o.text_ = nullptr; o.attr_ = nullptr;
+    o.cap_ = o.gapStart_ = o.gapEnd_ = 0;
+  }
+
+  DocArena* arena_    = nullptr;  // heap when null
+  char*    text_     = nullptr;  // [cap_] characters, then [cap_] attributes
+  uint8_t* attr_     = nullptr;
+  size_t   cap_      = 0;
+  size_t   gapStart_ = 0;
+  size_t   gapEnd_   = 0;
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <stdint.h>
+
+// ===================== INPUT EVENTS =====================
+/*
+InputEvent / InputPacer:
+@Description
+  The input loop blocks on one queue of input events instead of polling every 50 ms.
+  The keypad IRQ, the USB HID callback, the touch slider and the power button post
+  timestamped events to it; an event only wakes the loop, the data stays where it was
+  (the TCA8418 FIFO, the USB key ring, PWR_BTN_event), so a full queue loses nothing.
+
+  InputPacer decides how long the loop may block when nothing is posted:
+    - 0 while keys are still queued and the last pass took one (a burst of typing)
+    - INPUT_POLL_MS for INPUT_ACTIVE_MS after the last event: key repeat, the touch
+      timeout and what apps do right after a key see the old loop period
+    - INPUT_IDLE_MS when idle, for the clock, battery, USB and sleep timeout
+  An app with a timer or an animation asks for its next pass with wakeAt() on every
+  pass it needs one, like it reposts its OLED line.
+
+  Usage:
+    InputPacer pacer;
+    for (;;) {
+      InputEvent e;
+      if (receive(e, pacer.waitMs(millis()))) pacer.seen(e.ms);
+      pacer.beginPass(millis());
+      processKB();                  // apps may call pacer.wakeAt()
+      pacer.endPass(keysWaiting);
+    }
+*/
+#define INPUT_QUEUE_LEN     16    // events waiting for the loop, more only means it's awake
+#define INPUT_POLL_MS       50    // loop period while input is active
+#define INPUT_ACTIVE_MS     2000  // input stays active this long after the last event
+#define INPUT_IDLE_MS       1000  // loop period when idle
+#define INPUT_TOUCH_POLL_MS 250   // touch slider sampling while untouched, it has no IRQ line
+
+enum InputSource : uint8_t {
+  INPUT_TICK,     // nothing posted, a pass the pacer asked for
+  INPUT_KEYPAD,   // TCA8418 interrupt
+  INPUT_USB_KEY,  // USB HID key pressed or released
+  INPUT_TOUCH,    // touch slider position changed
+  INPUT_PWR_BTN,  // power button interrupt
+};
+
+struct InputEvent {
+  uint8_t  source = INPUT_TICK;
+  uint8_t  code   = 0;  // USB_KEY: HID key code, TOUCH: pad
+  uint32_t ms     = 0;  // millis() when posted
+};
+
+// Input loop only
+class InputPacer {
+public:
+  // An event came in at ms
+  void seen(uint32_t ms) {
+    lastEvent_ = ms;
+    active_    = true;
+  }
+
+  // The next pass is due no later than at. The earliest request wins until it's due
+  void wakeAt(uint32_t at) {
+    if (!wake_ || (int32_t)(at - wakeAt_) < 0) wakeAt_ = at;
+    wake_ = true;
+  }
+
+  // Milliseconds the loop may block waiting for an event
+  uint32_t waitMs(uint32_t now) const {
+    if (burst_) return 0;
+    const bool active = active_ && now - lastEvent_ < INPUT_ACTIVE_MS;
+    uint32_t at = lastPass_ + (active ? INPUT_POLL_MS : INPUT_IDLE_MS);
+    if (wake_ && (int32_t)(wakeAt_ - at) < 0) at = wakeAt_;
+    return ((int32_t)(at - now) > 0) ? at - now : 0;
+  }
+
+  // A pass starts at now, wake requests that are due are served by it
+  void beginPass(uint32_t now) {
+    lastPass_ = now;
+    if (wake_ && (int32_t)(now - wakeAt_) >= 0) wake_ = false;
+  }
+
+  // A pass ended. keysWaiting: the keyboard has more and the pass took one
+  void endPass(bool keysWaiting) { burst_ = keysWaiting; }
+
+  bool active(uint32_t now) const { return active_ && now - lastEvent_ < INPUT_ACTIVE_MS; }
+
+private:
+  uint32_t lastEvent_ = 0;
+  uint32_t lastPass_  = 0;
+  uint32_t wakeAt_    = 0;
+  bool     active_    = false;
+  bool     wake_      = false;
+  bool     burst_     = false;
+};
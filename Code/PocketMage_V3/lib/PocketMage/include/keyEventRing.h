@@ -0,0 +1,78 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// ===================== KEY EVENT RING =====================
+/*
+KeyEventRing:
+@Description
+  Bounded single-producer / single-consumer queue of key events, from the USB HID
+  callback task to the input loop. Push and pop are O(1) and never lock or wait: each
+  side owns one index and only reads the other's (acquire / release), so a slot is
+  never read before it's written nor reused before it's read.
+
+  Events keep their order. A full ring drops the new event and counts it, it never
+  overwrites one that wasn't read. highWater() is the most events that were waiting at
+  once, to size N against how slowly the loop drains it.
+
+  Usage:
+    KeyEventRing<KB_USB_EVENTS> ring;
+    // HID callback task
+    ring.push({keyCode, modifiers, true, millis()});
+    // input loop
+    KeyEvent e;
+    while (ring.pop(e)) if (e.pressed) handle(e);
+*/
+#define KB_USB_EVENTS 128  // USB key events waiting for the loop, presses and releases
+
+struct KeyEvent {
+  uint8_t  keyCode   = 0;      // HID usage id
+  uint8_t  modifiers = 0;      // HID modifier bits (ctrl, shift, alt, gui; left and right)
+  bool     pressed   = false;  // false: released
+  uint32_t ms        = 0;      // millis() when the report came in
+};
+
+template<uint32_t N>
+class KeyEventRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+  // Producer only. False (and counted) when full
+  bool push(const KeyEvent& e) {
+    const uint32_t in = in_.load(std::memory_order_relaxed);
+    const uint32_t waiting = in - out_.load(std::memory_order_acquire);
+    if (waiting >= N) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    events_[in & (N - 1)] = e;
+    in_.store(in + 1, std::memory_order_release);
+    if (waiting + 1 > highWater_.load(std::memory_order_relaxed))
+      highWater_.store(waiting + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Consumer only. False when empty
+  bool pop(KeyEvent& e) {
+    const uint32_t out = out_.load(std::memory_order_relaxed);
+    if (in_.load(std::memory_order_acquire) == out) return false;
+    e = events_[out & (N - 1)];
+    out_.store(out + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Either side, a snapshot
+  uint32_t size() const {
+    return in_.load(std::memory_order_acquire) - out_.load(std::memory_order_acquire);
+  }
+  bool     empty()     const { return size() == 0; }
+  uint32_t dropped()   const { return dropped_.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+
+private:
+  KeyEvent              events_[N];
+  std::atomic<uint32_t> in_{0};   // written by the producer only
+  std::atomic<uint32_t> out_{0};  // written by the consumer only
+  std::atomic<uint32_t> dropped_{0};
+  std::atomic<uint32_t> highWater_{0};
+};
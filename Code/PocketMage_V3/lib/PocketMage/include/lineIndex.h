@@ -0,0 +1,120 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// ===================== LINE INDEX =====================
+/*
+LineIndex:
+@Description
+  Maps global display line numbers to the block (paragraph) that owns them without
+  storing an index in every line. Keeps a line count per block in a Fenwick tree, so
+  changing one block's count, appending a block, finding a block's first line and
+  finding the block that holds a line are all O(log n).
+
+  Inserting or erasing in the middle rebuilds the tree in O(n), which is only a pass
+  over the counts (no text is touched) and cheaper than the std::vector insert the
+  caller does on its own blocks anyway.
+
+  Usage:
+    LineIndex idx;
+    idx.rebuild(n, [&](size_t i) { return (uint16_t)blocks[i].lines.size(); });
+    idx.set(3, 5);                    // block 3 now wraps to 5 lines
+    uint32_t first = idx.firstLine(3);
+    size_t block   = idx.blockAt(42); // size() if past the end
+*/
+
+class LineIndex {
+public:
+  size_t   size()  const { return counts_.size(); }
+  uint32_t total() const { return prefix(counts_.size()); }
+  uint16_t count(size_t block) const { return block < counts_.size() ? counts_[block] : 0; }
+
+  void clear() {
+    counts_.clear();
+    tree_.assign(1, 0);
+  }
+
+  // Rebuild from scratch, countOf(i) returns the line count of block i
+  template <typename F>
+  void rebuild(size_t n, F countOf) {
+    counts_.resize(n);
+    for (size_t i = 0; i < n; i++) counts_[i] = countOf(i);
+    build();
+  }
+
+  // Change the line count of one block
+  void set(size_t block, uint16_t lines) {
+    if (block >= counts_.size()) return;
+    const int32_t delta = (int32_t)lines - (int32_t)counts_[block];
+    if (delta == 0) return;
+    counts_[block] = lines;
+    for (size_t i = block + 1; i < tree_.size(); i += lowbit(i)) tree_[i] += delta;
+  }
+
+  void push_back(uint16_t lines) {
+    counts_.push_back(lines);
+    const size_t i = counts_.size();
+    // node i covers blocks (i - lowbit(i), i]
+    tree_.push_back(lines + prefix(i - 1) - prefix(i - lowbit(i)));
+  }
+
+  void insert(size_t block, uint16_t lines) {
+    if (block >= counts_.size()) {
+      push_back(lines);
+      return;
+    }
+    counts_.insert(counts_.begin() + block, lines);
+    build();
+  }
+
+  void erase(size_t block) {
+    if (block >= counts_.size()) return;
+    counts_.erase(counts_.begin() + block);
+    build();
+  }
+
+  // Global index of the first line of block (total() for block == size())
+  uint32_t firstLine(size_t block) const {
+    return prefix(block < counts_.size() ? block : counts_.size());
+  }
+
+  // Block holding global line, blocks with no lines are never returned
+  size_t blockAt(uint32_t line) const {
+    const size_t n = counts_.size();
+    size_t step = 1;
+    while (step * 2 <= n) step *= 2;
+
+    size_t pos = 0;
+    for (; step > 0; step /= 2) {
+      if (pos + step <= n && tree_[pos + step] <= line) {
+        pos += step;
+        line -= tree_[pos];
+      }
+    }
+    return pos;
+  }
+
+private:
+  static size_t lowbit(size_t i) { return i & (~i + 1); }
+
+  // Sum of the first n block counts
+  uint32_t prefix(size_t n) const {
+    uint32_t sum = 0;
+    for (size_t i = n; i > 0; i -= lowbit(i)) sum += tree_[i];
+    return sum;
+  }
+
+  void build() {
+    const size_t n = counts_.size();
+    tree_.assign(n + 1, 0);
+    for (size_t i = 1; i <= n; i++) {
+      tree_[i] += counts_[i - 1];
+      const size_t parent = i + lowbit(i);
+      if (parent <= n) tree_[parent] += tree_[i];
+    }
+  }
+
+  std::vector<uint16_t> counts_;   // lines per block
+  std::vector<uint32_t> tree_{0};  // 1-based Fenwick tree over counts_
+};
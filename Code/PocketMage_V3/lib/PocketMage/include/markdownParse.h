@@ -0,0 +1,130 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ===================== MARKDOWN PARSE =====================
+/*
+MarkdownParse:
+@Description
+  The subset of markdown TXT reads, parsed straight from a char span without
+  allocating. classifyMarkdownLine() picks the block style from a small prefix table,
+  parseMarkdownInline() strips emphasis markers and reports text runs and words in
+  one pass, so both are linear in the line length whatever the line contains.
+
+  Block styles: '1' '2' '3' headings, '>' quote, '-' bullet, 'L' ordered list,
+  'C' code, 'H' rule, 'B' blank, 'T' text.
+  Emphasis: "***" toggles bold+italic, "**" bold, "*" italic.
+
+  Usage:
+    MdBlock b = classifyMarkdownLine(line, len);
+    parseMarkdownInline(line + b.start, b.len,
+      [&](const char* s, size_t n, uint8_t attr) { text.append(s, n, attr); },
+      [&](size_t start, size_t n, uint8_t attr) { words.push_back({start, n, attr}); });
+*/
+#define MD_BOLD   0x01
+#define MD_ITALIC 0x02
+
+struct MdBlock {
+  char   style = 'T';
+  size_t start = 0;  // content span inside the line
+  size_t len   = 0;
+};
+
+struct MdPrefix {
+  const char* prefix;
+  uint8_t     len;
+  char        style;
+};
+
+// Checked in order, longer heading prefixes first
+static const MdPrefix MD_PREFIXES[] = {
+  {"### ", 4, '3'}, {"## ", 3, '2'}, {"# ", 2, '1'}, {"> ", 2, '>'}, {"- ", 2, '-'},
+};
+
+// Same set as isspace()/String::trim()
+inline bool mdIsSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+inline MdBlock classifyMarkdownLine(const char* s, size_t n) {
+  size_t b = 0, e = n;
+  while (b < e && mdIsSpace(s[b])) b++;
+  while (e > b && mdIsSpace(s[e - 1])) e--;
+  s += b;
+  n = e - b;
+
+  MdBlock out;
+  out.start = b;
+  out.len   = n;
+  if (n == 0) {
+    out.style = 'B';
+    return out;
+  }
+
+  for (const MdPrefix& p : MD_PREFIXES) {
+    if (n >= p.len && memcmp(s, p.prefix, p.len) == 0) {
+      out.style = p.style;
+      out.start += p.len;
+      out.len   -= p.len;
+      return out;
+    }
+  }
+
+  if (n == 3 && memcmp(s, "---", 3) == 0) {
+    out.style = 'H';
+  } else if (n >= 3 && memcmp(s, "```", 3) == 0) {
+    // Only the opening fence is dropped, like files saved by TXT expect
+    out.style = 'C';
+    out.start += 3;
+    out.len   -= 3;
+  } else if (s[0] == '`' && s[n - 1] == '`') {
+    out.style = 'C';
+    if (n >= 2) {
+      out.start += 1;
+      out.len   -= 2;
+    }
+  } else if (n > 2 && s[0] >= '0' && s[0] <= '9' && s[1] == '.' && s[2] == ' ') {
+    out.style = 'L';
+    out.start += 3;
+    out.len   -= 3;
+  }
+  return out;
+}
+
+// Strip emphasis markers from s. onText(ptr, len, attr) gets each run of plain text,
+// onWord(start, len, attr) each word (split at spaces and attribute changes) with its
+// position in the stripped text. Returns the stripped length.
+template <typename TextFn, typename WordFn>
+size_t parseMarkdownInline(const char* s, size_t n, TextFn&& onText, WordFn&& onWord) {
+  uint8_t attr = 0;
+  size_t out = 0;           // position in the stripped text
+  size_t wordStart = 0;
+  uint8_t wordAttr = 0;
+  bool inWord = false;
+
+  size_t i = 0;
+  while (i < n) {
+    if (s[i] == '*') {
+      size_t run = 1;
+      while (run < 3 && i + run < n && s[i + run] == '*') run++;
+      attr ^= (run == 3) ? (MD_BOLD | MD_ITALIC) : (run == 2) ? MD_BOLD : MD_ITALIC;
+      i += run;
+      continue;
+    }
+
+    const size_t runStart = i;
+    for (; i < n && s[i] != '*'; i++, out++) {
+      if (s[i] == ' ') {
+        if (inWord) onWord(wordStart, out - wordStart, wordAttr);
+        inWord = false;
+      } else if (!inWord || wordAttr != attr) {
+        if (inWord) onWord(wordStart, out - wordStart, wordAttr);
+        inWord    = true;
+        wordStart = out;
+        wordAttr  = attr;
+      }
+    }
+    onText(s + runStart, i - runStart, attr);
+  }
+  if (inWord) onWord(wordStart, out - wordStart, wordAttr);
+  return out;
+}
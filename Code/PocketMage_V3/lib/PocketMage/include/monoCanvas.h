@@ -0,0 +1,331 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <textMetrics.h>
+
+#ifndef GxEPD_BLACK
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#endif
+
+// ===================== MONO CANVAS =====================
+/*
+MonoCanvas:
+@Description
+  In-memory 320x240 1-bit screen for native builds. It has the same drawing calls as
+  the GxEPD2_BW display (Adafruit_GFX primitives, GFX font text, full and partial
+  windows, firstPage()/nextPage(), display(), displayWindow()), so drawing code can be
+  run on a PC, compared with golden images and timed.
+
+  A second bitmap stands for what the panel shows. Every refresh copies the refreshed
+  area over and records how many pixels it changed, which is what ghosting and refresh
+  time depend on. Partial windows are widened to multiples of 8 in y like on the
+  rotated panel, and drawing is clipped to them.
+
+  drawPixel(), fillScreen() and setRotation() are virtual like in Adafruit_GFX, every
+  primitive goes through drawPixel(), so test/native/GxEPD2_BW.h can put the real
+  DisplayT on top of it. The screen stays 320x240, the rotation the firmware uses.
+
+  Images are saved and loaded as binary PBM (P4), which any image viewer opens.
+
+  Usage:
+    MonoCanvas display;
+    display.setFont(&FreeSerif9pt8b);
+    display.setCursor(4, 20);
+    display.print("hello");
+    display.display(true);
+    display.refreshes().back().changed;  // pixels the refresh toggled
+    display.writePBM("screen.pbm");
+*/
+
+struct CanvasRefresh {
+  int16_t  x, y, w, h;
+  bool     full;     // full update rather than a partial one
+  uint32_t changed;  // pixels that differ from what the panel showed
+};
+
+class MonoCanvas {
+public:
+  static const int16_t WIDTH  = 320;
+  static const int16_t HEIGHT = 240;
+  static const size_t  ROW_BYTES = WIDTH / 8;
+
+  MonoCanvas() : buffer_(ROW_BYTES * HEIGHT, 0), panel_(ROW_BYTES * HEIGHT, 0) {}
+  virtual ~MonoCanvas() {}
+
+  int16_t width()  const { return WIDTH; }
+  int16_t height() const { return HEIGHT; }
+
+  // ---- panel ----
+  void init(uint32_t = 0) {}
+  virtual void setRotation(uint8_t r) { rotation_ = r & 3; }
+  uint8_t getRotation() const { return rotation_; }
+  void hibernate() {}
+  void powerOff() {}
+
+  void setFullWindow() {
+    partial_ = false;
+    winX_ = 0; winY_ = 0; winW_ = WIDTH; winH_ = HEIGHT;
+  }
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    partial_ = true;
+    alignWindow(x, y, w, h);
+    winX_ = x; winY_ = y; winW_ = w; winH_ = h;
+  }
+  // paged drawing starts on a white window, there is only one page
+  void firstPage() { fillScreen(GxEPD_WHITE); }
+  bool nextPage() {
+    push(winX_, winY_, winW_, winH_, !partial_);
+    return false;
+  }
+  void display(bool partialUpdate = false) { push(0, 0, WIDTH, HEIGHT, !partialUpdate); }
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    alignWindow(x, y, w, h);
+    push(x, y, w, h, false);
+  }
+
+  // ---- drawing ----
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < winX_ || y < winY_ || x >= winX_ + winW_ || y >= winY_ + winH_) return;
+    uint8_t& b = buffer_[y * ROW_BYTES + x / 8];
+    const uint8_t bit = 0x80 >> (x & 7);
+    if (color == GxEPD_WHITE) b &= ~bit;
+    else b |= bit;
+  }
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, WIDTH, HEIGHT, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t yy = y; yy < y + h; yy++) drawFastHLine(x, yy, w, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t xx = x; xx < x + w; xx++) drawPixel(xx, y, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t yy = y; yy < y + h; yy++) drawPixel(x, yy, color);
+  }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+  // Bresenham, same pixels as Adafruit_GFX::writeLine()
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    const bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) { swap(x0, y0); swap(x1, y1); }
+    if (x0 > x1) { swap(x0, x1); swap(y0, y1); }
+    const int16_t dx = x1 - x0, dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    const int16_t ystep = (y0 < y1) ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) drawPixel(y0, x0, color);
+      else drawPixel(x0, y0, color);
+      err -= dy;
+      if (err < 0) { y0 += ystep; err += dx; }
+    }
+  }
+  // Midpoint circles, same pixels as Adafruit_GFX
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+    int16_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r, px = x, py = y;
+    while (x < y) {
+      if (f >= 0) { y--; ddy += 2; f += ddy; }
+      x++; ddx += 2; f += ddx;
+      if (x < y + 1) {
+        drawFastVLine(x0 + x, y0 - y, 2 * y + 1, color);
+        drawFastVLine(x0 - x, y0 - y, 2 * y + 1, color);
+      }
+      if (y != py) {
+        drawFastVLine(x0 + py, y0 - px, 2 * px + 1, color);
+        drawFastVLine(x0 - py, y0 - px, 2 * px + 1, color);
+        py = y;
+      }
+      px = x;
+    }
+  }
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    const int16_t maxR = ((w < h) ? w : h) / 2;
+    if (r > maxR) r = maxR;
+    drawFastHLine(x + r, y, w - 2 * r, color);
+    drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+    drawFastVLine(x, y + r, h - 2 * r, color);
+    drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+    // corners: 1 top left, 2 top right, 4 bottom right, 8 bottom left
+    const int16_t cx[4] = {(int16_t)(x + r), (int16_t)(x + w - r - 1), (int16_t)(x + w - r - 1), (int16_t)(x + r)};
+    const int16_t cy[4] = {(int16_t)(y + r), (int16_t)(y + r), (int16_t)(y + h - r - 1), (int16_t)(y + h - r - 1)};
+    int16_t f = 1 - r, ddx = 1, ddy = -2 * r, xx = 0, yy = r;
+    while (xx < yy) {
+      if (f >= 0) { yy--; ddy += 2; f += ddy; }
+      xx++; ddx += 2; f += ddx;
+      drawPixel(cx[0] - yy, cy[0] - xx, color); drawPixel(cx[0] - xx, cy[0] - yy, color);
+      drawPixel(cx[1] + xx, cy[1] - yy, color); drawPixel(cx[1] + yy, cy[1] - xx, color);
+      drawPixel(cx[2] + xx, cy[2] + yy, color); drawPixel(cx[2] + yy, cy[2] + xx, color);
+      drawPixel(cx[3] - yy, cy[3] + xx, color); drawPixel(cx[3] - xx, cy[3] + yy, color);
+    }
+  }
+  // 1 bits drawn in color, 0 bits left alone
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t color) {
+    const int16_t byteWidth = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++)
+      for (int16_t i = 0; i < w; i++)
+        if (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))) drawPixel(x + i, y + j, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg) {
+    const int16_t byteWidth = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++)
+      for (int16_t i = 0; i < w; i++)
+        drawPixel(x + i, y + j,
+                  (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))) ? color : bg);
+  }
+
+  // ---- text, GFX fonts only ----
+  void setFont(const GFXfont* font) { font_ = font; }
+  void setCursor(int16_t x, int16_t y) { cursorX_ = x; cursorY_ = y; }
+  int16_t getCursorX() const { return cursorX_; }
+  int16_t getCursorY() const { return cursorY_; }
+  void setTextColor(uint16_t color) { textColor_ = color; }
+  void setTextColor(uint16_t color, uint16_t) { textColor_ = color; }  // GFX fonts draw no bg
+  void setTextWrap(bool wrap) { wrap_ = wrap; }
+
+  size_t write(uint8_t c) {
+    if (!font_) return 1;
+    if (c == '\n') {
+      cursorX_ = 0;
+      cursorY_ += font_->yAdvance;
+    } else if (c != '\r' && c >= font_->first && c <= font_->last) {
+      const GFXglyph& g = font_->glyph[c - font_->first];
+      if (g.width > 0 && g.height > 0) {
+        if (wrap_ && cursorX_ + g.xOffset + g.width > WIDTH) {
+          cursorX_ = 0;
+          cursorY_ += font_->yAdvance;
+        }
+        drawGlyph(cursorX_, cursorY_, g);
+      }
+      cursorX_ += g.xAdvance;
+    }
+    return 1;
+  }
+  size_t write(const uint8_t* s, size_t n) {
+    for (size_t i = 0; i < n; i++) write(s[i]);
+    return n;
+  }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const std::string& s) { return write((const uint8_t*)s.data(), s.size()); }
+
+  // Same box as Adafruit_GFX::getTextBounds()
+  void getTextBounds(const char* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+                     uint16_t* w, uint16_t* h) const {
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    *x1 = x; *y1 = y; *w = *h = 0;
+    for (; font_ && *s; s++) {
+      const uint8_t c = (uint8_t)*s;
+      if (c == '\n') { x = 0; y += font_->yAdvance; continue; }
+      if (c == '\r' || c < font_->first || c > font_->last) continue;
+      const GFXglyph& g = font_->glyph[c - font_->first];
+      if (wrap_ && x + g.xOffset + g.width > WIDTH) { x = 0; y += font_->yAdvance; }
+      const int16_t gx1 = x + g.xOffset, gy1 = y + g.yOffset;
+      const int16_t gx2 = gx1 + g.width - 1, gy2 = gy1 + g.height - 1;
+      if (gx1 < minx) minx = gx1;
+      if (gy1 < miny) miny = gy1;
+      if (gx2 > maxx) maxx = gx2;
+      if (gy2 > maxy) maxy = gy2;
+      x += g.xAdvance;
+    }
+    if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+    if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+  }
+
+  // ---- inspection ----
+  bool pixel(int16_t x, int16_t y) const {  // true: black
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return false;
+    return buffer_[y * ROW_BYTES + x / 8] & (0x80 >> (x & 7));
+  }
+  uint32_t blackPixels() const {
+    uint32_t n = 0;
+    for (uint8_t b : buffer_) n += __builtin_popcount(b);
+    return n;
+  }
+  const std::vector<uint8_t>&       bits()      const { return buffer_; }
+  const std::vector<CanvasRefresh>& refreshes() const { return refreshes_; }
+  void clearRefreshes() { refreshes_.clear(); }
+
+  // ---- PBM ----
+  bool writePBM(const char* path) const {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P4\n%d %d\n", WIDTH, HEIGHT);
+    const bool ok = fwrite(buffer_.data(), 1, buffer_.size(), f) == buffer_.size();
+    return fclose(f) == 0 && ok;
+  }
+  // Only reads 320x240 images, as written by writePBM()
+  bool readPBM(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    int w = 0, h = 0;
+    const bool header = fscanf(f, "P4 %d %d", &w, &h) == 2 && fgetc(f) != EOF;
+    const bool ok = header && w == WIDTH && h == HEIGHT &&
+                    fread(buffer_.data(), 1, buffer_.size(), f) == buffer_.size();
+    fclose(f);
+    return ok;
+  }
+
+private:
+  static void swap(int16_t& a, int16_t& b) { const int16_t t = a; a = b; b = t; }
+
+  static void alignWindow(int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+    int16_t right = x + w, bottom = y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (right > WIDTH) right = WIDTH;
+    if (bottom > HEIGHT) bottom = HEIGHT;
+    y -= y % 8;
+    if (bottom % 8) bottom += 8 - bottom % 8;
+    if (bottom > HEIGHT) bottom = HEIGHT;
+    w = right > x ? right - x : 0;
+    h = bottom > y ? bottom - y : 0;
+  }
+
+  // Same pixels as Adafruit_GFX::drawChar() for GFX fonts at text size 1
+  void drawGlyph(int16_t x, int16_t y, const GFXglyph& g) {
+    const uint8_t* bitmap = font_->bitmap + g.bitmapOffset;
+    uint8_t bits = 0, bit = 0;
+    for (uint8_t yy = 0; yy < g.height; yy++) {
+      for (uint8_t xx = 0; xx < g.width; xx++) {
+        if (!(bit++ & 7)) bits = *bitmap++;
+        if (bits & 0x80) drawPixel(x + g.xOffset + xx, y + g.yOffset + yy, textColor_);
+        bits <<= 1;
+      }
+    }
+  }
+
+  void push(int16_t x, int16_t y, int16_t w, int16_t h, bool full) {
+    uint32_t changed = 0;
+    for (int16_t yy = y; yy < y + h; yy++) {
+      for (int16_t xx = x; xx < x + w; xx++) {
+        const size_t i = yy * ROW_BYTES + xx / 8;
+        const uint8_t bit = 0x80 >> (xx & 7);
+        if ((buffer_[i] ^ panel_[i]) & bit) {
+          panel_[i] ^= bit;
+          changed++;
+        }
+      }
+    }
+    refreshes_.push_back({x, y, w, h, full, changed});
+  }
+
+  std::vector<uint8_t>       buffer_;  // what is drawn, 1 = black
+  std::vector<uint8_t>       panel_;   // what the panel shows
+  std::vector<CanvasRefresh> refreshes_;
+  uint8_t        rotation_ = 0;
+  bool           partial_ = false;
+  int16_t        winX_ = 0, winY_ = 0, winW_ = WIDTH, winH_ = HEIGHT;
+  const GFXfont* font_ = nullptr;
+  int16_t        cursorX_ = 0, cursorY_ = 0;
+  uint16_t       textColor_ = GxEPD_BLACK;
+  bool           wrap_ = true;
+};
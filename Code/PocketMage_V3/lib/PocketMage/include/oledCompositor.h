@@ -0,0 +1,223 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// ===================== OLED COMPOSITOR =====================
+/*
+OledMailbox / OledScene:
+@Description
+  State for the OLED compositor task, the only task that draws the standard OLED screens
+  and sends to the panel. Apps post what they want shown, the compositor keeps the
+  latest of each layer and draws a frame when something changed, at most OLED_MAX_FPS
+  times a second.
+
+  Layers: one base layer (the input line with its progress bar, a centered word, a
+  progress bar or a frame the app drew itself) and a toast on top. A toast stays up for
+  its time without anyone waiting on it, then the base layer shows again. A changed base
+  layer dismisses a toast that has been up for OLED_TOAST_MIN_MS, so typing shows
+  again right away. The info bar clock and the line end warning are redrawn on their
+  own.
+
+  OledMailbox is a bounded multi-producer queue (Vyukov): any task posts without locks
+  or waiting, only the compositor takes. A full mailbox drops the post and counts it,
+  the base layer is reposted every pass anyway.
+
+  Usage:
+    OledMailbox<OledPost, OLED_MAILBOX> mailbox;
+    OledScene scene;
+    // any task
+    mailbox.post(linePost);
+    // compositor
+    while (mailbox.take(p)) scene.apply(p, millis());
+    if (scene.waitMs(millis(), 1000 / OLED_MAX_FPS) == 0) {
+      draw(scene.top(millis()));
+      scene.drawn(millis());
+    }
+*/
+#define OLED_TEXT_LEN     96    // line / word chars kept, longer lines keep their end
+#define OLED_LABEL_LEN    40    // bottom message or progress caption
+#define OLED_MAILBOX      8     // posts between two compositor passes
+#define OLED_REFRESH_MS   1000  // info bar clock and battery redraw
+#define OLED_BLINK_MS     400   // line end warning half period
+#define OLED_TOAST_MIN_MS 750   // a toast is up at least this long before typing hides it
+#define OLED_FOREVER      0xFFFFFFFFu
+
+enum OledLayer : uint8_t {
+  OLED_NONE,      // nothing posted yet, or: redraw what's there
+  OLED_LINE,      // oledLine()
+  OLED_WORD,      // oledWord()
+  OLED_PROGRESS,  // progressBar()
+  OLED_CUSTOM,    // a frame the app drew with beginFrame()/commit()
+  OLED_TOAST,     // toast()
+};
+
+enum OledFlags : uint8_t {
+  OLED_BAR   = 1 << 0,  // LINE: progress bar
+  OLED_WARN  = 1 << 1,  // LINE: close to the end of the e-ink line, blink
+  OLED_LARGE = 1 << 2,  // WORD/TOAST: allow the large font
+  OLED_INFO  = 1 << 3,  // WORD/TOAST: info bar
+};
+
+struct OledPost {
+  uint8_t  layer = OLED_NONE;
+  uint8_t  flags = 0;
+  uint8_t  kb    = 0;    // keyboard state when posted, the info bar shows it
+  uint16_t value = 0;    // LINE: progress bar in OLED pixels, PROGRESS: percent
+  uint32_t ms    = 0;    // TOAST: how long it stays up
+  char     text[OLED_TEXT_LEN]   = {};
+  char     label[OLED_LABEL_LEN] = {};  // LINE: bottom message, PROGRESS: caption
+
+  // Copies s into text, keeping its end if it doesn't fit (a long line is drawn
+  // right aligned, only the end is on screen)
+  void setText(const char* s, bool keepEnd = false) { copy(text, sizeof(text), s, keepEnd); }
+  void setLabel(const char* s)                      { copy(label, sizeof(label), s, false); }
+
+  bool sameAs(const OledPost& o) const {
+    return layer == o.layer && flags == o.flags && kb == o.kb && value == o.value &&
+           strcmp(text, o.text) == 0 && strcmp(label, o.label) == 0;
+  }
+
+private:
+  static void copy(char* dst, size_t n, const char* s, bool keepEnd) {
+    size_t len = s ? strlen(s) : 0;
+    if (len >= n) {
+      if (keepEnd) s += len - (n - 1);
+      len = n - 1;
+    }
+    if (len) memcpy(dst, s, len);
+    dst[len] = '\0';
+  }
+};
+
+template<class T, uint32_t N>
+class OledMailbox {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+  OledMailbox() {
+    for (uint32_t i = 0; i < N; i++) cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  // Any task. False (and counted) when the mailbox is full
+  bool post(const T& v) {
+    uint32_t pos = in_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& c = cells_[pos & (N - 1)];
+      const int32_t dif = (int32_t)(c.seq.load(std::memory_order_acquire) - pos);
+      if (dif == 0) {
+        if (in_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          c.value = v;
+          c.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = in_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Compositor only. False when empty, or the oldest post is still being written
+  bool take(T& v) {
+    Cell& c = cells_[out_ & (N - 1)];
+    if (c.seq.load(std::memory_order_acquire) != out_ + 1) return false;
+    v = c.value;
+    c.seq.store(out_ + N, std::memory_order_release);
+    out_++;
+    return true;
+  }
+
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    T                     value;
+  };
+  Cell                  cells_[N];
+  std::atomic<uint32_t> in_{0};
+  uint32_t              out_ = 0;
+  std::atomic<uint32_t> dropped_{0};
+};
+
+// What the compositor shows, and when its next frame is due. Compositor task only
+class OledScene {
+public:
+  void apply(const OledPost& p, uint32_t now) {
+    if (p.layer == OLED_NONE) {
+      dirty_ = true;
+      return;
+    }
+    if (p.layer == OLED_TOAST) {
+      toast_      = p;
+      toastSince_ = now;
+      toastUp_    = p.ms > 0;
+      dirty_      = true;
+      return;
+    }
+    // custom frames are only posted when they changed
+    if (p.layer != OLED_CUSTOM && p.sameAs(base_)) return;
+    base_  = p;
+    dirty_ = true;
+    if (toastUp_ && now - toastSince_ >= OLED_TOAST_MIN_MS) toastUp_ = false;
+  }
+
+  // The toast until it expires, the base layer after
+  const OledPost& top(uint32_t now) const { return toastShown(now) ? toast_ : base_; }
+
+  // Milliseconds until the next frame is due, 0 to draw now, OLED_FOREVER when nothing
+  // will change without a post. Frames are at least frameMs apart
+  uint32_t waitMs(uint32_t now, uint32_t frameMs) const {
+    uint32_t wait = OLED_FOREVER;
+    auto until = [&](uint32_t at) {
+      const uint32_t ms = ((int32_t)(at - now) > 0) ? at - now : 0;
+      if (ms < wait) wait = ms;
+    };
+    const OledPost& p = top(now);
+
+    if (dirty_)                                   until(now);
+    if (toastShown(now))                          until(toastSince_ + toast_.ms);
+    if (!drawn_)                                  return wait;
+    if (toastUp_ && !toastShown(now))             until(now);  // expired, show the base again
+    if (showsInfoBar(p))                          until(last_ + OLED_REFRESH_MS);
+    if (p.layer == OLED_LINE && (p.flags & OLED_WARN))
+      until((now / OLED_BLINK_MS + 1) * OLED_BLINK_MS);
+
+    if (wait == OLED_FOREVER) return wait;
+    const uint32_t paced = last_ + frameMs - now;
+    return ((int32_t)paced > (int32_t)wait) ? paced : wait;
+  }
+
+  // A frame of top(now) went out
+  void drawn(uint32_t now) {
+    if (toastUp_ && !toastShown(now)) toastUp_ = false;
+    last_  = now;
+    drawn_ = true;
+    dirty_ = false;
+  }
+
+  const OledPost& base() const { return base_; }
+
+  static bool showsInfoBar(const OledPost& p) {
+    switch (p.layer) {
+      case OLED_LINE:  return p.label[0] == '\0';
+      case OLED_WORD:
+      case OLED_TOAST: return p.flags & OLED_INFO;
+      default:         return false;
+    }
+  }
+
+private:
+  bool toastShown(uint32_t now) const { return toastUp_ && now - toastSince_ < toast_.ms; }
+
+  OledPost base_;
+  OledPost toast_;
+  uint32_t toastSince_ = 0;
+  bool     toastUp_    = false;
+  bool     dirty_      = false;
+  bool     drawn_      = false;
+  uint32_t last_       = 0;
+};
@@ -11,6 +11,8 @@
 #include <GxEPD2_BW.h>
 #include <vector>
 #include <config.h> // for FULL_REFRESH_AFTER
+#include <refreshScheduler.h>
+#include <shadowFrame.h>
 #pragma region fonts
 // FONTS
 // 3x7
@@ -31,7 +33,75 @@
 
 // Type alias for readability
 using PanelT   = GxEPD2_310_GDEQ031T10;
-using DisplayT = GxEPD2_BW<PanelT, PanelT::HEIGHT>;
+
+// Held around anything that talks to the panel, refreshes run on their own task
+void einkLockPanel();
+void einkUnlockPanel();
+
+// GxEPD2 display that mirrors its buffer and what it pushed into a ShadowFrame, so
+// refresh() can tell what changed. Pushes wait for a refresh still running
+class ShadowedDisplay : public GxEPD2_BW<PanelT, PanelT::HEIGHT> {
+public:
+  using Base = GxEPD2_BW<PanelT, PanelT::HEIGHT>;
+  using Base::Base;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    Base::drawPixel(x, y, color);
+    shadow.drawPixel(x, y, color != GxEPD_WHITE);
+  }
+  void fillScreen(uint16_t color) override {
+    Base::fillScreen(color);
+    shadow.fill(color == GxEPD_BLACK);
+  }
+  void setRotation(uint8_t r) override {
+    Base::setRotation(r);
+    shadow.setRotation(getRotation());
+  }
+  void setFullWindow() {
+    Base::setFullWindow();
+    shadow.setFullWindow();
+  }
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    Base::setPartialWindow(x, y, w, h);
+    shadow.setPartialWindow(x, y, w, h);
+  }
+  void display(bool partial_update_mode = false) {
+    einkLockPanel();
+    Base::display(partial_update_mode);
+    shadow.pushAll();
+    einkUnlockPanel();
+  }
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    einkLockPanel();
+    Base::displayWindow(x, y, w, h);
+    shadow.pushRegion(x, y, w, h);
+    einkUnlockPanel();
+  }
+  bool nextPage() {
+    const bool partial = shadow.partialMode();
+    einkLockPanel();
+    const bool more = Base::nextPage();
+    if (!more) {
+      if (partial) shadow.pushWindow();
+      else         shadow.pushAll();
+    }
+    einkUnlockPanel();
+    return more;
+  }
+  void powerOff() {
+    einkLockPanel();
+    Base::powerOff();
+    einkUnlockPanel();
+  }
+  void hibernate() {
+    einkLockPanel();
+    Base::hibernate();
+    einkUnlockPanel();
+  }
+
+  ShadowFrame<PanelT::WIDTH, PanelT::HEIGHT> shadow;
+};
+using DisplayT = ShadowedDisplay;
 
 // E-ink display
 extern DisplayT display;
@@ -45,15 +115,24 @@ public:
 
   // Wire up external buffers/state used to read from globals
   void setLineSpacing(uint8_t lineSpacing)                      { lineSpacing_ = lineSpacing; };               // reference to lineSpacing (default 6)
-  void setFullRefreshAfter(uint8_t fullRefreshAfter)  { fullRefreshAfter_ = fullRefreshAfter; };               // reference to FULL_REFRESH_AFTER (default 5)
+  void setFullRefreshAfter(uint8_t fullRefreshAfter);                                                           // reference to FULL_REFRESH_AFTER (default 5)
   void setCurrentFont(const GFXfont* font){
   if (currentFont_ == font) return; 
     currentFont_ = font;
   };                       // reference to currentFont
   
   // Main display functions
-  void refresh();
-  void multiPassRefresh(int passes);
+  uint32_t refresh(RefreshHint hint = REFRESH_TEXT);     // returns before the panel is done
+  void requestRefresh(RefreshHint hint = REFRESH_TEXT);  // sent by serviceRefresh() once quiet
+  void serviceRefresh();
+  void wake();                                           // the e-ink task has work
+  void waitWork();                                       // e-ink task sleeps until then
+  void refreshWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  bool partialRefreshAllowed() const;
+  const RefreshScheduler& scheduler() const { return scheduler_; }
+  bool refreshBusy() const;
+  bool waitRefresh(uint32_t ticket = 0, uint32_t timeoutMs = 10000);  // 0: the latest one
+  uint32_t multiPassRefresh(int passes);
   void setFastFullRefresh(bool setting);
   void statusBar(const String& input, bool fullWindow=false);
   void drawStatusBar(const String& input);
@@ -76,9 +155,12 @@ public:
 private:
   DisplayT&             display_; // class reference to hardware display object
   bool                  forceSlowFullUpdate_  = false;
-  uint8_t               partialCounter_       = 0;
   const GFXfont*        currentFont_          = nullptr;
   uint8_t               fullRefreshAfter_     = FULL_REFRESH_AFTER;
+  RefreshScheduler      scheduler_;           // ghosting budget and queued refreshes
+  std::vector<DirtyRect> heldWindows_;        // window refreshes that came in while busy
+
+  bool pushWindows_(const std::vector<DirtyRect>& clips, bool wait);
 
   // font metrics
   uint8_t               lineSpacing_          = 6;
@@ -8,6 +8,7 @@
 #pragma once
 #include <Arduino.h>
 #include <Adafruit_TCA8418.h>
+#include <inputEvents.h>
 
 extern Adafruit_TCA8418 keypad;
 
@@ -28,10 +29,22 @@ public:
   void enableInterrupts()                             { keypad_.enableInterrupts(); }
   void flush()                                                   { keypad_.flush(); }
   void setTCA8418Event()                              {      TCA8418_event_ = true; }
+  // USB keyboard events lost to a full ring since boot
+  uint32_t usbDropped() const;
+
+  // Input events (see inputEvents.h)
+  void postInput(uint8_t source, uint8_t code = 0);         // any task
+  void IRAM_ATTR postInputFromISR(uint8_t source);          // interrupt handlers
+  bool waitInput();                       // input loop: blocks until an event or a due pass
+  // Input loop: the next pass is due in / at ms at the latest
+  void wakeIn(uint32_t ms)                                 { pacer_.wakeAt(millis() + ms); }
+  void wakeAt(uint32_t ms)                                             { pacer_.wakeAt(ms); }
 
 private:
   Adafruit_TCA8418      &keypad_; // class reference to hardware keypad object
   int                   kbState_        = 0;
+  InputPacer            pacer_;
+  bool                  tookKey_        = false;  // updateKeypress() took a key this pass
 
   volatile int*         prevTimeMillis_ = nullptr;
 };
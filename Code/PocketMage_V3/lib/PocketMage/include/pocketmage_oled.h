@@ -10,6 +10,8 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <vector>
+#include <tileShadow.h>
+#include <oledCompositor.h>
 #pragma region fonts
 #pragma endregion
 
@@ -17,6 +19,9 @@
 extern U8G2_SSD1326_ER_256X32_F_4W_HW_SPI u8g2;
 
 // ===================== OLED CLASS =====================
+// The compositor task (oledTask) draws and sends every frame. oledWord(), oledLine(),
+// toast() and progressBar() post to it and return right away; screens drawn with u8g2
+// directly go between beginFrame() and commit().
 class PocketmageOled {
 public:
   explicit PocketmageOled(U8G2 &u8) : u8g2_(u8) {}
@@ -25,17 +30,40 @@ public:
   // Main methods
   void oledWord(String word, bool allowLarge = false, bool showInfo = true);
   void oledLine(String line, bool doProgressBar = true, String bottomMsg = "");
+  // Message over the screen for ms milliseconds, without waiting for it. Typing takes it
+  // down after OLED_TOAST_MIN_MS, ms = 0 takes it down now
+  void toast(const String& msg, uint32_t ms = 2000, bool allowLarge = false);
+  void progressBar(uint8_t percent, const String& caption);
   void oledScroll();
   void infoBar();
   void setPowerSave(bool enable);
   bool getPowerSave() const                                   { return OLEDPowerSave_; }
+  // Clears the u8g2 buffer for a frame the app draws itself, the compositor waits
+  // until commit() hands it over. Every beginFrame() needs its commit()
+  void beginFrame();
+  void commit();
+  // OLED content unknown (reset, another writer), the next frame sends everything
+  void invalidate();
+
+  // Compositor task body, never returns
+  void compose();
 
 private:
   U8G2                  &u8g2_;        // class reference to hardware oled object
   volatile bool OLEDPowerSave_;
+  TileShadow<32, 4>     sent_;         // 256x32 buffer as last sent
+  OledMailbox<OledPost, OLED_MAILBOX> mailbox_;
+  OledScene             scene_;        // compositor task only
+  uint8_t               custom_[TileShadow<32, 4>::BYTES];  // last app drawn frame
+  volatile uint8_t      lastBase_ = OLED_NONE;
  
   // helpers
   uint16_t strWidth(const String& s) const;
+  void post(OledPost& p);
+  void drawWord(const char* word, bool allowLarge, bool showInfo);
+  void drawLine(const OledPost& p);
+  void drawProgress(const OledPost& p);
+  void send();
 };
 
 void setupOled();
@@ -34,8 +34,11 @@ void PocketMage_INIT();
 // ===================== GLOBAL TEXT HELPERS =====================
 String vectorToString();
 void stringToVector(String inputText);
+void addLine(const String& line, uint8_t brk);
+void clearLines();
 String removeChar(String str, char character);
 int stringToInt(String str);
 extern volatile bool newLineAdded;           // New line added in TXT
 extern std::vector<String> allLines;                // All lines in TXT
+extern std::vector<uint8_t> allLineBreaks;          // How each line ended, see wordWrap.h
 extern bool noTimeout;               // Disable timeout
\ No newline at end of file
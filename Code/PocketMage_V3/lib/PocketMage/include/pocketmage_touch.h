@@ -16,6 +16,7 @@ public:
   // Main methods
   void updateScrollFromTouch();
   bool updateScroll(int maxScroll, ulong& lineScroll);
+  void sampled(int pad, bool tracking);
   // getters 
   long int getDynamicScroll() const { return dynamicScroll_; }
   void setDynamicScroll(long int val) { dynamicScroll_ = val; }
@@ -33,6 +34,7 @@ private:
   volatile long int prev_dynamicScroll_ = 0;    // Previous scroll offset
   int lastTouch_ = -1;                          // Last touch event
   unsigned long lastTouchTime_ = 0;             // Last touch time
+  int sampledPad_ = -1;                         // Pad seen by the last sample
 };
 
 void setupTouch();
@@ -0,0 +1,158 @@
+#pragma once
+#include <stdint.h>
+
+// ===================== REFRESH SCHEDULER =====================
+/*
+RefreshScheduler:
+@Description
+  Decides how the e-ink is updated. Fast updates leave ghosting behind; the scheduler
+  adds up how many pixels every update toggled and asks for a slow full update only
+  once that passes the budget, instead of after a fixed number of updates.
+
+  Full updates count toward the full budget, a slow one clears it. Partial windows
+  count toward the partial budget, which any full update clears (that's all the old
+  per-window counter did). When the toggled pixels aren't known they are estimated
+  from the hint: text changes a quarter of the screen, menus half, images all of it.
+
+  Requests can also be queued with request(): the ones that arrive within the quiet
+  time of each other become one update, sent once due() says so. An update that turns
+  out to change nothing is skip()ped, small ones may go out as partial windows.
+
+  Usage:
+    scheduler.setBudgets(5 * RefreshScheduler::SCREEN_PX / 4, partialPx);
+    RefreshDecision d = scheduler.full(REFRESH_MENU, forceSlow);
+    setFastFullRefresh(!d.slow);
+    scheduler.partial(windowPx);
+    if (!scheduler.partialAllowed()) ...  // time for a full update
+*/
+
+// what changed on screen, most ghosting last
+enum RefreshHint : uint8_t { REFRESH_TEXT, REFRESH_MENU, REFRESH_IMAGE };
+
+struct RefreshDecision {
+  bool        slow;       // slow full update that clears ghosting
+  RefreshHint hint;       // strongest hint of the requests it covers
+  uint32_t    ghost;      // toggled pixels counted before this update
+  uint32_t    budget;
+  uint16_t    coalesced;  // queued requests folded into this update
+};
+
+class RefreshScheduler {
+public:
+  static constexpr uint32_t SCREEN_PX = 320 * 240;
+  static constexpr uint32_t UNKNOWN   = 0xFFFFFFFF;
+
+  void setBudgets(uint32_t fullPx, uint32_t partialPx) {
+    fullBudget_    = fullPx;
+    partialBudget_ = partialPx;
+  }
+
+  // Pixels a fast full update with this hint is taken to toggle
+  static uint32_t estimate(RefreshHint hint) {
+    switch (hint) {
+      case REFRESH_IMAGE: return SCREEN_PX;
+      case REFRESH_MENU:  return SCREEN_PX / 2;
+      default:            return SCREEN_PX / 4;
+    }
+  }
+
+  // ---- queued requests ----
+  void request(RefreshHint hint, uint32_t now) {
+    if (!pending_) {
+      pending_   = true;
+      firstAt_   = now;
+      hint_      = hint;
+      coalesced_ = 0;
+    } else {
+      coalesced_++;
+      if (hint > hint_) hint_ = hint;
+    }
+    lastAt_ = now;
+  }
+  bool pending() const { return pending_; }
+  // Quiet for quietMs, or waiting longer than maxWaitMs however often it's asked again
+  bool due(uint32_t now, uint32_t quietMs, uint32_t maxWaitMs) const {
+    return pending_ && (now - lastAt_ >= quietMs || now - firstAt_ >= maxWaitMs);
+  }
+  // Milliseconds until due(), 0 once it is
+  uint32_t dueIn(uint32_t now, uint32_t quietMs, uint32_t maxWaitMs) const {
+    const uint32_t quiet = now - lastAt_;
+    const uint32_t wait  = now - firstAt_;
+    if (quiet >= quietMs || wait >= maxWaitMs) return 0;
+    return (quietMs - quiet < maxWaitMs - wait) ? quietMs - quiet : maxWaitMs - wait;
+  }
+  // The queued frame was replaced before it was sent
+  void drop() {
+    if (pending_) dropped_++;
+    pending_ = false;
+  }
+  // Strongest hint of this update and any queued request
+  RefreshHint hintWith(RefreshHint hint) const {
+    return (pending_ && hint_ > hint) ? hint_ : hint;
+  }
+  // The queued request is covered by an update other than full(), returns how many
+  // requests it stood for
+  uint16_t take() {
+    const uint16_t n = pending_ ? coalesced_ + 1 : 0;
+    pending_ = false;
+    return n;
+  }
+  // Nothing changed on screen, nothing was sent
+  void skip() {
+    take();
+    skipped_++;
+  }
+
+  // ---- updates ----
+  // A full update is about to be sent, covering any queued request
+  RefreshDecision full(RefreshHint hint, bool forceSlow, uint32_t changedPx = UNKNOWN) {
+    RefreshDecision d;
+    d.hint      = hintWith(hint);
+    d.coalesced = take();
+    d.ghost     = fullGhost_;
+    d.budget    = fullBudget_;
+    d.slow      = forceSlow || fullGhost_ >= fullBudget_;
+
+    if (d.slow) {
+      fullGhost_ = 0;
+      slowCount_++;
+    } else {
+      fullGhost_ += (changedPx == UNKNOWN) ? estimate(d.hint) : changedPx;
+      fastCount_++;
+    }
+    partialGhost_ = 0;
+    return d;
+  }
+  void partial(uint32_t changedPx) {
+    partialGhost_ += changedPx;
+    partialCount_++;
+  }
+  bool partialAllowed() const { return partialGhost_ < partialBudget_; }
+  // Panel was cleaned some other way (multi-pass refresh)
+  void cleaned() {
+    fullGhost_ = partialGhost_ = 0;
+    pending_   = false;
+  }
+
+  uint32_t fullGhost()    const { return fullGhost_; }
+  uint32_t partialGhost() const { return partialGhost_; }
+  uint32_t fastCount()    const { return fastCount_; }
+  uint32_t slowCount()    const { return slowCount_; }
+  uint32_t partialCount() const { return partialCount_; }
+  uint32_t dropped()      const { return dropped_; }
+  uint32_t skippedCount() const { return skipped_; }
+
+private:
+  uint32_t    fullBudget_    = 5 * SCREEN_PX / 4;
+  uint32_t    partialBudget_ = 20 * 320 * 24;
+  uint32_t    fullGhost_     = 0;
+  uint32_t    partialGhost_  = 0;
+
+  bool        pending_   = false;
+  RefreshHint hint_      = REFRESH_TEXT;
+  uint32_t    firstAt_   = 0;
+  uint32_t    lastAt_    = 0;
+  uint16_t    coalesced_ = 0;
+
+  uint32_t    fastCount_ = 0, slowCount_ = 0, partialCount_ = 0, dropped_ = 0, skipped_ = 0;
+};
@@ -0,0 +1,222 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <dirtyRects.h>
+
+// ===================== SHADOW FRAME =====================
+/*
+ShadowFrame:
+@Description
+  Mirror of the e-ink driver's 1-bit buffer plus a copy of what was last pushed to the
+  panel, so a refresh can send only what changed. GxEPD2 keeps its buffer to itself,
+  so the display mirrors every pixel it draws here, byte for byte the way GxEPD2 lays
+  it out (native panel orientation, relative to the partial window if one is set), and
+  every push copies the pushed part into the panel copy.
+
+  diff() XORs the two 32 bits at a time. Changes are collected per byte column, which
+  is the 8 px step partial windows move in, and handed to addDirtyRect() so they come
+  back as at most maxRects 8-aligned windows in screen coordinates. The panel content
+  isn't known after boot or a power cycle, known() is false until the first full push.
+
+  Usage:
+    ShadowFrame<240, 320> shadow;          // native size of the panel
+    shadow.setRotation(3);
+    shadow.drawPixel(x, y, true);           // alongside the driver
+    std::vector<DirtyRect> windows;
+    uint32_t changed = shadow.diff(windows, 2);
+    if (!changed) skip; else for (r : windows) display.displayWindow(r...);
+*/
+
+template<int16_t WIDTH, int16_t HEIGHT>
+class ShadowFrame {
+public:
+  static_assert(WIDTH % 8 == 0 && (WIDTH / 8 * HEIGHT) % 4 == 0, "panel size");
+  static constexpr int16_t ROW_BYTES = WIDTH / 8;
+  static constexpr size_t  BYTES     = (size_t)ROW_BYTES * HEIGHT;
+
+  ShadowFrame() {
+    memset(next_, 0, sizeof(next_));
+    memset(shown_, 0, sizeof(shown_));
+  }
+
+  void    setRotation(uint8_t r) { rotation_ = r & 3; }
+  uint8_t getRotation() const    { return rotation_; }
+  int16_t width()  const { return (rotation_ & 1) ? HEIGHT : WIDTH; }
+  int16_t height() const { return (rotation_ & 1) ? WIDTH : HEIGHT; }
+
+  // ---- driver mirror ----
+  void setFullWindow() {
+    partial_ = false;
+    wx_ = wy_ = 0;
+    ww_ = WIDTH;
+    wh_ = HEIGHT;
+  }
+  // Clamped, rotated and widened to whole bytes the same way GxEPD2_BW does it
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    x = x < width() ? x : width();
+    y = y < height() ? y : height();
+    w = w < width() - x ? w : width() - x;
+    h = h < height() - y ? h : height() - y;
+    int16_t rx = x, ry = y, rw = w, rh = h;
+    toNative(rx, ry, rw, rh);
+    rw += rx % 8;
+    if (rw % 8) rw += 8 - rw % 8;
+    rx -= rx % 8;
+    partial_ = true;
+    wx_ = rx;
+    wy_ = ry;
+    ww_ = rw;
+    wh_ = rh;
+  }
+  bool partialMode() const { return partial_; }
+
+  void drawPixel(int16_t x, int16_t y, bool black) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    switch (rotation_) {
+      case 1: { int16_t t = x; x = WIDTH - y - 1; y = t; break; }
+      case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+      case 3: { int16_t t = x; x = y; y = HEIGHT - t - 1; break; }
+    }
+    x -= wx_;
+    y -= wy_;
+    if (x < 0 || x >= ww_ || y < 0 || y >= wh_) return;
+    uint8_t& b = bytes(next_)[x / 8 + (size_t)y * (ww_ / 8)];
+    const uint8_t bit = 0x80 >> (x & 7);
+    if (black) b |= bit;
+    else       b &= ~bit;
+  }
+  // fillScreen() fills the whole buffer, whatever the window
+  void fill(bool black) { memset(next_, black ? 0xFF : 0x00, sizeof(next_)); }
+
+  // display(): the buffer is sent as a full screen
+  void pushAll() {
+    memcpy(shown_, next_, sizeof(shown_));
+    known_ = true;
+  }
+  // nextPage() in partial mode: the window's buffer goes to the window
+  void pushWindow() {
+    const int16_t wb = ww_ / 8;
+    for (int16_t r = 0; r < wh_; r++) {
+      memcpy(bytes(shown_) + (size_t)(wy_ + r) * ROW_BYTES + wx_ / 8,
+             bytes(next_) + (size_t)r * wb, wb);
+    }
+  }
+  // displayWindow(): part of the buffer, read as a full screen, goes to the same place
+  void pushRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    int16_t c0, c1, r0, r1;
+    if (!nativeBytes(x, y, w, h, c0, c1, r0, r1)) return;
+    for (int16_t r = r0; r < r1; r++) {
+      const size_t at = (size_t)r * ROW_BYTES + c0;
+      memcpy(bytes(shown_) + at, bytes(next_) + at, c1 - c0);
+    }
+  }
+  // What the panel shows, in the driver's layout with 1 = black, for pushing it again
+  const uint8_t* shownBytes() const { return bytes(shown_); }
+  // The native rectangle displayWindow() would send for a screen rectangle
+  DirtyRect nativeRect(const DirtyRect& r) const {
+    int16_t c0, c1, r0, r1;
+    if (!nativeBytes(r.x, r.y, r.w, r.h, c0, c1, r0, r1)) return {0, 0, 0, 0};
+    return {c0 * 8, r0, (c1 - c0) * 8, r1 - r0};
+  }
+  // Panel content unknown (power cycle, another writer), the next push must be full
+  void forget() { known_ = false; }
+  bool known() const { return known_; }
+
+  // ---- diff ----
+  // Pixels that differ between the buffer (read as a full screen) and the panel, and
+  // where. Only meaningful once known()
+  uint32_t diff(std::vector<DirtyRect>& rects, size_t maxRects) const {
+    uint16_t lo[ROW_BYTES], hi[ROW_BYTES];
+    for (int16_t c = 0; c < ROW_BYTES; c++) { lo[c] = 0xFFFF; hi[c] = 0; }
+
+    uint32_t changed = 0;
+    for (size_t w = 0; w < BYTES / 4; w++) {
+      const uint32_t x = next_[w] ^ shown_[w];
+      if (!x) continue;
+      changed += __builtin_popcount(x);
+      for (size_t i = w * 4; i < w * 4 + 4; i++) {
+        if (bytes(next_)[i] == bytes(shown_)[i]) continue;
+        const uint16_t row = i / ROW_BYTES, col = i % ROW_BYTES;
+        if (row < lo[col]) lo[col] = row;
+        if (row > hi[col]) hi[col] = row;
+      }
+    }
+    collect(lo, hi, 0, ROW_BYTES, rects, maxRects);
+    return changed;
+  }
+  // Same, limited to one screen rectangle (as widened by displayWindow())
+  uint32_t diff(const DirtyRect& clip, std::vector<DirtyRect>& rects, size_t maxRects) const {
+    int16_t c0, c1, r0, r1;
+    if (!nativeBytes(clip.x, clip.y, clip.w, clip.h, c0, c1, r0, r1)) return 0;
+    uint16_t lo[ROW_BYTES], hi[ROW_BYTES];
+    for (int16_t c = 0; c < ROW_BYTES; c++) { lo[c] = 0xFFFF; hi[c] = 0; }
+
+    uint32_t changed = 0;
+    for (int16_t r = r0; r < r1; r++) {
+      const size_t at = (size_t)r * ROW_BYTES;
+      for (int16_t c = c0; c < c1; c++) {
+        const uint8_t x = bytes(next_)[at + c] ^ bytes(shown_)[at + c];
+        if (!x) continue;
+        changed += __builtin_popcount(x);
+        if (r < lo[c]) lo[c] = r;
+        if (r > hi[c]) hi[c] = r;
+      }
+    }
+    collect(lo, hi, c0, c1, rects, maxRects);
+    return changed;
+  }
+
+private:
+  static uint8_t*       bytes(uint32_t* w)       { return reinterpret_cast<uint8_t*>(w); }
+  static const uint8_t* bytes(const uint32_t* w) { return reinterpret_cast<const uint8_t*>(w); }
+
+  // Screen rectangle to native, the way GxEPD2_BW rotates windows
+  void toNative(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+    int16_t t;
+    switch (rotation_) {
+      case 1: t = x; x = WIDTH - y - h; y = t; t = w; w = h; h = t; break;
+      case 2: x = WIDTH - x - w; y = HEIGHT - y - h; break;
+      case 3: t = x; x = y; y = HEIGHT - t - w; t = w; w = h; h = t; break;
+    }
+  }
+  void toScreen(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+    int16_t t;
+    switch (rotation_) {
+      case 1: t = y; y = WIDTH - x - w; x = t; t = w; w = h; h = t; break;
+      case 2: x = WIDTH - x - w; y = HEIGHT - y - h; break;
+      case 3: t = x; x = HEIGHT - y - h; y = t; t = w; w = h; h = t; break;
+    }
+  }
+  // Screen rectangle to the byte columns and rows displayWindow() sends
+  bool nativeBytes(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                   int16_t& c0, int16_t& c1, int16_t& r0, int16_t& r1) const {
+    x = x < width() ? x : width();
+    y = y < height() ? y : height();
+    w = w < width() - x ? w : width() - x;
+    h = h < height() - y ? h : height() - y;
+    int16_t rx = x, ry = y, rw = w, rh = h;
+    toNative(rx, ry, rw, rh);
+    c0 = rx / 8;
+    c1 = (rx + rw + 7) / 8;
+    r0 = ry;
+    r1 = ry + rh;
+    return c1 > c0 && r1 > r0;
+  }
+  void collect(const uint16_t* lo, const uint16_t* hi, int16_t c0, int16_t c1,
+               std::vector<DirtyRect>& rects, size_t maxRects) const {
+    for (int16_t c = c0; c < c1; c++) {
+      if (lo[c] > hi[c]) continue;
+      int16_t x = c * 8, y = lo[c], w = 8, h = hi[c] - lo[c] + 1;
+      toScreen(x, y, w, h);
+      addDirtyRect(rects, {x, y, w, h}, maxRects, height());
+    }
+  }
+
+  uint32_t next_[BYTES / 4];   // what the driver's buffer holds, 1 = black
+  uint32_t shown_[BYTES / 4];  // what the panel shows
+  bool     known_    = false;
+  bool     partial_  = false;
+  uint8_t  rotation_ = 0;
+  int16_t  wx_ = 0, wy_ = 0, ww_ = WIDTH, wh_ = HEIGHT;  // window, native
+};
@@ -0,0 +1,210 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+#if __has_include(<esp_log.h>)
+#include <esp_log.h>
+#else
+#include <stdio.h>
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#endif
+
+#if __has_include(<gfxfont.h>)
+#include <gfxfont.h>
+#else
+// Native builds don't pull in Adafruit GFX, mirror its font layout here
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+} GFXglyph;
+typedef struct {
+  uint8_t*  bitmap;
+  GFXglyph* glyph;
+  uint16_t  first;
+  uint16_t  last;
+  uint8_t   yAdvance;
+} GFXfont;
+#endif
+
+// ===================== TEXT METRICS =====================
+/*
+TextMetrics:
+@Description
+  Per-GFXfont glyph metric tables so text can be measured without going through
+  display.getTextBounds(). A table is built the first time a font is measured and
+  kept for the rest of the session (~5 bytes per glyph).
+
+  bounds() returns the same box as getTextBounds(s, 0, 0, ...) for single-line text
+  (text wrap is ignored, which is what every caller measuring a word wants anyway).
+
+  Usage:
+    const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+    uint16_t w = fm.width("word", 4);
+    TextBounds b = fm.bounds(ptr, len);  // x1, y1, w, h
+*/
+#define MAX_FONT_PACKS   32  // packs a FontCache can know of (TXT uses 30), see fontPack.h
+#define MAX_UI_FONTS     16  // compiled-in GFXfonts measured outside of font packs
+// fonts measured per session: each pack and its fallback, plus the UI fonts
+#define MAX_FONT_METRICS (MAX_FONT_PACKS * 2 + MAX_UI_FONTS)
+
+struct TextBounds {
+  int16_t  x1 = 0;
+  int16_t  y1 = 0;
+  uint16_t w  = 0;
+  uint16_t h  = 0;
+};
+
+// Packed copy of the GFXglyph fields needed for measuring
+struct GlyphMetric {
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t  xOffset;
+  int8_t  yOffset;
+};
+
+class FontMetrics {
+public:
+  explicit FontMetrics(const GFXfont* font) : font_(font) {
+    if (!font_) return;
+    // fonts live in memory-mapped flash on the ESP32, read them directly
+    first_    = font_->first;
+    last_     = font_->last;
+    yAdvance_ = font_->yAdvance;
+    const size_t count = (last_ >= first_) ? (size_t)(last_ - first_ + 1) : 0;
+    if (count == 0) return;
+    glyphs_ = (GlyphMetric*)malloc(count * sizeof(GlyphMetric));
+    if (!glyphs_) return;
+    for (size_t i = 0; i < count; i++) {
+      const GFXglyph& g = font_->glyph[i];
+      glyphs_[i] = {g.width, g.height, g.xAdvance, g.xOffset, g.yOffset};
+    }
+  }
+  ~FontMetrics() { free(glyphs_); }
+  FontMetrics(const FontMetrics&) = delete;
+  FontMetrics& operator=(const FontMetrics&) = delete;
+
+  const GFXfont* font() const { return font_; }
+  uint8_t yAdvance()    const { return yAdvance_; }
+
+  // Glyph for c, nullptr if the font doesn't cover it (getTextBounds skips those too)
+  const GlyphMetric* glyph(uint8_t c) const {
+    if (!glyphs_ || c < first_ || c > last_) return nullptr;
+    return &glyphs_[c - first_];
+  }
+
+  uint8_t charAdvance(uint8_t c) const {
+    const GlyphMetric* g = glyph(c);
+    return g ? g->xAdvance : 0;
+  }
+
+  // Sum of advances, i.e. how far the cursor moves after printing s
+  uint16_t advance(const char* s, size_t n) const {
+    uint16_t x = 0;
+    for (size_t i = 0; i < n; i++) x += charAdvance((uint8_t)s[i]);
+    return x;
+  }
+
+  // Bounding box of s drawn at (0,0), equivalent to getTextBounds()
+  TextBounds bounds(const char* s, size_t n) const { return bounds(s, n, nullptr, 0); }
+
+  // Box of s followed by more, without joining them into one string first
+  TextBounds bounds(const char* s, size_t n, const char* more, size_t m) const {
+    int16_t x = 0;
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    for (size_t i = 0; i < n + m; i++) {
+      const GlyphMetric* g = glyph((uint8_t)(i < n ? s[i] : more[i - n]));
+      if (!g) continue;
+      const int16_t x1 = x + g->xOffset;
+      const int16_t y1 = g->yOffset;
+      const int16_t x2 = x1 + g->width - 1;
+      const int16_t y2 = y1 + g->height - 1;
+      if (x1 < minx) minx = x1;
+      if (y1 < miny) miny = y1;
+      if (x2 > maxx) maxx = x2;
+      if (y2 > maxy) maxy = y2;
+      x += g->xAdvance;
+    }
+    TextBounds b;
+    if (maxx >= minx) { b.x1 = minx; b.w = maxx - minx + 1; }
+    if (maxy >= miny) { b.y1 = miny; b.h = maxy - miny + 1; }
+    return b;
+  }
+  TextBounds bounds(const char* s) const { return bounds(s, strlen(s)); }
+
+  uint16_t width(const char* s, size_t n) const { return bounds(s, n).w; }
+  uint16_t width(const char* s)           const { return bounds(s, strlen(s)).w; }
+
+private:
+  const GFXfont* font_     = nullptr;
+  GlyphMetric*   glyphs_   = nullptr;
+  uint16_t       first_    = 0;
+  uint16_t       last_     = 0;
+  uint8_t        yAdvance_ = 0;
+};
+
+// Metrics of up to N fonts, built the first time each is measured. A font past the
+// first N is measured as zero width, which is logged once
+template<int N>
+class FontMetricsTable {
+public:
+  FontMetricsTable() = default;
+  FontMetricsTable(const FontMetricsTable&) = delete;
+  FontMetricsTable& operator=(const FontMetricsTable&) = delete;
+  ~FontMetricsTable() {
+    for (int i = 0; i < count_.load(std::memory_order_acquire); i++) delete cache_[i];
+  }
+
+  // Safe to call from the input loop and the e-ink task
+  const FontMetrics& get(const GFXfont* font) {
+    // lookups never take the lock, entries are only ever appended
+    const int n = count_.load(std::memory_order_acquire);
+    for (int i = 0; i < n; i++) {
+      if (cache_[i]->font() == font) return *cache_[i];
+    }
+    if (!font) return none_;
+
+    while (lock_.test_and_set(std::memory_order_acquire)) {}
+    // another task may have built it while we waited
+    const int m = count_.load(std::memory_order_relaxed);
+    for (int i = n; i < m; i++) {
+      if (cache_[i]->font() == font) {
+        lock_.clear(std::memory_order_release);
+        return *cache_[i];
+      }
+    }
+    FontMetrics* built = &none_;  // table full: measure as zero rather than crash
+    if (m < N) {
+      built = new FontMetrics(font);
+      cache_[m] = built;
+      count_.store(m + 1, std::memory_order_release);
+    } else if (!overflowed_) {
+      overflowed_ = true;
+      ESP_LOGE("TEXT_METRICS", "More than %d fonts measured, raise MAX_FONT_METRICS", N);
+    }
+    lock_.clear(std::memory_order_release);
+    return *built;
+  }
+
+  int  size()       const { return count_.load(std::memory_order_acquire); }
+  bool overflowed() const { return overflowed_; }
+
+private:
+  FontMetrics*     cache_[N] = {};
+  std::atomic<int> count_{0};
+  std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+  bool             overflowed_ = false;  // written under lock_
+  FontMetrics      none_{nullptr};
+};
+
+// Lazily built metrics for font, safe to call from the input loop and the e-ink task
+inline const FontMetrics& fontMetrics(const GFXfont* font) {
+  static FontMetricsTable<MAX_FONT_METRICS> table;
+  return table.get(font);
+}
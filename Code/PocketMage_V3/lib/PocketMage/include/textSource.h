@@ -0,0 +1,206 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// ===================== TEXT SOURCE =====================
+/*
+TextSource:
+@Description
+  Line lists that text frames draw from. FixedArenaSource keeps lines in one buffer
+  and refuses new ones once it's full. RingArenaSource never refuses: a line that
+  doesn't fit pushes out the oldest lines, so consoles and logs can stream into a
+  frame in constant memory.
+
+  RingArenaSource keeps each line in one piece in a circular byte buffer. A line that
+  doesn't fit before the end of the buffer starts again at 0 and the bytes left at the
+  end go unused until the lines in front of them are pushed out. version() goes up
+  whenever lines are pushed out or cleared (line i is then a different line), pushed()
+  whenever a line is added, so a screen only has to redraw when pushed() moved.
+
+  Any task may push. einkFramesDynamic() holds lock() while it lays out a frame and
+  copies its visible lines into a SnapshotSource, then draws and pushes the panel from
+  the copy with the source unlocked, so pushing only waits for the copy. Anything else
+  reading line() from another task than the one pushing must hold lock() as well, a
+  LineView stays valid only until the next push.
+
+  Usage:
+    RingArenaSource<32, 2048> log;
+    log.pushLine(s, strlen(s));               // from any task
+    Frame logFrame(10, 10, 10, 10, &log);     // pinned to the newest line by default
+    if (log.pushed() != drawnPushes) einkFramesDynamic(frames, false);
+*/
+
+// bit flags for alignment or future options, LF_SELECTED is set by frames when drawing
+enum LineFlags : uint8_t { LF_NONE=0, LF_RIGHT= 1<<0, LF_CENTER= 1<<1, LF_SELECTED= 1<<2 };
+struct LineView {
+  const char* ptr;   // points to NUL-terminated string in RAM or PROGMEM
+  uint16_t    len;   // byte length (no need to include '\0')
+  uint8_t     flags; // LineFlags
+};
+// read-only interface for any line list (PROGMEM table, arena, etc.)
+struct TextSource {
+  virtual ~TextSource() {}
+  virtual size_t   size() const = 0;
+  virtual LineView line(size_t i) const = 0;
+  // changes whenever lines already there change (appending lines doesn't count)
+  virtual uint32_t version() const { return 0; }
+  // held while lines are read, for sources other tasks write to
+  virtual void lock() const {}
+  virtual void unlock() const {}
+};
+template<size_t MAX_LINES, size_t BUF_BYTES>
+struct FixedArenaSource : TextSource {
+  char     buf[BUF_BYTES];
+  uint16_t off[MAX_LINES];
+  uint16_t len_[MAX_LINES];
+  uint8_t  flags_[MAX_LINES];
+  size_t   nLines = 0;
+  size_t   used   = 0;
+  uint32_t version_ = 0;
+
+  size_t size() const override { return nLines; }
+  uint32_t version() const override { return version_; }
+
+  LineView line(size_t i) const override {
+    return { buf + off[i], len_[i], flags_[i] };
+  }
+
+  void clear() { nLines = 0; used = 0; version_++; }
+
+  // Returns false if out of capacity; caller can choose to drop the oldest, etc.
+  bool pushLine(const char* s, uint16_t L, uint8_t flags = LF_NONE) {
+    if (nLines >= MAX_LINES || used + L + 1 > BUF_BYTES) return false;
+    memcpy(buf + used, s, L);
+    buf[used + L] = '\0';
+    off[nLines]   = (uint16_t)used;
+    len_[nLines]  = L;
+    flags_[nLines]= flags;
+    used         += L + 1;
+    nLines++;
+    return true;
+  }
+};
+template<size_t MAX_LINES, size_t BUF_BYTES>
+struct RingArenaSource : TextSource {
+  static_assert(MAX_LINES > 0 && BUF_BYTES > 1 && BUF_BYTES <= 0xFFFF, "ring size");
+
+  size_t size() const override { return count_; }
+  uint32_t version() const override { return version_; }
+  void lock() const override { mutex_.lock(); }
+  void unlock() const override { mutex_.unlock(); }
+
+  LineView line(size_t i) const override {
+    const size_t slot = (head_ + i) % MAX_LINES;
+    return { buf_ + off_[slot], len_[slot], flags_[slot] };
+  }
+
+  // lines added since construction, and how many of them were pushed out since
+  uint32_t pushed()  const { return pushed_.load(); }
+  uint32_t evicted() const { return evicted_; }
+
+  void clear() {
+    std::lock_guard<std::recursive_mutex> hold(mutex_);
+    head_ = count_ = 0;
+    tail_ = 0;
+    version_++;
+    pushed_++;
+  }
+
+  // Always stores the line, dropping the oldest ones to make room. Lines longer than
+  // the buffer are cut short
+  void pushLine(const char* s, uint16_t L, uint8_t flags = LF_NONE) {
+    std::lock_guard<std::recursive_mutex> hold(mutex_);
+    if ((size_t)L + 1 > BUF_BYTES) L = (uint16_t)(BUF_BYTES - 1);
+    const size_t need = (size_t)L + 1;
+
+    bool dropped = false;
+    for (;;) {
+      if (count_ == 0) { tail_ = 0; break; }
+      if (count_ < MAX_LINES) {
+        const size_t oldest = off_[head_];
+        if (tail_ > oldest) {
+          // lines run from oldest to tail, free space at the end and the start
+          if (tail_ + need <= BUF_BYTES) break;
+          if (need <= oldest) { tail_ = 0; break; }
+        } else if (tail_ + need <= oldest) {
+          // wrapped, free space between tail and oldest
+          break;
+        }
+      }
+      head_ = (head_ + 1) % MAX_LINES;
+      count_--;
+      evicted_++;
+      dropped = true;
+    }
+
+    const size_t slot = (head_ + count_) % MAX_LINES;
+    memcpy(buf_ + tail_, s, L);
+    buf_[tail_ + L] = '\0';
+    off_[slot]   = (uint16_t)tail_;
+    len_[slot]   = L;
+    flags_[slot] = flags;
+    tail_ += need;
+    count_++;
+    if (dropped) version_++;
+    pushed_++;
+  }
+
+private:
+  char     buf_[BUF_BYTES];
+  uint16_t off_[MAX_LINES];
+  uint16_t len_[MAX_LINES];
+  uint8_t  flags_[MAX_LINES];
+  size_t   head_  = 0;  // slot of the oldest line
+  size_t   count_ = 0;
+  size_t   tail_  = 0;  // where the next line goes
+  uint32_t version_ = 0;
+  uint32_t evicted_ = 0;
+  std::atomic<uint32_t> pushed_{0};
+  mutable std::recursive_mutex mutex_;  // frames sharing a source lock it once each
+};
+
+// Copy of lines [start, end) of a source, taken while it's locked. Reads like the source
+// (same size() and version()), lines outside the range are empty. Keeps its buffers
+// between take()s, so a redraw doesn't allocate once they've grown.
+struct SnapshotSource : TextSource {
+  size_t size() const override { return total_; }
+  uint32_t version() const override { return version_; }
+
+  LineView line(size_t i) const override {
+    if (i < start_ || i - start_ >= off_.size()) return { "", 0, LF_NONE };
+    const size_t k = i - start_;
+    return { buf_.data() + off_[k], len_[k], flags_[k] };
+  }
+
+  void take(const TextSource& src, size_t start, size_t end) {
+    total_   = src.size();
+    version_ = src.version();
+    start_   = start;
+    if (end > total_) end = total_;
+    buf_.clear();
+    off_.clear();
+    len_.clear();
+    flags_.clear();
+    for (size_t i = start; i < end; i++) {
+      const LineView lv = src.line(i);
+      off_.push_back((uint32_t)buf_.size());
+      len_.push_back(lv.len);
+      flags_.push_back(lv.flags);
+      buf_.insert(buf_.end(), lv.ptr, lv.ptr + lv.len);
+      buf_.push_back('\0');
+    }
+  }
+
+private:
+  std::vector<char>     buf_;
+  std::vector<uint32_t> off_;
+  std::vector<uint16_t> len_;
+  std::vector<uint8_t>  flags_;
+  size_t   start_   = 0;
+  size_t   total_   = 0;
+  uint32_t version_ = 0;
+};
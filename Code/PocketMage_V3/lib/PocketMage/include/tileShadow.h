@@ -0,0 +1,103 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// ===================== TILE SHADOW =====================
+/*
+TileShadow:
+@Description
+  Copy of the u8g2 full buffer as last sent to the OLED, so a commit only sends the
+  8x8 tiles that changed. u8g2 keeps a tile as 8 consecutive bytes (one per column,
+  tile rows one after the other), the same layout updateDisplayArea() sends from, so
+  tiles are compared as two 32-bit words.
+
+  Changed tiles are sent per tile row, as runs from the first changed tile to the
+  last. Runs with fewer than MERGE_GAP unchanged tiles between them become one, since
+  every updateDisplayArea() call costs addressing commands on top of the tile data.
+  Coordinates are the controller's, the buffer is never rotated.
+
+  Until the first commit, and after forget() (power cycle, u8g2.begin()), the whole
+  buffer is sent.
+
+  Usage:
+    TileShadow<32, 4> shadow;             // 256x32
+    shadow.commit(u8g2.getBufferPtr(), [](uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+      u8g2.updateDisplayArea(tx, ty, tw, th);
+    });
+*/
+
+template<uint8_t TILES_W, uint8_t TILES_H>
+class TileShadow {
+public:
+  static constexpr size_t  BYTES     = (size_t)TILES_W * TILES_H * 8;
+  static constexpr uint8_t MERGE_GAP = 2;
+
+  TileShadow() { memset(sent_, 0, sizeof(sent_)); }
+
+  // Sends the tiles of buf that differ from the last commit through send(tx, ty, tw, th),
+  // returns how many tiles went out
+  template<class SendFn>
+  uint16_t commit(const uint8_t* buf, SendFn&& send) {
+    commits_++;
+    if (!known_) {
+      send(0, 0, TILES_W, TILES_H);
+      memcpy(sent_, buf, BYTES);
+      known_ = true;
+      tiles_ += TILES_W * TILES_H;
+      return TILES_W * TILES_H;
+    }
+
+    uint16_t sent = 0;
+    for (uint8_t ty = 0; ty < TILES_H; ty++) {
+      int16_t first = -1, last = -1;
+      for (uint8_t tx = 0; tx < TILES_W; tx++) {
+        if (!changed(buf, tx, ty)) continue;
+        if (first >= 0 && tx - last > MERGE_GAP) {
+          sent += flush(buf, first, last, ty, send);
+          first = -1;
+        }
+        if (first < 0) first = tx;
+        last = tx;
+      }
+      if (first >= 0) sent += flush(buf, first, last, ty, send);
+    }
+    if (!sent) skipped_++;
+    tiles_ += sent;
+    return sent;
+  }
+
+  // The OLED's content is unknown, the next commit sends everything
+  void forget() { known_ = false; }
+  bool known() const { return known_; }
+
+  uint32_t commits()     const { return commits_; }
+  uint32_t skipped()     const { return skipped_; }   // commits that sent nothing
+  uint32_t tilesSent()   const { return tiles_; }
+  // Share of the tiles a full sendBuffer() per commit would have sent
+  uint32_t sentPercent() const {
+    return commits_ ? (uint32_t)((uint64_t)tiles_ * 100 / ((uint64_t)commits_ * TILES_W * TILES_H))
+                    : 100;
+  }
+
+private:
+  bool changed(const uint8_t* buf, uint8_t tx, uint8_t ty) const {
+    const size_t at = ((size_t)ty * TILES_W + tx) * 8;
+    uint32_t a[2], b[2];
+    memcpy(a, buf + at, 8);
+    memcpy(b, sent_ + at, 8);
+    return (a[0] ^ b[0]) | (a[1] ^ b[1]);
+  }
+
+  template<class SendFn>
+  uint16_t flush(const uint8_t* buf, uint8_t first, uint8_t last, uint8_t ty, SendFn& send) {
+    const uint8_t tw = last - first + 1;
+    send(first, ty, tw, 1);
+    const size_t at = ((size_t)ty * TILES_W + first) * 8;
+    memcpy(sent_ + at, buf + at, (size_t)tw * 8);
+    return tw;
+  }
+
+  uint8_t  sent_[BYTES];
+  bool     known_   = false;
+  uint32_t commits_ = 0, skipped_ = 0, tiles_ = 0;
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#include <textMetrics.h>
+
+// ===================== WORD WRAP =====================
+/*
+WordWrap:
+@Description
+  Wraps plain text into lines no wider than a pixel limit in one pass. The width of
+  the line being built grows glyph by glyph instead of measuring the whole line again
+  for every character, and the last space is remembered so a word that doesn't fit
+  moves to the next line without searching back for it.
+
+  Lines come out as spans of the input with how they ended, so the text can be put
+  back together exactly without measuring anything (wrapJoin()):
+    WRAP_HARD   a newline, or the end of the text
+    WRAP_SOFT   wrapped after a space or inside a word too long for a line
+    WRAP_SPACE  wrapped at a space, which belongs to neither line
+
+  Lines break where the legacy TXT editor breaks them while typing: once the line is
+  at least limit wide, at the last space if it has one.
+
+  Usage:
+    wrapText(text, len, fontMetrics(font), display.width() - 5,
+      [&](const char* line, size_t n, uint8_t brk) { lines.push_back(...); });
+    result += line; result += wrapJoin(brk);
+*/
+#define WRAP_HARD  0
+#define WRAP_SOFT  1
+#define WRAP_SPACE 2
+
+// Bounding box width of a line built one glyph at a time, same as FontMetrics::bounds().w
+struct LineBox {
+  int16_t x    = 0;
+  int16_t minx = 0x7FFF;
+  int16_t maxx = -1;
+
+  void add(const GlyphMetric* g) {
+    if (!g) return;
+    const int16_t x1 = x + g->xOffset;
+    const int16_t x2 = x1 + g->width - 1;
+    if (x1 < minx) minx = x1;
+    if (x2 > maxx) maxx = x2;
+    x += g->xAdvance;
+  }
+  uint16_t width() const { return maxx >= minx ? maxx - minx + 1 : 0; }
+  void clear() { *this = LineBox(); }
+};
+
+// onLine(const char* line, size_t len, uint8_t brk) gets each line in order
+template <typename LineFn>
+void wrapText(const char* s, size_t n, const FontMetrics& fm, uint16_t limit, LineFn&& onLine) {
+  size_t start = 0;          // the line is [start, i)
+  size_t lastSpace = SIZE_MAX;
+  LineBox box;
+
+  for (size_t i = 0; i < n; i++) {
+    const char c = s[i];
+    if (c == '\n') {
+      onLine(s + start, i - start, WRAP_HARD);
+      start = i + 1;
+      lastSpace = SIZE_MAX;
+      box.clear();
+      continue;
+    }
+
+    if (i > start && box.width() >= limit) {
+      if (s[i - 1] == ' ' || lastSpace == SIZE_MAX) {
+        onLine(s + start, i - start, WRAP_SOFT);
+        start = i;
+        box.clear();
+      } else {
+        // The partial word after the space starts the next line
+        onLine(s + start, lastSpace - start, WRAP_SPACE);
+        start = lastSpace + 1;
+        box.clear();
+        for (size_t j = start; j < i; j++) box.add(fm.glyph((uint8_t)s[j]));
+      }
+      lastSpace = SIZE_MAX;
+    }
+
+    box.add(fm.glyph((uint8_t)c));
+    if (c == ' ') lastSpace = i;
+  }
+
+  // A trailing newline leaves an empty last line so joining gives it back
+  if (start < n || (n > 0 && s[n - 1] == '\n'))
+    onLine(s + start, n - start, WRAP_HARD);
+}
+
+// What goes between a line that ended with brk and the next one
+inline const char* wrapJoin(uint8_t brk) {
+  return brk == WRAP_SPACE ? " " : brk == WRAP_SOFT ? "" : "\n";
+}
@@ -76,8 +76,13 @@ Frames Class:
     if box = 1, a thin frame will be drawn around the box
     if invert = 1, text will be displayed in dark mode
     if overlap = 1, frame with cover any contect behind frame
+    only frames that changed since they were drawn are redrawn, and only the rows of the old and new choice when just the choice moved
+    - call frame.markDirty() after changing lines of a TextSource in place (appending lines and clear() are noticed)
     frames uses a TextSource as a source for drawn text, which can be defined as either
-    a constant array of char, a FixedArenaSource for dynamic text content, or a bitmap for images
+    a constant array of char, a FixedArenaSource for dynamic text content, a RingArenaSource for logs
+    that drop their oldest lines, or a bitmap for images
+    - a RingArenaSource can be pushed to from any task, einkFramesDynamic() locks it only while copying the visible lines
+    text lines are split into rows once and kept in the frame's WrapCache until the source's version(), the frame width or the font changes
     - an example of using frames can be seen in calc.cpp (https://github.com/ashtf8/PocketMage-Calc/tree/main/src/CALC_APP)
   
   Setup:
@@ -92,7 +97,7 @@ Frames Class:
     frames.push_back(frame *); // add the frames you want to draw NOTE: frames pushed back earlier will be drawn over if new frames have overlap set to true
     CurrentFrameState = &frame; // point to current frame you want to control, can switch at any point to control different frames
 
-    frameLines.pushLine(s.c_str(), (uint16_t)s.length(), flag); // push line to a dynamic text source, flag currently not implemented
+    frameLines.pushLine(s.c_str(), (uint16_t)s.length(), flag); // push line to a dynamic text source, flag LF_NONE, LF_RIGHT or LF_CENTER
 
     std::vector<String> sourceToVector(const TextSource* src); // export frame text source to std::vector<String> for compatibility 
 */
@@ -104,43 +109,6 @@ Frames Class:
 int alignDown8(int v) { return v - (v % 8); }
 int alignUp8(int v)   { return (v % 8) ? v + (8 - (v % 8)) : v; }
 
-size_t sliceThatFits(const char* s, size_t n, int maxTextWidth) {
-  if (!s || n == 0) return 0;
-
-  int16_t x1, y1; uint16_t w, h;
-  static char buf[256]; 
-  const size_t cap = sizeof(buf) - 1;
-
-  size_t best = 0, lastSpace = SIZE_MAX;
-  size_t i = 0;
-  size_t len = 0;
-
-  while (i < n && len < cap) {
-    char c = s[i];
-
-    // newline: either end before it, or consume 1 char if it's first
-    if (c == '\n' || c == '\r') return (best > 0) ? best : 1;
-
-    if (c == ' ') lastSpace = i;
-
-    buf[len++] = c;
-    buf[len] = '\0';
-
-    display.getTextBounds(buf, 0, 0, &x1, &y1, &w, &h);
-    if ((int)w > maxTextWidth) break;
-
-    best = i + 1;
-    ++i;
-  }
-
-  const bool overflowed = (i < n) || (len >= cap);
-  if (best == 0) return (n ? 1 : 0);
-
-  if (overflowed && lastSpace != SIZE_MAX && lastSpace + 1 <= best) {
-    return lastSpace + 1;
-  }
-  return best;
-}
 // GET TOTAL LINES OF SOURCE !!
 inline long totalLines(const Frame& frame) {
   return frame.source ? (long)frame.source->size() : 0L;
@@ -163,6 +131,18 @@ inline size_t trimCRLF(const char* s, size_t n) {
   while (n && (s[n-1] == '\n' || s[n-1] == '\r')) --n;
   return n;
 }
+// LINE AS DRAWN: CR/LF TRIMMED, A LEADING ~C~ OR ~R~ MARKER TURNED INTO ITS FLAG !!
+inline LineView frameLine(const TextSource* src, long i) {
+  LineView lv = src->line(i);
+  lv.len = (uint16_t)trimCRLF(lv.ptr, lv.len);
+  if (lv.len >= 3 && lv.ptr[0] == '~' && lv.ptr[2] == '~' &&
+      (lv.ptr[1] == 'C' || lv.ptr[1] == 'R')) {
+    lv.flags |= (lv.ptr[1] == 'C') ? LF_CENTER : LF_RIGHT;
+    lv.ptr += 3;
+    lv.len -= 3;
+  }
+  return lv;
+}
 
 // MAKE SURE CHOICE IS VISIBLE IN FRAME --
 void ensureChoiceVisible(Frame& frame) {
@@ -184,13 +164,14 @@ void resetScroll(Frame& frame) {
   frame.scroll = tl > ml ? (tl - ml) : 0;
   frame.prevScroll = -1;
 }
-// GET CLEANED STRING FROM FRAME CHOICE -- NOTE: remove ~C~ and ~R~ in refactor to lineview flages
+// GET CLEANED STRING FROM FRAME CHOICE !!
 String frameChoiceString(const Frame& f) {
-  LineView lv = f.source->line(f.choice);
-  String s(lv.ptr, lv.len);
-  if (s.startsWith("~C~") || s.startsWith("~R~")) s.remove(0, 3);
-  s.trim();
-  return s;   
+  LineView lv = frameLine(f.source, f.choice);
+  const char* p = lv.ptr;
+  size_t n = lv.len;
+  while (n && isspace((unsigned char)*p)) { ++p; --n; }
+  while (n && isspace((unsigned char)p[n - 1])) --n;
+  return String(p, n);
 }
 // COPY TEXTSOURCE TO STD::VECTOER<STRING> MEMORY INEFFICIENT REMOVE IF STD::VECTOR<STRING> LINES ARE DEPRECIATED
 std::vector<String> sourceToVector(const TextSource* src) {
@@ -200,157 +181,221 @@ std::vector<String> sourceToVector(const TextSource* src) {
   result.reserve(src->size());
   for (size_t i = 0; i < src->size(); ++i) {
     LineView lv = src->line(i);
-    // copy the chars into an Arduino String
-    result.push_back(String(lv.ptr).substring(0, lv.len));
+    // copy only the line's chars into an Arduino String
+    result.push_back(String(lv.ptr, lv.len));
   }
   return result;
 }
 #pragma endregion
 
 ///////////////////////////// DRAWING FUNCTIONS
-// DRAW ALL FRAMES STORED WITHIN TOTAL FRAME BOUNDING BOX -- NOTE: remove ~C~ and ~R~ with switch to lineview flags
-void einkFramesDynamic(std::vector<Frame*> &frames, bool doFull_) {
-  if (frames.empty()) return;
-
-  // compute union window of all frames
-  int minX =  32767, minY =  32767;
-  int maxX = -32768, maxY = -32768;
-  for (Frame* frame : frames) {
-    if (!frame) continue;
-    const int width = display.width()  - frame->left  - frame->right;
-    const int height = display.height() - frame->top   - frame->bottom;
-    if (width <= 0 || height <= 0) continue;
-    if (frame->left < minX) minX = frame->left;
-    if (frame->top  < minY) minY = frame->top;
-    if (frame->left + width > maxX) maxX = frame->left + width;
-    if (frame->top  + height > maxY) maxY = frame->top  + height;
+// SCREEN AREA OF FRAME !!
+inline DirtyRect frameRect(const Frame& frame) {
+  return { frame.left, frame.top,
+           display.width()  - frame.left - frame.right,
+           display.height() - frame.top  - frame.bottom };
+}
+// WORK OUT SCROLL AND VISIBLE LINES, RECORD WHAT THE FRAME WILL SHOW IN frame.next !!
+void layoutFrame(Frame& frame, const GFXfont* font) {
+  FrameState& st = frame.next;
+  st = FrameState();
+  st.content = frame.bitmap ? (const void*)frame.bitmap : (const void*)frame.source;
+  st.choice  = frame.choice;
+  st.current = (&frame == CurrentFrameState);
+  st.invert  = frame.invert;
+  st.box     = frame.box;
+  st.left    = frame.left;  st.right  = frame.right;
+  st.top     = frame.top;   st.bottom = frame.bottom;
+  st.font    = font;
+
+  const DirtyRect area = frameRect(frame);
+  if (frame.bitmap || area.w <= 0 || area.h <= 0) return;
+
+  const int lineStride = EINK().getFontHeight() + EINK().getLineSpacing();
+  frame.maxLines = (lineStride > 1) ? (area.h / lineStride) - 1 : 0;
+  if (frame.maxLines <= 0) return;
+
+  const long total  = frame.source ? (long)frame.source->size() : 0L;
+  clampScroll(frame);
+
+  if (st.current && frame.choice >= 0) {
+    ensureChoiceVisible(frame);
   }
-  if (minX > maxX || minY > maxY) return;
-
-  const int frameX = minX;
-  const int frameY = alignDown8(minY);
-  const int frameW = alignUp8(maxX - minX);
-  const int frameH = alignDown8(maxY - frameY);
-
-  EINK().setTXTFont(EINK().getCurrentFont());
-
-  display.setPartialWindow(frameX, frameY, frameW, frameH);
-  display.firstPage();
-  do {
-    if (doFull_) {
-      display.fillRect(frameX, frameY, frameW, frameH, GxEPD_WHITE);
-    }
-    //Serial.println("Drawing Text!");
-    for (Frame* frame : frames) {
-      if (!frame || (!frame->source && !frame->bitmap)) continue;
-
-      const int frameW = display.width()  - frame->left - frame->right;
-      const int frameH = display.height() - frame->top  - frame->bottom;
-      if (frameW <= 0 || frameH <= 0) continue;
-
-      // if frame overlaps or is inverted, fill box with proper color
-      if (frame->invert || frame->overlap) {
-        display.fillRect(frame->left, frame->top, frameW, frameH,
-                        frame->invert ? GxEPD_BLACK : GxEPD_WHITE);
-      }
-
-      if (frame->box) {
-        //Serial.println("drawing box!");
-        if (frameW > 2 && frameH > 2) {
-          drawFrameBox(frame->left + 1, frame->top + 1, frameW - 2, frameH - 2,frame->invert);
-        }
-      }
-      if (frame->bitmap) {
-
-        if (frame->bitmapW <= frameW && frame->bitmapH <= frameH) {
-
-          const uint16_t bitColor = frame->invert ? GxEPD_WHITE : GxEPD_BLACK;
-          if (frame->bitmapW <= frameW && frame->bitmapH <= frameH) {
-              int x = frame->left + (frameW - frame->bitmapW) / 2;
-              int y = frame->top  + (frameH - frame->bitmapH) / 2;
-              display.drawBitmap(x, y, frame->bitmap, frame->bitmapW, frame->bitmapH, bitColor);
-          }
-
-        }
-
-        continue;
-      }
-      const int lineStride = EINK().getFontHeight() + EINK().getLineSpacing();
-
-      frame->maxLines = (lineStride > 1) ? (frameH / lineStride) - 1 : 0;
-      if (frame->maxLines <= 0) continue;
-
-      const long total  = frame->source ? (long)frame->source->size() : 0L;
-      clampScroll(*frame);
-
-      if (frame == CurrentFrameState && frame->choice >= 0) {
-        ensureChoiceVisible(*frame);
-      }
-      // initialize lastTotal on first draw
-      if (frame->lastTotal < 0) frame->lastTotal = total;
-
-      // remember if user was pinned to bottom before we adjust
-      const bool wasPinnedToBottom = (frame->scroll == 0);
+  // initialize lastTotal on first draw
+  if (frame.lastTotal < 0) frame.lastTotal = total;
 
-      // if maxLines shrank or list shrank, clamp scroll
-      clampScroll(*frame);
+  // remember if user was pinned to bottom before we adjust
+  const bool wasPinnedToBottom = (frame.scroll == 0);
 
-      // if user is at bottom, keep them there when lines grow
-      if (wasPinnedToBottom) frame->scroll = 0;
+  // if maxLines shrank or list shrank, clamp scroll
+  clampScroll(frame);
 
-      // update last seen count
-      frame->lastTotal = total;
-      long startLine = 0, endLine = 0;
-      // now get the visible range with the reconciled values
+  // if user is at bottom, keep them there when lines grow
+  if (wasPinnedToBottom) frame.scroll = 0;
 
+  // update last seen count
+  frame.lastTotal = total;
 
-      const int maxTextWidth = frameW;
-      int outLine = 0;
-      getVisibleRange(frame, total, startLine, endLine); 
-      // force the visible window to the selected line when only one line fits
-      if (frame->maxLines <= 1 && frame->choice >= 0 && frame->choice < total) {
-        startLine = frame->choice;
-        endLine   = frame->choice + 1; 
-      }
-      for (long line = startLine; line < endLine; ++line) {
-        LineView lv = frame->source->line(line);
-        size_t effLen = trimCRLF(lv.ptr, lv.len);
-        if (effLen == 0) { ++outLine; continue; }
+  // now get the visible range with the reconciled values
+  getVisibleRange(&frame, total, st.start, st.end);
+  // force the visible window to the selected line when only one line fits
+  if (frame.maxLines <= 1 && frame.choice >= 0 && frame.choice < total) {
+    st.start = frame.choice;
+    st.end   = frame.choice + 1;
+  }
 
-        const bool right  = (lv.flags & LF_RIGHT)  != 0;
-        const bool center = (lv.flags & LF_CENTER) != 0;
+  st.version = frame.source->version();
+  st.total   = total;
+  frame.wrap.use(frame.source, st.version, total, area.w, font);
+}
+// FIND THE ROWS A VISIBLE SOURCE LINE IS DRAWN ON !!
+bool lineRows(Frame& frame, const FontMetrics& fm, long line, int& first, int& count) {
+  int row = 0;
+  for (long l = frame.next.start; l < frame.next.end; ++l) {
+    LineView lv = frameLine(frame.source, l);
+    const uint16_t* ends;
+    int n = lv.len ? (int)frame.wrap.slices(l, lv.ptr, lv.len, fm, ends) : 1;
+    if (l == line) {
+      first = row;
+      count = n;
+      return true;
+    }
+    row += n;
+  }
+  return false;
+}
+// ADD THE PARTS OF FRAME THAT CHANGED SINCE IT WAS DRAWN !!
+void addFrameDirty(std::vector<DirtyRect>& dirty, Frame& frame, const FontMetrics& fm, bool doFull_) {
+  // a frame that moved or shrank leaves its old area behind
+  const FrameState& was = frame.shown;
+  if (frame.drawn && (was.left != frame.left || was.right != frame.right ||
+                      was.top != frame.top || was.bottom != frame.bottom)) {
+    addDirtyRect(dirty, { was.left, was.top, display.width() - was.left - was.right,
+                          display.height() - was.top - was.bottom },
+                 FRAME_MAX_WINDOWS, display.height());
+  }
 
-        const bool isSelectedLine = (frame == CurrentFrameState) && (frame->choice == line);
-        bool firstSlice = true;
+  const DirtyRect area = frameRect(frame);
+  if (area.w <= 0 || area.h <= 0) return;
 
-        size_t pos = 0;
-        while (pos < effLen) {
-          size_t take = sliceThatFits(lv.ptr + pos, effLen - pos, maxTextWidth);
-          if (take == 0) break;
+  if (doFull_ || !frame.drawn || !frame.next.sameLayout(frame.shown)) {
+    addDirtyRect(dirty, area, FRAME_MAX_WINDOWS, display.height());
+    return;
+  }
+  if (frame.next.choice == frame.shown.choice || !frame.source) return;
+
+  // only the selection moved: redraw the rows of the old and the new choice
+  const int lineStride = EINK().getFontHeight() + EINK().getLineSpacing();
+  for (int choice : { frame.shown.choice, frame.next.choice }) {
+    int first, count;
+    if (choice < 0 || !lineRows(frame, fm, choice, first, count)) continue;
+    addDirtyRect(dirty, { area.x, frame.top + first * lineStride - FRAME_ROW_PAD,
+                          area.w, count * lineStride + 2 * FRAME_ROW_PAD },
+                 FRAME_MAX_WINDOWS, display.height());
+  }
+}
+// DRAW ONE FRAME AS LAID OUT BY layoutFrame(), TEXT FROM src (THE SOURCE OR A SNAPSHOT OF IT) !!
+void drawFrame(Frame& frame, const TextSource* src, const FontMetrics& fm, bool doFull_) {
+  const DirtyRect area = frameRect(frame);
+  const int frameW = area.w;
+  const int frameH = area.h;
+
+  // if frame overlaps or is inverted, fill box with proper color
+  if (frame.invert || frame.overlap) {
+    display.fillRect(frame.left, frame.top, frameW, frameH,
+                    frame.invert ? GxEPD_BLACK : GxEPD_WHITE);
+  }
 
-          String toPrint;
-          if (right)       toPrint = "~R~";
-          else if (center) toPrint = "~C~";
+  if (frame.box) {
+    if (frameW > 2 && frameH > 2) {
+      drawFrameBox(frame.left + 1, frame.top + 1, frameW - 2, frameH - 2,frame.invert);
+    }
+  }
+  if (frame.bitmap) {
+    const uint16_t bitColor = frame.invert ? GxEPD_WHITE : GxEPD_BLACK;
+    if (frame.bitmapW <= frameW && frame.bitmapH <= frameH) {
+        int x = frame.left + (frameW - frame.bitmapW) / 2;
+        int y = frame.top  + (frameH - frame.bitmapH) / 2;
+        display.drawBitmap(x, y, frame.bitmap, frame.bitmapW, frame.bitmapH, bitColor);
+    }
+    return;
+  }
+  if (frame.maxLines <= 0) return;
+
+  int outLine = 0;
+  for (long line = frame.next.start; line < frame.next.end; ++line) {
+    LineView lv = frameLine(src, line);
+    if (lv.len == 0) { ++outLine; continue; }
+
+    // the selection marker goes after the first slice
+    uint8_t flags = lv.flags & (LF_RIGHT | LF_CENTER);
+    if (frame.next.current && frame.choice == line) flags |= LF_SELECTED;
+
+    // slices are measured once, then come from the frame's wrap cache
+    const uint16_t* ends;
+    const size_t slices = frame.wrap.slices(line, lv.ptr, lv.len, fm, ends);
+    size_t pos = 0;
+    for (size_t k = 0; k < slices; ++k) {
+      // draw straight from the source with the current visual row index
+      drawLineInFrame(lv.ptr + pos, ends[k] - pos, flags, outLine++, frame, fm, false);
+
+      pos = ends[k];
+      flags &= ~LF_SELECTED;
+    }
+  }
+}
+// DRAW WHAT CHANGED IN THE FRAMES, EACH CHANGED AREA IN ITS OWN PARTIAL WINDOW
+void einkFramesDynamic(std::vector<Frame*> &frames, bool doFull_) {
+  if (frames.empty()) return;
 
+  EINK().setTXTFont(EINK().getCurrentFont());
+  const GFXfont* font = EINK().getCurrentFont();
+  const FontMetrics& fm = fontMetrics(font);
 
+  // sources other tasks push to stay put while they're laid out and copied
+  for (Frame* frame : frames) {
+    if (frame && frame->source) frame->source->lock();
+  }
 
-          toPrint.concat(String(lv.ptr + pos).substring(0, take));
+  // kept between calls so a redraw doesn't allocate
+  static std::vector<DirtyRect> dirty;
+  static std::vector<SnapshotSource> visible;  // lines each frame draws
+  dirty.clear();
+  if (visible.size() < frames.size()) visible.resize(frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    Frame* frame = frames[i];
+    if (!frame || (!frame->source && !frame->bitmap)) continue;
+    layoutFrame(*frame, font);
+    addFrameDirty(dirty, *frame, fm, doFull_);
+    if (frame->source) visible[i].take(*frame->source, frame->next.start, frame->next.end);
+  }
 
-          if (isSelectedLine && firstSlice) {
-            toPrint = toPrint + "<";
-          }
-          // draw with the current visual row index
-          drawLineInFrame(toPrint, outLine++, *frame, 0, false,!doFull_);
+  // pushing the panel blocks for a refresh, pushes to the sources don't wait for it
+  for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+    if (*it && (*it)->source) (*it)->source->unlock();
+  }
 
-          pos += take;
-          firstSlice = false;
-        }
+  for (const DirtyRect& window : dirty) {
+    display.setPartialWindow(window.x, window.y, window.w, window.h);
+    display.firstPage();
+    do {
+      if (doFull_) {
+        display.fillRect(window.x, window.y, window.w, window.h, GxEPD_WHITE);
       }
-   
+      // frames behind or beside the change are drawn too, the window clips them
+      for (size_t i = 0; i < frames.size(); ++i) {
+        Frame* frame = frames[i];
+        if (!frame || (!frame->source && !frame->bitmap)) continue;
+        if (frameRect(*frame).overlaps(window)) drawFrame(*frame, &visible[i], fm, doFull_);
       }
-    //Serial.println("Stopped Drawing Text!");
-  } while (display.nextPage());
-    //Serial.println("Done drawing frames!");
+    } while (display.nextPage());
+  }
+
+  for (Frame* frame : frames) {
+    if (!frame || (!frame->source && !frame->bitmap)) continue;
+    frame->shown = frame->next;
+    frame->drawn = true;
+  }
 }
 // DRAW BOX AROUND FRAME !!
 void drawFrameBox(int usableX, int usableY, int usableWidth, int usableHeight,bool invert) {
@@ -368,26 +413,22 @@ void drawFrameBox(int usableX, int usableY, int usableWidth, int usableHeight,bo
     display.drawFastVLine(usableX + usableWidth - 1, usableY, usableHeight, GxEPD_BLACK); // Right
   }
 }
-// DRAW SINGLE LINE IN FRAME -- NOTE: remove ~C~ and ~R~ with switch to lineview flags
-void drawLineInFrame(String &srcLine, int lineIndex, Frame &frame, int usableY, bool clearLine, bool isPartial) {
-    if (srcLine.length() == 0) return;
-    // get alignment and remove alignment marker
-    String line = srcLine;
-    bool rightAlign  = line.startsWith("~R~");
-    bool centerAlign = line.startsWith("~C~");
-    if (rightAlign || centerAlign) line.remove(0, 3);
-    int16_t x1, y1;
-    uint16_t lineWidth, lineHeight;
-    display.getTextBounds(line, 0, 0, &x1, &y1, &lineWidth, &lineHeight);
-    int cursorX = computeCursorX(frame, rightAlign, centerAlign, x1, lineWidth);
+// DRAW SINGLE LINE IN FRAME FROM ITS CHARS, ALIGNMENT AND SELECTION COME FROM LineFlags !!
+void drawLineInFrame(const char* s, size_t len, uint8_t flags, int lineIndex, Frame &frame,
+                     const FontMetrics& fm, bool clearLine) {
+    const bool selected = (flags & LF_SELECTED) != 0;
+    if (len == 0 && !selected) return;
+    // measure the chars and the selection marker where they are
+    const TextBounds b = fm.bounds(s, len, "<", selected ? 1 : 0);
+    int cursorX = computeCursorX(frame, flags & LF_RIGHT, flags & LF_CENTER, b.x1, b.w);
     // set yRaw to frame top + spaces taken by all previous lines
     int yRaw = frame.top + lineIndex * (EINK().getFontHeight() + EINK().getLineSpacing());
     // set the cursor y so that the top of the font does not get cut off by the top of the frame
-    int yDraw = yRaw + EINK().getFontHeight() - y1/2; 
+    int yDraw = yRaw + EINK().getFontHeight() - b.y1/2; 
     // if clear line, clear box the size of the frame at the current line
     if (clearLine) {
         int yClear = alignDown8(yRaw);
-        int clearHeight = alignUp8(EINK().getFontHeight() + EINK().getLineSpacing() + abs(y1));
+        int clearHeight = alignUp8(EINK().getFontHeight() + EINK().getLineSpacing() + abs(b.y1));
         display.fillRect(frame.left, yClear,
                          display.width() - frame.left - frame.right,
                          clearHeight,
@@ -395,7 +436,19 @@ void drawLineInFrame(String &srcLine, int lineIndex, Frame &frame, int usableY,
     }
     display.setCursor(cursorX, yDraw);
     frame.invert ? display.setTextColor(GxEPD_WHITE) : display.setTextColor(GxEPD_BLACK);
-    display.print(line);
+    display.write((const uint8_t*)s, len);
+    if (selected) display.write('<');
+}
+// DRAW SINGLE LINE IN FRAME FROM A STRING, A LEADING ~C~ OR ~R~ SETS THE ALIGNMENT !!
+void drawLineInFrame(String &srcLine, int lineIndex, Frame &frame, int usableY, bool clearLine, bool isPartial) {
+    if (srcLine.length() == 0) return;
+    const char* s = srcLine.c_str();
+    size_t len = srcLine.length();
+    uint8_t flags = LF_NONE;
+    if (srcLine.startsWith("~R~"))      flags = LF_RIGHT;
+    else if (srcLine.startsWith("~C~")) flags = LF_CENTER;
+    if (flags) { s += 3; len -= 3; }
+    drawLineInFrame(s, len, flags, lineIndex, frame, fontMetrics(EINK().getCurrentFont()), clearLine);
 }
 
 ///////////////////////////// FRAME SCROLL FUNCTIONS
@@ -455,6 +508,7 @@ void updateScrollFromTouch_Frame() {
         }
     }
   }
+  TOUCH().sampled(newTouch, TOUCH().getLastTouch() != -1);
 }
 // UPDATE CURRENT FRAME SCROLL
 void updateScroll(Frame *currentFrameState,int prevScroll,int currentScroll, bool reset){
@@ -471,7 +525,7 @@ void updateScroll(Frame *currentFrameState,int prevScroll,int currentScroll, boo
 ///////////////////////////// FRAME OLED FUNCTIONS
 void oledScrollFrame() {
   // CLEAR DISPLAY
-  u8g2.clearBuffer();
+  OLED().beginFrame();
   // draw background
   if (CurrentFrameState->choice == -1) u8g2.drawXBMP(0, 0, 128, 32, scrolloled0);
 
@@ -546,7 +600,7 @@ void oledScrollFrame() {
     u8g2.drawStr(0, 24, lineNumStr.c_str());
   }
   // send buffer
-  u8g2.sendBuffer();
+  OLED().commit();
 }
 
 ///////////////////////////// TEXT POSITION FUNCTIONS
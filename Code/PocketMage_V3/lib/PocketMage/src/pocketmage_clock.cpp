@@ -56,8 +56,7 @@ void PocketmageCLOCK::setTimeFromString(String timeStr) {
   int minutes = timeStr.substring(3, 5).toInt();
 
   if (hours < 0 || hours > 23 || minutes < 0 || minutes > 59) {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
   }
 
@@ -10,9 +10,10 @@
 
 static constexpr const char* tag = "EINK";
 
-GxEPD2_BW<GxEPD2_310_GDEQ031T10, GxEPD2_310_GDEQ031T10::HEIGHT> display(GxEPD2_310_GDEQ031T10(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+DisplayT display(PanelT(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
 
 TaskHandle_t einkHandlerTaskHandle = NULL; // E-Ink handler task
+TaskHandle_t einkRefreshTaskHandle = NULL; // Sends frames to the panel
 
 // Fast full update flag for e-ink
 volatile bool GxEPD2_310_GDEQ031T10::useFastFullUpdate = true;
@@ -23,39 +24,284 @@ static PocketmageEink pm_eink(display);
 // Access for other apps 
 PocketmageEink& EINK() { return pm_eink; }
 
+// ===================== refresh task =====================
+// refresh() copies the frame into the panel copy of the shadow and hands it to
+// einkRefreshTask, which sends it and sleeps through the waveform until EPD_BUSY changes.
+// The e-ink task draws the next frame meanwhile. panelFree is taken by whoever starts a
+// push and given back by the refresh task once the panel is done.
+struct RefreshJob {
+  bool      full;                         // full update, or the partial windows below
+  bool      fast;                         // fast full update waveform
+  uint8_t   passes;                       // extra partial passes (multiPassRefresh)
+  uint8_t   count;
+  DirtyRect windows[DIFF_MAX_WINDOWS];    // native panel coordinates
+  uint32_t  ticket;
+};
+static RefreshJob        job;
+static SemaphoreHandle_t panelFree = NULL;
+static SemaphoreHandle_t jobReady  = NULL;
+static SemaphoreHandle_t busyEdge  = NULL;
+static volatile uint32_t started   = 0;
+static volatile uint32_t finished  = 0;
+static constexpr uint32_t busyPollMs = 20; // recheck EPD_BUSY even without an edge
+
+void einkLockPanel()   { if (panelFree) xSemaphoreTake(panelFree, portMAX_DELAY); }
+void einkUnlockPanel() { if (panelFree) xSemaphoreGive(panelFree); }
+static bool tryLockPanel() { return !panelFree || xSemaphoreTake(panelFree, 0) == pdTRUE; }
+
+static void IRAM_ATTR busyEdgeISR() {
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(busyEdge, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+// GxEPD2 calls this while EPD_BUSY says the panel is working
+static void waitForBusyEdge(const void*) {
+  xSemaphoreTake(busyEdge, pdMS_TO_TICKS(busyPollMs));
+}
+
+// Same steps as GxEPD2_BW::display() and displayWindow(), from the panel copy
+static void runJob(const RefreshJob& j) {
+  auto& epd = display.epd2;
+  const uint8_t* frame = display.shadow.shownBytes();
+  const int16_t W = PanelT::WIDTH, H = PanelT::HEIGHT;
+
+  if (j.full) {
+    PanelT::useFastFullUpdate = j.fast;
+    epd.writeImageForFullRefresh(frame, 0, 0, W, H, true);
+    epd.refresh(false);
+    if (epd.hasFastPartialUpdate) epd.writeImageAgain(frame, 0, 0, W, H, true);
+    epd.powerOff();
+    for (int i = 0; i < j.passes; i++) {
+      vTaskDelay(pdMS_TO_TICKS(250));
+      epd.writeImage(frame, 0, 0, W, H, true);
+      epd.refresh(true);
+      if (epd.hasFastPartialUpdate) epd.writeImageAgain(frame, 0, 0, W, H, true);
+    }
+    if (j.passes) vTaskDelay(pdMS_TO_TICKS(100));
+    epd.hibernate();
+    return;
+  }
+
+  for (int i = 0; i < j.count; i++) {
+    const DirtyRect& r = j.windows[i];
+    epd.writeImagePart(frame, r.x, r.y, W, H, r.x, r.y, r.w, r.h, true);
+    epd.refresh(r.x, r.y, r.w, r.h);
+    if (epd.hasFastPartialUpdate) epd.writeImagePartAgain(frame, r.x, r.y, W, H, r.x, r.y, r.w, r.h, true);
+  }
+  epd.powerOff();
+}
+
+// Called with the panel locked, the refresh task unlocks it when done
+static uint32_t startJob() {
+  job.ticket = ++started;
+  if (jobReady) {
+    xSemaphoreGive(jobReady);
+  } else {
+    runJob(job);
+    finished = job.ticket;
+    einkUnlockPanel();
+  }
+  return job.ticket;
+}
+
+static void einkRefreshTask(void* parameter) {
+  for (;;) {
+    xSemaphoreTake(jobReady, portMAX_DELAY);
+    runJob(job);
+    finished = job.ticket;
+    xSemaphoreGive(panelFree);
+    EINK().wake();  // held windows and queued frames can go out now
+  }
+}
+
 // ===================== main functions =====================
-void PocketmageEink::refresh() {
-  // USE A SLOW FULL UPDATE EVERY N FAST UPDATES OR WHEN SPECIFIED
-  if ((partialCounter_ >= fullRefreshAfter_) || forceSlowFullUpdate_) {
-    forceSlowFullUpdate_ = false;
-    partialCounter_ = 0;
-    setFastFullRefresh(false);
-  } 
-  // OTHERWISE USE A FAST FULL UPDATE
-  else {
-    setFastFullRefresh(true);
-    partialCounter_++;
+static const char* hintName(RefreshHint hint) {
+  switch (hint) {
+    case REFRESH_IMAGE: return "image";
+    case REFRESH_MENU:  return "menu";
+    default:            return "text";
   }
+}
+// Starts sending the frame in the buffer and clears the buffer for the next one. Returns a
+// ticket for waitRefresh(), 0 when nothing had changed.
+uint32_t PocketmageEink::refresh(RefreshHint hint) {
+  // WAIT FOR THE PREVIOUS FRAME, ITS WINDOWS STILL HELD ARE PART OF THIS ONE
+  einkLockPanel();
+  heldWindows_.clear();
 
-  display_.display(false);
+  // COMPARE THE NEW FRAME WITH WHAT THE PANEL SHOWS (UNKNOWN AFTER BOOT, OR WHEN THE BUFFER
+  // ONLY HOLDS A PARTIAL WINDOW)
+  static std::vector<DirtyRect> windows;
+  windows.clear();
+  uint32_t changed = RefreshScheduler::UNKNOWN;
+  if (display_.shadow.known() && !display_.shadow.partialMode()) {
+    changed = display_.shadow.diff(windows, DIFF_MAX_WINDOWS);
+  }
+  hint = scheduler_.hintWith(hint);
+  uint32_t ticket = 0;
+
+  // NOTHING CHANGED, NOTHING TO SEND
+  if (changed == 0 && !forceSlowFullUpdate_) {
+    ESP_LOGD(tag, "refresh skipped, %s unchanged", hintName(hint));
+    scheduler_.skip();
+    einkUnlockPanel();
+  }
+  // SMALL CHANGES GO OUT AS PARTIAL WINDOWS
+  else if (changed != RefreshScheduler::UNKNOWN && !forceSlowFullUpdate_ &&
+           hint != REFRESH_IMAGE && scheduler_.partialAllowed() &&
+           dirtyArea(windows) <= (long)RefreshScheduler::SCREEN_PX / 2) {
+    const uint16_t coalesced = scheduler_.take();
+    scheduler_.partial(changed);
+    ESP_LOGD(tag, "%u px changed, %u window(s), %s, %u coalesced", (unsigned)changed,
+             (unsigned)windows.size(), hintName(hint), (unsigned)coalesced);
+    job.full  = false;
+    job.count = 0;
+    for (const DirtyRect& r : windows) {
+      display_.shadow.pushRegion(r.x, r.y, r.w, r.h);
+      job.windows[job.count++] = display_.shadow.nativeRect(r);
+    }
+    ticket = startJob();
+  }
+  // SLOW FULL UPDATE ONCE FAST UPDATES HAVE TOGGLED ENOUGH PIXELS OR WHEN SPECIFIED,
+  // OTHERWISE A FAST FULL UPDATE
+  else {
+    RefreshDecision d = scheduler_.full(hint, forceSlowFullUpdate_, changed);
+    forceSlowFullUpdate_ = false;
+    ESP_LOGD(tag, "%s full refresh, %s, ghost %u/%u px, %u coalesced", d.slow ? "slow" : "fast",
+             hintName(d.hint), (unsigned)d.ghost, (unsigned)d.budget, (unsigned)d.coalesced);
+    display_.shadow.pushAll();
+    job.full   = true;
+    job.fast   = !d.slow;
+    job.passes = 0;
+    ticket = startJob();
+  }
 
   display_.setFullWindow();
   display_.fillScreen(GxEPD_WHITE);
-  display_.hibernate();
-}
-void PocketmageEink::multiPassRefresh(int passes) {
-  display_.display(false);
-  if (passes > 0) {
-    for (int i = 0; i < passes; i++) {
-      delay(250);
-      display_.display(true);
+  return ticket;
+}
+// For screens redrawn from scratch: requests made while the app is still settling (state
+// changes, key repeats) become one refresh of the last frame. The frame stays in the buffer
+// until serviceRefresh() sends it from the e-ink task.
+void PocketmageEink::requestRefresh(RefreshHint hint) {
+  scheduler_.request(hint, millis());
+  wake();
+}
+// Sends what was held back while the panel was busy: queued frames once they're quiet,
+// window refreshes as soon as the panel is free
+void PocketmageEink::serviceRefresh() {
+  if (refreshBusy()) return;
+  if (!heldWindows_.empty()) {
+    static std::vector<DirtyRect> clips;
+    clips.clear();
+    clips.swap(heldWindows_);
+    pushWindows_(clips, false);
+  }
+  if (scheduler_.due(millis(), REFRESH_COALESCE_MS, REFRESH_MAX_WAIT_MS)) refresh();
+}
+// Wakes the e-ink task, for a new frame to draw or something serviceRefresh() held back
+void PocketmageEink::wake() {
+  if (einkHandlerTaskHandle && xTaskGetCurrentTaskHandle() != einkHandlerTaskHandle) {
+    xTaskNotifyGive(einkHandlerTaskHandle);
+  }
+}
+// E-ink task only: sleeps until wake(), or until a queued frame is due. While the panel is
+// busy the refresh task wakes it when it's done.
+void PocketmageEink::waitWork() {
+  TickType_t wait = portMAX_DELAY;
+  if (!refreshBusy() && scheduler_.pending()) {
+    wait = pdMS_TO_TICKS(scheduler_.dueIn(millis(), REFRESH_COALESCE_MS, REFRESH_MAX_WAIT_MS));
+  }
+  ulTaskNotifyTake(pdTRUE, wait);
+}
+// Partial update of one rectangle of the full-window buffer. The buffer is left as it is so
+// several windows can be pushed from the same frame. While the panel is busy the window is
+// held and merged with later ones.
+void PocketmageEink::refreshWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  // A queued frame is under this window, send what changed anywhere on it
+  if (scheduler_.pending()) {
+    scheduler_.take();
+    x = 0;
+    y = 0;
+    w = display_.width();
+    h = display_.height();
+  }
+
+  // Rotated panel: screen y runs along the controller's 8 px byte columns
+  int16_t top    = y - (y % 8);
+  int16_t bottom = y + h;
+  if (bottom % 8) bottom += 8 - (bottom % 8);
+  if (bottom > display_.height()) bottom = display_.height();
+  if (bottom <= top) return;
+
+  static std::vector<DirtyRect> clips;
+  clips.assign(1, DirtyRect{x, top, w, bottom - top});
+  pushWindows_(clips, false);
+}
+// Sends only the parts of the clips that changed, if anything did. Returns false if the
+// panel was busy and wait is false, the clips are then held for serviceRefresh()
+bool PocketmageEink::pushWindows_(const std::vector<DirtyRect>& clips, bool wait) {
+  if (wait) {
+    einkLockPanel();
+  } else if (!tryLockPanel()) {
+    for (const DirtyRect& c : clips) {
+      addDirtyRect(heldWindows_, c, DIFF_MAX_WINDOWS, display_.height());
     }
+    return false;
+  }
+
+  static std::vector<DirtyRect> windows;
+  windows.clear();
+  uint32_t changed = 0;
+  if (display_.shadow.known() && !display_.shadow.partialMode()) {
+    for (const DirtyRect& c : clips) changed += display_.shadow.diff(c, windows, DIFF_MAX_WINDOWS);
+  } else {
+    for (const DirtyRect& c : clips) addDirtyRect(windows, c, DIFF_MAX_WINDOWS, display_.height());
+    changed = dirtyArea(windows);
+  }
+  if (!changed) {
+    einkUnlockPanel();
+    return true;
+  }
+
+  scheduler_.partial(changed);
+  job.full  = false;
+  job.count = 0;
+  for (const DirtyRect& r : windows) {
+    display_.shadow.pushRegion(r.x, r.y, r.w, r.h);
+    job.windows[job.count++] = display_.shadow.nativeRect(r);
   }
+  startJob();
+  return true;
+}
+// True while partial updates haven't built up enough ghosting to need a full refresh
+bool PocketmageEink::partialRefreshAllowed() const {
+  return !forceSlowFullUpdate_ && scheduler_.partialAllowed();
+}
+bool PocketmageEink::refreshBusy() const { return finished != started; }
+// Blocks until the refresh with this ticket is on the panel, false on timeout
+bool PocketmageEink::waitRefresh(uint32_t ticket, uint32_t timeoutMs) {
+  if (!ticket) ticket = started;
+  if ((int32_t)(finished - ticket) >= 0 || !panelFree) return true;
+  if (xSemaphoreTake(panelFree, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) return false;
+  xSemaphoreGive(panelFree);
+  return (int32_t)(finished - ticket) >= 0;
+}
+// Full update followed by partial passes that settle the image, run by the refresh task
+// rather than delaying the caller
+uint32_t PocketmageEink::multiPassRefresh(int passes) {
+  einkLockPanel();
+  scheduler_.cleaned();
+  heldWindows_.clear();
+  display_.shadow.pushAll();
+  job.full   = true;
+  job.fast   = PanelT::useFastFullUpdate;
+  job.passes = passes > 0 ? passes : 0;
+  const uint32_t ticket = startJob();
 
-  delay(100);
   display_.setFullWindow();
   display_.fillScreen(GxEPD_WHITE);
-  display_.hibernate();
+  return ticket;
 }
 void PocketmageEink::setFastFullRefresh(bool setting) {
   PanelT::useFastFullUpdate = setting;
@@ -145,6 +391,22 @@ void PocketmageEink::einkTextDynamic(bool doFull, bool noRefresh) {
 }
 
 void PocketmageEink::resetDisplay(bool clearScreen, uint16_t color) {
+  // A queued frame is either replaced by the new one or drawn over, send it in the latter
+  // case. Held windows are sent either way, the next frame may not cover them
+  if (scheduler_.pending()) {
+    if (clearScreen) {
+      scheduler_.drop();
+    } else {
+      scheduler_.take();
+      heldWindows_.push_back({0, 0, display_.width(), display_.height()});
+    }
+  }
+  if (!heldWindows_.empty()) {
+    static std::vector<DirtyRect> clips;
+    clips.clear();
+    clips.swap(heldWindows_);
+    pushWindows_(clips, true);
+  }
   display_.setRotation(3);
   display_.setFullWindow();
   if (clearScreen) display_.fillScreen(color);
@@ -169,6 +431,12 @@ int PocketmageEink::countLines(const String& input, size_t maxLineLength) {
   return lineCounter;
 }
 void PocketmageEink::forceSlowFullUpdate(bool force)            { forceSlowFullUpdate_ = force; }
+// Slow full update after about N fast text screens worth of toggled pixels
+void PocketmageEink::setFullRefreshAfter(uint8_t fullRefreshAfter) {
+  fullRefreshAfter_ = fullRefreshAfter;
+  scheduler_.setBudgets(fullRefreshAfter_ * RefreshScheduler::estimate(REFRESH_TEXT),
+                        PARTIAL_WINDOW_REFRESHES * display_.width() * PARTIAL_WINDOW_ROW);
+}
 
 // Setup for Eink Class
 void setupEink() {
@@ -177,6 +445,24 @@ void setupEink() {
   display.setFullWindow();
   display.setTextColor(GxEPD_BLACK);
   EINK().setTXTFont(&FreeMonoBold9pt7b); // default font, computeFontMetrics_()
+  EINK().setFullRefreshAfter(FULL_REFRESH_AFTER); // ghosting budgets
+
+  // Refreshes run on their own task and sleep until EPD_BUSY changes
+  panelFree = xSemaphoreCreateBinary();
+  jobReady  = xSemaphoreCreateBinary();
+  busyEdge  = xSemaphoreCreateBinary();
+  xSemaphoreGive(panelFree);
+  display.epd2.setBusyCallback(waitForBusyEdge);
+  attachInterrupt(digitalPinToInterrupt(EPD_BUSY), busyEdgeISR, CHANGE);
+  xTaskCreatePinnedToCore(
+    einkRefreshTask,         // Function name
+    "einkRefreshTask",       // Task name
+    4096,                    // Stack size
+    NULL,                    // Parameters
+    1,                       // Priority
+    &einkRefreshTaskHandle,  // Task handle
+    0                        // Core ID
+  );
 
   xTaskCreatePinnedToCore(
     einkHandler,             // Function name
@@ -16,13 +16,16 @@
 #include "hid_host.h"
 #include "hid_usage_keyboard.h"
 #include "hid_usage_mouse.h"
+#include <keyEventRing.h>
 
 static constexpr const char* TAG = "KB";
 /* GPIO Pin number for quit from example logic */
 #define APP_QUIT_PIN                GPIO_NUM_0
-#define MAX_USB_KB_CHARS 64
-
-static char usb_kb_chars[MAX_USB_KB_CHARS] = {0};  // unused slots initialized to '\0'
+// HID callback task -> updateKeypress(), presses and releases in order
+static KeyEventRing<KB_USB_EVENTS> usbKeyEvents;
+static uint32_t usbKeyDropsLogged = 0;
+// Wakes the input loop, see inputEvents.h
+static QueueHandle_t inputQueue = NULL;
 
 QueueHandle_t hid_host_event_queue;
 bool user_shutdown = false;
@@ -30,34 +33,6 @@ static bool HIDInitialized = false;
 static TaskHandle_t usb_lib_task_handle = NULL;  // MOD: store handle to usb_lib_task
 static TaskHandle_t hid_host_task_handle = NULL; // MOD: store handle to hid_host_task
 
-// Adds a character to the first available slot (if not full)
-void push_USB_char(char c) {
-    for (int i = 0; i < MAX_USB_KB_CHARS; i++) {
-        if (usb_kb_chars[i] == '\0') {  // '\0' means unused
-            usb_kb_chars[i] = c;
-            return;  // stop after adding one char
-        }
-    }
-    // Array full — do nothing
-}
-
-// Removes and returns the first character (FIFO)
-char pop_USB_char() {
-    char c = '\0';  // default return value (nothing to pop)
-    if (usb_kb_chars[0] == '\0') return c;  // empty buffer
-
-    c = usb_kb_chars[0];
-
-    // Shift all remaining characters left by one
-    for (int i = 1; i < MAX_USB_KB_CHARS; i++) {
-        usb_kb_chars[i - 1] = usb_kb_chars[i];
-    }
-
-    usb_kb_chars[MAX_USB_KB_CHARS - 1] = '\0';  // mark last slot unused
-    return c;
-}
-
-
 /**
  * @brief HID Host event
  *
@@ -215,20 +190,6 @@ static inline bool hid_keyboard_get_char(uint8_t modifier, uint8_t key_code,
   return true;
 }
 
-/**
- * @brief HID Keyboard print char symbol
- *
- * @param[in] key_char  Keyboard char to stdout
- */
-static inline void hid_keyboard_print_char(unsigned int key_char) {
-  if (!!key_char) {
-    //putchar(key_char);
-    //OLED().oledWord(String(key_char));
-    push_USB_char(key_char);
-    fflush(stdout);
-  }
-}
-
 /**
  * @brief Key Event. Key event with the key code, state and modifier.
  *
@@ -236,17 +197,12 @@ static inline void hid_keyboard_print_char(unsigned int key_char) {
  *
  */
 static void key_event_callback(key_event_t *key_event) {
-  unsigned char key_char;
-
   hid_print_new_device_report_header(HID_PROTOCOL_KEYBOARD);
 
-  if (key_event->KEY_STATE_PRESSED == key_event->state) {
-    if (hid_keyboard_get_char(key_event->modifier, key_event->key_code,
-                              &key_char)) {
-
-      hid_keyboard_print_char(key_char);
-    }
-  }
+  // Translated on the loop side, a full ring counts the drop for updateKeypress() to log
+  usbKeyEvents.push({key_event->key_code, key_event->modifier,
+                     key_event->KEY_STATE_PRESSED == key_event->state, (uint32_t)millis()});
+  KB().postInput(INPUT_USB_KEY, key_event->key_code);
 }
 
 /**
@@ -290,7 +246,7 @@ static void hid_host_keyboard_report_callback(const uint8_t *const data,
     if (prev_keys[i] > HID_KEY_ERROR_UNDEFINED &&
         !key_found(kb_report->key, prev_keys[i], HID_KEYBOARD_KEY_MAX)) {
       key_event.key_code = prev_keys[i];
-      key_event.modifier = 0;
+      key_event.modifier = kb_report->modifier.val;
       key_event.state = key_event.KEY_STATE_RELEASED;
       key_event_callback(&key_event);
     }
@@ -684,18 +640,21 @@ Adafruit_TCA8418 keypad;
 // Initialization of kb class
 static PocketmageKB pm_kb(keypad);
 
-void IRAM_ATTR KB_irq_handler() { KB().setTCA8418Event(); }
+void IRAM_ATTR KB_irq_handler() {
+  KB().setTCA8418Event();
+  KB().postInputFromISR(INPUT_KEYPAD);
+}
 
 // Setup for keyboard class
 void setupKB(int KB_irq_pin) {
   if (!keypad.begin(TCA8418_DEFAULT_ADDR, &Wire)) {
     ESP_LOGE(TAG, "Error Initializing the Keyboard");
-    OLED().oledWord("Keyboard INIT Failed");
-    delay(1000);
+    OLED().toast("Keyboard INIT Failed", 1000);
     while (1);
   }
   keypad.matrix(4, 10);
   wireKB();
+  if (!inputQueue) inputQueue = xQueueCreate(INPUT_QUEUE_LEN, sizeof(InputEvent));
   attachInterrupt(digitalPinToInterrupt(KB_irq_pin), KB_irq_handler, FALLING);
   //keypad.flush();
   KB().setTCA8418Event();
@@ -713,15 +672,26 @@ PocketmageKB& KB() { return pm_kb; }
 
 // ===================== public functions =====================
 char PocketmageKB::updateKeypress() {
-  // Check for USB char
-  char USB_CHAR = pop_USB_char();
-  if (USB_CHAR != '\0') {
-    return USB_CHAR;
+  // Check for USB char: releases and keys without a char are skipped, one char per call
+  const uint32_t usbDrops = usbKeyEvents.dropped();
+  if (usbDrops != usbKeyDropsLogged) {
+    ESP_LOGW(TAG, "USB key ring full, %u events dropped", (unsigned)(usbDrops - usbKeyDropsLogged));
+    usbKeyDropsLogged = usbDrops;
+  }
+  KeyEvent usbKey;
+  while (usbKeyEvents.pop(usbKey)) {
+    tookKey_ = true;
+    unsigned char usbChar;
+    if (usbKey.pressed && hid_keyboard_get_char(usbKey.modifiers, usbKey.keyCode, &usbChar) &&
+        usbChar != '\0') {
+      return usbChar;
+    }
   }
 
   // Check for keypad char
   if (TCA8418_event_ == true) {
     int k = keypad_.getEvent();
+    if (k) tookKey_ = true;
     
     //  try to clear the IRQ flag
     //  if there are pending events it is not cleared
@@ -756,6 +726,46 @@ char PocketmageKB::updateKeypress() {
 
 }
 
+uint32_t PocketmageKB::usbDropped() const { return usbKeyEvents.dropped(); }
+
+void PocketmageKB::postInput(uint8_t source, uint8_t code) {
+  if (!inputQueue) return;
+  InputEvent e;
+  e.source = source;
+  e.code   = code;
+  e.ms     = millis();
+  // Full: the loop is awake already and finds the input where it was left
+  xQueueSend(inputQueue, &e, 0);
+}
+
+void IRAM_ATTR PocketmageKB::postInputFromISR(uint8_t source) {
+  if (!inputQueue) return;
+  InputEvent e;
+  e.source = source;
+  e.ms     = millis();
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(inputQueue, &e, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+bool PocketmageKB::waitInput() {
+  // Keep going without waiting while a burst of keys is still queued
+  pacer_.endPass(tookKey_ && (TCA8418_event_ || !usbKeyEvents.empty()));
+  tookKey_ = false;
+
+  bool got = false;
+  InputEvent e;
+  if (xQueueReceive(inputQueue, &e, pdMS_TO_TICKS(pacer_.waitMs(millis()))) == pdTRUE) {
+    // One pass for everything that came in meanwhile
+    do {
+      pacer_.seen(e.ms);
+    } while (xQueueReceive(inputQueue, &e, 0) == pdTRUE);
+    got = true;
+  }
+  pacer_.beginPass(millis());
+  return got;
+}
+
 void PocketmageKB::checkUSBKB() {
   // Check if USB Keyboard has been connected
   bool needBoost;
@@ -16,6 +16,17 @@ static PocketmageOled pm_oled(u8g2);
 // 256x32 SPI OLED display object
 U8G2_SSD1326_ER_256X32_F_4W_HW_SPI u8g2(U8G2_R2, OLED_CS, OLED_DC, OLED_RST);
 
+TaskHandle_t oledTaskHandle = NULL; // OLED compositor task
+
+// Held by whoever draws into the u8g2 buffer or talks to the panel: the compositor for
+// a frame, an app between beginFrame() and commit(). Recursive, so a frame can still
+// call setPowerSave()
+static SemaphoreHandle_t u8g2Lock = NULL;
+static void lockU8g2()   { if (u8g2Lock) xSemaphoreTakeRecursive(u8g2Lock, portMAX_DELAY); }
+static void unlockU8g2() { if (u8g2Lock) xSemaphoreGiveRecursive(u8g2Lock); }
+
+static void oledTask(void* parameter) { pm_oled.compose(); }
+
 // Setup for Oled Class
 void setupOled() {
   u8g2.begin();
@@ -23,6 +34,17 @@ void setupOled() {
   u8g2.setPowerSave(0);
   u8g2.clearBuffer();
   u8g2.sendBuffer();
+
+  u8g2Lock = xSemaphoreCreateRecursiveMutex();
+  xTaskCreatePinnedToCore(
+    oledTask,                // Function name
+    "oledTask",              // Task name
+    4096,                    // Stack size
+    NULL,                    // Parameters
+    tskIDLE_PRIORITY + 1,    // Priority
+    &oledTaskHandle,         // Task handle
+    1                        // Core ID
+  );
 }
 
 // oled object reference for other apps
@@ -30,71 +52,54 @@ PocketmageOled& OLED() { return pm_oled; }
 
 // ===================== public functions =====================
 void PocketmageOled::oledWord(String word, bool allowLarge, bool showInfo) {
-  u8g2_.clearBuffer();
-
-  if (showInfo) infoBar();
-
-  if (allowLarge) {
-    /*u8g2_.setFont(u8g2_font_ncenB24_tr);
-    if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-      u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16+12,word.c_str());
-      u8g2_.sendBuffer();
-      return;
-    }*/
-    u8g2_.setFont(u8g2_font_ncenB18_tr);
-    if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-      u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16+5,word.c_str());
-      u8g2_.sendBuffer();
-      return;
-    }
-  }
+  OledPost p;
+  p.layer = OLED_WORD;
+  p.flags = (allowLarge ? OLED_LARGE : 0) | (showInfo ? OLED_INFO : 0);
+  p.setText(word.c_str());
+  post(p);
+}
 
-  u8g2_.setFont(u8g2_font_ncenB14_tr);
-  if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16+3,word.c_str());
-    u8g2_.sendBuffer();
-    return;
-  }
+void PocketmageOled::toast(const String& msg, uint32_t ms, bool allowLarge) {
+  OledPost p;
+  p.layer = OLED_TOAST;
+  p.flags = OLED_INFO | (allowLarge ? OLED_LARGE : 0);
+  p.ms    = ms;
+  p.setText(msg.c_str());
+  post(p);
+}
 
-  u8g2_.setFont(u8g2_font_ncenB12_tr);
-  if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16+2,word.c_str());
-    u8g2_.sendBuffer();
-    return;
-  }
+void PocketmageOled::oledLine(String line, bool doProgressBar, String bottomMsg) {
+  OledPost p;
+  p.layer = OLED_LINE;
+  p.setText(line.c_str(), true);
+  p.setLabel(bottomMsg.c_str());
 
-  u8g2_.setFont(u8g2_font_ncenB10_tr);
-  if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16+1,word.c_str());
-    u8g2_.sendBuffer();
-    return;
+  // Progress along the e-ink line, measured here: the e-ink font belongs to the app
+  if (doProgressBar && line.length() > 0) {
+    const uint16_t charWidth = strWidth(line);
+    p.flags |= OLED_BAR;
+    p.value  = map(charWidth, 0, display.width()-5, 0, u8g2_.getDisplayWidth());
+    if (charWidth > ((display.width() - 5) * 0.8)) p.flags |= OLED_WARN;
   }
+  post(p);
+}
 
-  u8g2_.setFont(u8g2_font_ncenB08_tr);
-  if (u8g2_.getStrWidth(word.c_str()) < u8g2_.getDisplayWidth()) {
-    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()))/2,16,word.c_str());
-    u8g2_.sendBuffer();
-    return;
-  } else {
-    u8g2_.drawStr(u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word.c_str()),16,word.c_str());
-    u8g2_.sendBuffer();
-    return;
-  }
-  
+void PocketmageOled::progressBar(uint8_t percent, const String& caption) {
+  OledPost p;
+  p.layer = OLED_PROGRESS;
+  p.value = min(percent, (uint8_t)100);
+  p.setLabel(caption.c_str());
+  post(p);
 }
 
-void PocketmageOled::oledLine(String line, bool doProgressBar, String bottomMsg) {
-    uint8_t mcl = EINK().maxCharsPerLine();
-    uint8_t maxLength = mcl;
-    u8g2_.clearBuffer();
+void PocketmageOled::drawLine(const OledPost& p) {
+  const char* line      = p.text;
+  const char* bottomMsg = p.label;
+  u8g2_.clearBuffer();
 
   //PROGRESS BAR
-  if (doProgressBar && line.length() > 0) {
-    //uint8_t progress = map(line.length(), 0, maxLength, 0, 128);
-
-    const uint16_t charWidth = strWidth(line);
-
-    const uint8_t progress = map(charWidth, 0, display.width()-5, 0, u8g2_.getDisplayWidth());
+  if (p.flags & OLED_BAR) {
+    const uint8_t progress = min(p.value, (uint16_t)255);
 
     u8g2_.drawVLine(u8g2_.getDisplayWidth(), 0, 2);
     u8g2_.drawVLine(0, 0, 2);
@@ -103,7 +108,7 @@ void PocketmageOled::oledLine(String line, bool doProgressBar, String bottomMsg)
     u8g2_.drawHLine(0, 1, progress);
 
     // LINE END WARNING INDICATOR
-    if (charWidth > ((display.width() - 5) * 0.8)) {
+    if (p.flags & OLED_WARN) {
       if ((millis() / 400) % 2 == 0) {  // ON for 200ms, OFF for 200ms
         u8g2_.drawVLine(u8g2_.getDisplayWidth()-1, 8, 32-16);
         u8g2_.drawLine(u8g2_.getDisplayWidth()-1,15,u8g2_.getDisplayWidth()-4,12);
@@ -113,13 +118,13 @@ void PocketmageOled::oledLine(String line, bool doProgressBar, String bottomMsg)
   }
 
   // No bottom msg, show infobar
-  if (bottomMsg.length() == 0) {
+  if (bottomMsg[0] == '\0') {
     infoBar();
   } 
   // Display bottomMsg
   else {
     u8g2_.setFont(u8g2_font_5x7_tf);
-    u8g2_.drawStr(0, u8g2_.getDisplayHeight(), bottomMsg.c_str());
+    u8g2_.drawStr(0, u8g2_.getDisplayHeight(), bottomMsg);
 
     // Draw FN/Shift indicator
     int state = KB().getKeyboardState();
@@ -140,14 +145,74 @@ void PocketmageOled::oledLine(String line, bool doProgressBar, String bottomMsg)
 
   // DRAW LINE TEXT (unchanged)
   u8g2_.setFont(u8g2_font_ncenB18_tr);
-  if (u8g2_.getStrWidth(line.c_str()) < (u8g2_.getDisplayWidth() - 5)) {
-    u8g2_.drawStr(0, 20, line.c_str());
-    if (line.length() > 0) u8g2_.drawVLine(u8g2_.getStrWidth(line.c_str()) + 2, 1, 22);
+  if (u8g2_.getStrWidth(line) < (u8g2_.getDisplayWidth() - 5)) {
+    u8g2_.drawStr(0, 20, line);
+    if (line[0] != '\0') u8g2_.drawVLine(u8g2_.getStrWidth(line) + 2, 1, 22);
   } else {
-    u8g2_.drawStr(u8g2_.getDisplayWidth()-8-u8g2_.getStrWidth(line.c_str()), 20, line.c_str());
+    u8g2_.drawStr(u8g2_.getDisplayWidth()-8-u8g2_.getStrWidth(line), 20, line);
   }
+}
+
+void PocketmageOled::drawProgress(const OledPost& p) {
+  const uint16_t progressPx = map(p.value, 0, 100, 1, 216);
 
-  u8g2_.sendBuffer();
+  u8g2_.clearBuffer();
+  // Draw rounded rectangle border
+  u8g2_.drawRFrame(20, 3, 216, 16, 5);
+  // Draw progress bar
+  if (progressPx > 10) u8g2_.drawRBox(20, 3, progressPx, 16, 5);
+
+  // Show text
+  u8g2_.setFont(u8g2_font_7x13B_tf);
+  u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(p.label))/2,
+                u8g2_.getDisplayHeight()-3, p.label);
+}
+
+void PocketmageOled::drawWord(const char* word, bool allowLarge, bool showInfo) {
+  u8g2_.clearBuffer();
+
+  if (showInfo) infoBar();
+
+  if (allowLarge) {
+    /*u8g2_.setFont(u8g2_font_ncenB24_tr);
+    if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+      u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16+12,word);
+      return;
+    }*/
+    u8g2_.setFont(u8g2_font_ncenB18_tr);
+    if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+      u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16+5,word);
+      return;
+    }
+  }
+
+  u8g2_.setFont(u8g2_font_ncenB14_tr);
+  if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16+3,word);
+    return;
+  }
+
+  u8g2_.setFont(u8g2_font_ncenB12_tr);
+  if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16+2,word);
+    return;
+  }
+
+  u8g2_.setFont(u8g2_font_ncenB10_tr);
+  if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16+1,word);
+    return;
+  }
+
+  u8g2_.setFont(u8g2_font_ncenB08_tr);
+  if (u8g2_.getStrWidth(word) < u8g2_.getDisplayWidth()) {
+    u8g2_.drawStr((u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word))/2,16,word);
+    return;
+  } else {
+    u8g2_.drawStr(u8g2_.getDisplayWidth() - u8g2_.getStrWidth(word),16,word);
+    return;
+  }
+  
 }
 
 void PocketmageOled::infoBar() {
@@ -222,7 +287,7 @@ void PocketmageOled::infoBar() {
 
 void PocketmageOled::oledScroll() {
   // CLEAR DISPLAY
-  u8g2_.clearBuffer();
+  beginFrame();
 
   // DRAW BACKGROUND
   if (scrolloled0) u8g2_.drawXBMP(0, 0, 128, 32, scrolloled0);
@@ -267,14 +332,108 @@ void PocketmageOled::oledScroll() {
   }
 
   // SEND BUFFER 
-  u8g2_.sendBuffer();
+  commit();
+}
+
+void PocketmageOled::beginFrame() {
+  lockU8g2();
+  u8g2_.clearBuffer();
+}
+
+void PocketmageOled::commit() {
+  // Hand the frame to the compositor, which keeps it under toasts. Redrawing the same
+  // frame every pass posts nothing
+  const uint8_t* buf = u8g2_.getBufferPtr();
+  const bool changed = lastBase_ != OLED_CUSTOM || memcmp(custom_, buf, sizeof(custom_)) != 0;
+  if (changed) memcpy(custom_, buf, sizeof(custom_));
+  unlockU8g2();
+
+  if (changed) {
+    OledPost p;
+    p.layer = OLED_CUSTOM;
+    post(p);
+  }
+}
+
+void PocketmageOled::invalidate() {
+  lockU8g2();
+  sent_.forget();
+  unlockU8g2();
 }
 
 void PocketmageOled::setPowerSave(bool enable) {
+  lockU8g2();
   OLEDPowerSave_ = enable;
   u8g2_.setPowerSave(enable ? 1 : 0);
+  unlockU8g2();
+
+  // frames were skipped while the panel was off
+  if (!enable) {
+    OledPost redraw;
+    post(redraw);
+  }
 }
+
+// ===================== compositor task =====================
+void PocketmageOled::compose() {
+  uint32_t wait = OLED_FOREVER;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, (wait == OLED_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+
+    OledPost p;
+    while (mailbox_.take(p)) scene_.apply(p, millis());
+
+    uint32_t now = millis();
+    wait = scene_.waitMs(now, 1000 / max(OLED_MAX_FPS, 1));
+    if (wait != 0) continue;
+
+    lockU8g2();
+    if (!OLEDPowerSave_) {
+      const OledPost& top = scene_.top(now);
+      switch (top.layer) {
+        case OLED_LINE:     drawLine(top);                                                 break;
+        case OLED_PROGRESS: drawProgress(top);                                             break;
+        case OLED_CUSTOM:   memcpy(u8g2_.getBufferPtr(), custom_, sizeof(custom_));        break;
+        case OLED_WORD:
+        case OLED_TOAST:    drawWord(top.text, top.flags & OLED_LARGE, top.flags & OLED_INFO); break;
+        default:            u8g2_.clearBuffer();                                           break;
+      }
+      send();
+    }
+    unlockU8g2();
+
+    scene_.drawn(now);
+    wait = scene_.waitMs(millis(), 1000 / max(OLED_MAX_FPS, 1));
+  }
+}
+
 // ===================== private functions =====================
+void PocketmageOled::post(OledPost& p) {
+  p.kb = KB().getKeyboardState();
+  if (!mailbox_.post(p)) {
+    ESP_LOGW(tag, "OLED mailbox full, %u posts dropped", (unsigned)mailbox_.dropped());
+    return;
+  }
+  if (p.layer != OLED_TOAST && p.layer != OLED_NONE) lastBase_ = p.layer;
+  if (oledTaskHandle) xTaskNotifyGive(oledTaskHandle);
+}
+
+// Sends what was drawn into the u8g2 buffer, only the tiles that changed
+void PocketmageOled::send() {
+  // the tile copy is laid out for the 256x32 panel
+  if (u8g2_.getBufferTileWidth() != 32 || u8g2_.getBufferTileHeight() != 4) {
+    u8g2_.sendBuffer();
+    return;
+  }
+  sent_.commit(u8g2_.getBufferPtr(), [this](uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    u8g2_.updateDisplayArea(tx, ty, tw, th);
+  });
+  if (sent_.commits() % 500 == 0) {
+    ESP_LOGD(tag, "%u frames, %u%% of the tiles sent, %u unchanged", (unsigned)sent_.commits(),
+             (unsigned)sent_.sentPercent(), (unsigned)sent_.skipped());
+  }
+}
+
 // COMPUTE STRING WIDTH IN EINK PIXELS
 uint16_t PocketmageOled::strWidth(const String& s) const {
   return EINK().getEinkTextWidth(s);
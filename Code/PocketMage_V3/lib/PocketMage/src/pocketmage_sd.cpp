@@ -17,14 +17,20 @@ extern bool SAVE_POWER;
 static PocketmageSD pm_sd;
 
 // Helpers
-static int countVisibleChars(String input) {
+// Read in chunks, notes can be bigger than the free heap
+static int countVisibleChars(File& file) {
   int count = 0;
-
-  for (size_t i = 0; i < input.length(); i++) {
-    char c = input[i];
-    // Check if the character is a visible character or space
-    if (c >= 32 && c <= 126) {  // ASCII range for printable characters and space
-      count++;
+  uint8_t buf[512];
+
+  file.seek(0);
+  while (true) {
+    int n = file.read(buf, sizeof(buf));
+    if (n <= 0) break;
+    for (int i = 0; i < n; i++) {
+      // Check if the character is a visible character or space
+      if (buf[i] >= 32 && buf[i] <= 126) {  // ASCII range for printable characters and space
+        count++;
+      }
     }
   }
 
@@ -72,15 +78,24 @@ void setupSD() {
   if (!SD_MMC.exists("/notes"))               SD_MMC.mkdir( "/notes"              );
   if (!SD_MMC.exists("/assets"))              SD_MMC.mkdir( "/assets"             );
   if (!SD_MMC.exists("/assets/backgrounds"))  SD_MMC.mkdir( "/assets/backgrounds" );
+  if (!SD_MMC.exists("/assets/fonts"))        SD_MMC.mkdir( "/assets/fonts"       );
 
   if (!SD_MMC.exists("/assets/backgrounds/HOWTOADDBACKGROUNDS.txt")) {
     File f = SD_MMC.open("/assets/backgrounds/HOWTOADDBACKGROUNDS.txt", FILE_WRITE);
     if (f) {
-      f.print("How to add custom backgrounds:\n1. Make a background that is 1 bit (black OR white) and 320x240 pixels.\n2. Export your background as a .bmp file.\n3. Use image2cpp to convert your image to a .bin file. Use the settings: Invert Image Colors (TRUE), Swap Bits in Byte (FALSE). Select the \"Download as Binary File (.bin)\" button.\n4. Place the .bin file in this folder.\n5. Enjoy your new custom wallpapers!");
+      f.print("How to add custom backgrounds:\n1. Make a background that is 1 bit (black OR white) and 320x240 pixels.\n2. Export your background as a .bmp file.\n3. Use image2cpp to convert your image to a .bin file. Use the settings: Invert Image Colors (TRUE), Swap Bits in Byte (FALSE). Select the \"Download as Binary File (.bin)\" button.\n4. Place the .bin file in this folder.\n5. Enjoy your new custom wallpapers!\n\nSmaller files: run tools/bg2rle.py (in the PocketMage repo) on the .bin, or on the .bmp directly if Pillow is installed. Place the .rle file it makes in this folder instead of the .bin. Both load the same.");
       f.close();
     }
   }
   
+  if (!SD_MMC.exists("/assets/fonts/HOWTOADDFONTS.txt")) {
+    File f = SD_MMC.open("/assets/fonts/HOWTOADDFONTS.txt", FILE_WRITE);
+    if (f) {
+      f.print("How to add fonts for the text editor:\n1. Get the PocketMage repo. The packs are the .pmf files in Docs/Fonts (PMF).\n2. Place them in this folder.\n\nTo make the packs yourself, run: python3 Code/PocketMage_V3/tools/gfxfont2pmf.py -o packs Code/PocketMage_V3/lib/PocketMage/include/Fonts/*8b.h\n\nFonts without a .pmf file here are drawn with a built-in font.\nTo use a different font, convert its GFXfont header (Adafruit fontconvert) with --name set to the font it replaces, e.g. --name FreeSerif9pt8b.");
+      f.close();
+    }
+  }
+
   if (!SD_MMC.exists("/sys/events.txt")) {
     File f = SD_MMC.open("/sys/events.txt", FILE_WRITE);
     if (f) f.close();
@@ -101,8 +116,7 @@ PocketmageSD& SD() { return pm_sd; }
     
 void PocketmageSD::saveFile() {
   if (SD().getNoSD()) {
-      OLED().oledWord("SAVE FAILED - No SD!");
-      delay(5000);
+      OLED().toast("SAVE FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -139,20 +153,19 @@ void PocketmageSD::writeMetadata(const String& path) {
 
   File file = SD_MMC.open(path);
   if (!file || file.isDirectory()) {
-      OLED().oledWord("META WRITE ERR");
-      delay(1000);
+      OLED().toast("META WRITE ERR", 1000);
       ESP_LOGE(TAG, "Invalid file for metadata: %s", path);
       return;
   }
   // Get file size
   size_t fileSizeBytes = file.size();
-  file.close();
 
   // Format size string
   String fileSizeStr = String(fileSizeBytes) + " Bytes";
 
   // Get line and char counts
-  int charCount = countVisibleChars(SD().readFileToString(SD_MMC, path.c_str()));
+  int charCount = countVisibleChars(file);
+  file.close();
 
   String charStr = String(charCount) + " Char";
   // Get current time from RTC
@@ -207,8 +220,7 @@ void PocketmageSD::loadFile(bool showOLED) {
   delay(50);
 
   if (SD().getNoSD()) {
-      OLED().oledWord("LOAD FAILED - No SD!");
-      delay(5000);
+      OLED().toast("LOAD FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -226,8 +238,7 @@ void PocketmageSD::loadFile(bool showOLED) {
       stringToVector(textToLoad);
       keypad.enableInterrupts();
       if (showOLED) {
-      OLED().oledWord("File Loaded");
-      delay(200);
+      OLED().toast("File Loaded", 200);
       }
       if (SAVE_POWER)
       pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
@@ -237,8 +248,7 @@ void PocketmageSD::loadFile(bool showOLED) {
   
 void PocketmageSD::delFile(String fileName) {
   if (SD().getNoSD()) {
-      OLED().oledWord("DELETE FAILED - No SD!");
-      delay(5000);
+      OLED().toast("DELETE FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -307,8 +317,7 @@ void PocketmageSD::deleteMetadata(String path) {
   
 void PocketmageSD::renFile(String oldFile, String newFile) {
   if (SD().getNoSD()) {
-      OLED().oledWord("RENAME FAILED - No SD!");
-      delay(5000);
+      OLED().toast("RENAME FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -322,8 +331,7 @@ void PocketmageSD::renFile(String oldFile, String newFile) {
       if (!newFile.startsWith("/"))
       newFile = "/" + newFile;
       SD().renameFile(SD_MMC, oldFile.c_str(), newFile.c_str());
-      OLED().oledWord(oldFile + " -> " + newFile);
-      delay(1000);
+      OLED().toast(oldFile + " -> " + newFile, 1000);
 
       // Update MetaData
       SD().renMetadata(oldFile, newFile);
@@ -392,8 +400,7 @@ void PocketmageSD::renMetadata(String oldPath, String newPath) {
   
   void PocketmageSD::copyFile(String oldFile, String newFile) {
   if (SD().getNoSD()) {
-      OLED().oledWord("COPY FAILED - No SD!");
-      delay(5000);
+      OLED().toast("COPY FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -424,8 +431,7 @@ void PocketmageSD::renMetadata(String oldPath, String newPath) {
   
 void PocketmageSD::appendToFile(String path, String inText) {
   if (SD().getNoSD()) {
-      OLED().oledWord("OP FAILED - No SD!");
-      delay(5000);
+      OLED().toast("OP FAILED - No SD!", 5000);
       return;
   } else {
       SDActive = true;
@@ -450,8 +456,7 @@ void PocketmageSD::appendToFile(String path, String inText) {
 // Low-Level SDMMC Operations switch to using internal fs::FS*
 void PocketmageSD::listDir(fs::FS &fs, const char *dirname) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -510,8 +515,7 @@ void PocketmageSD::listDir(fs::FS &fs, const char *dirname) {
 }
 void PocketmageSD::readFile(fs::FS &fs, const char *path) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -534,8 +538,7 @@ void PocketmageSD::readFile(fs::FS &fs, const char *path) {
 }
 String PocketmageSD::readFileToString(fs::FS &fs, const char *path) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return "";
   }
   else { 
@@ -549,8 +552,7 @@ String PocketmageSD::readFileToString(fs::FS &fs, const char *path) {
     if (!file || file.isDirectory()) {
       noTimeout = false;
       ESP_LOGE(tag, "Failed to open file for reading: %s", path);
-      OLED().oledWord("Load Failed");
-      delay(500);
+      OLED().toast("Load Failed", 500);
       return "";  // Return an empty string on failure
     }
 
@@ -565,8 +567,7 @@ String PocketmageSD::readFileToString(fs::FS &fs, const char *path) {
 }
 void PocketmageSD::writeFile(fs::FS &fs, const char *path, const char *message) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -595,8 +596,7 @@ void PocketmageSD::writeFile(fs::FS &fs, const char *path, const char *message)
 }
 void PocketmageSD::appendFile(fs::FS &fs, const char *path, const char *message) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -624,8 +624,7 @@ void PocketmageSD::appendFile(fs::FS &fs, const char *path, const char *message)
 }
 void PocketmageSD::renameFile(fs::FS &fs, const char *path1, const char *path2) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -646,8 +645,7 @@ void PocketmageSD::renameFile(fs::FS &fs, const char *path1, const char *path2)
 }
 void PocketmageSD::deleteFile(fs::FS &fs, const char *path) {
   if (noSD_) {
-    OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return;
   }
   else {
@@ -667,8 +665,7 @@ void PocketmageSD::deleteFile(fs::FS &fs, const char *path) {
 }
 bool PocketmageSD::readBinaryFile(const char* path, uint8_t* buf, size_t len) {
   if (noSD_) {
-      OLED().oledWord("OP FAILED - No SD!");
-    delay(5000);
+    OLED().toast("OP FAILED - No SD!", 5000);
     return false;
   }
 
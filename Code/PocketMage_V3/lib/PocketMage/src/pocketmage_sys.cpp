@@ -16,6 +16,8 @@
 #include "esp_partition.h"
 #include "esp_ota_ops.h"
 #include "esp_system.h"
+#include <wordWrap.h>
+#include <bitmapStream.h>
 
 static constexpr const char* TAG = "SYSTEM";
 
@@ -50,6 +52,31 @@ bool rebootToPocketMage() {
 }
 ///////////////////////////////////////////////////////////////////////////////
 
+// Streams a background from the SD card into the display buffer a chunk at a time,
+// .bin as image2cpp exports it or .rle from tools/bg2rle.py
+static bool drawBackgroundFile(const String& path) {
+    File f = SD_MMC.open(path);
+    if (!f) return false;
+
+    BitmapStream<320 / 8> bmp;
+    uint8_t chunk[512];
+    bool ok;
+    if (path.endsWith(".rle")) ok = bmp.begin(chunk, f.read(chunk, RLE_HEADER));
+    else                       ok = bmp.beginRaw(320, 240);
+
+    size_t n;
+    while (ok && !bmp.done() && (n = f.read(chunk, sizeof(chunk))) > 0) {
+        bmp.feed(chunk, n, [](uint16_t y, const uint8_t* row, uint16_t w) {
+            display.drawBitmap(0, y, row, w, 1, GxEPD_BLACK);
+        });
+    }
+    f.close();
+
+    if (!ok) ESP_LOGW(TAG, "Not a background: %s", path.c_str());
+    else if (!bmp.done()) ESP_LOGW(TAG, "Background cut short: %s", path.c_str());
+    return ok;
+}
+
 namespace pocketmage {
     void setCpuSpeed(int newFreq) {
         // Return early if the frequency is already set
@@ -77,7 +104,7 @@ namespace pocketmage {
 
 
         // Put OLED to sleep
-        u8g2.setPowerSave(1);
+        OLED().setPowerSave(true);
 
         // Stop the einkHandler task
         if (einkHandlerTaskHandle != NULL) {
@@ -102,7 +129,7 @@ namespace pocketmage {
                 File file;
                 while ((file = dir.openNextFile())) {
                     String name = file.name();
-                    if (name.endsWith(".bin")) binFiles.push_back(name);
+                    if (name.endsWith(".bin") || name.endsWith(".rle")) binFiles.push_back(name);
                     file.close();
                 }
                 dir.close();
@@ -114,14 +141,8 @@ namespace pocketmage {
             if (!binFiles.empty()) {
                 int fileIndex = esp_random() % binFiles.size();
                 String path = "/assets/backgrounds/" + binFiles[fileIndex];
-                File f = SD_MMC.open(path);
-                if (f) {
-                    static uint8_t buf[320 * 240]; // Declare as static to avoid stack overflow :D
-                    f.read(buf, sizeof(buf));
-                    f.close();
-
-                    // Show file
-                    display.drawBitmap(0, 0, buf, 320, 240, GxEPD_BLACK);
+                // Show file
+                if (drawBackgroundFile(path)) {
                     display.setFont(&FreeMonoBold9pt7b);
                     display.setTextColor(GxEPD_BLACK);
                     display.setCursor(5, display.height()-5);
@@ -179,8 +200,7 @@ namespace pocketmage {
                     }
                     j = millis();
                     if (digitalRead(KB_IRQ) == 0) {
-                    OLED().oledWord("Good Save!");
-                    delay(500);
+                    OLED().toast("Good Save!", 500);
                     CLOCK().setPrevTimeMillis(millis());
                     keypad.flush();
                     return false;
@@ -215,6 +235,7 @@ namespace pocketmage {
     
     void IRAM_ATTR PWR_BTN_irq() {
         PWR_BTN_event = true;
+        KB().postInputFromISR(INPUT_PWR_BTN);
     }
 }
 
@@ -285,21 +306,30 @@ void PocketMage_INIT(){
 // ===================== GLOBAL TEXT HELPERS =====================
 volatile bool newLineAdded = true;           // New line added in TXT
 std::vector<String> allLines;         // All lines in TXT
+std::vector<uint8_t> allLineBreaks;   // How each line in allLines ended (WRAP_HARD, ...)
+
+void addLine(const String& line, uint8_t brk) {
+allLines.push_back(line);
+allLineBreaks.resize(allLines.size() - 1, WRAP_HARD);
+allLineBreaks.push_back(brk);
+}
+
+void clearLines() {
+allLines.clear();
+allLineBreaks.clear();
+}
 
 String vectorToString() {
 String result;
-EINK().setTXTFont(EINK().getCurrentFont());
+size_t total = 0;
+for (const String& line : allLines) total += line.length() + 1;
+result.reserve(total);
 
+// The break recorded with each line says what separated it from the next one
 for (size_t i = 0; i < allLines.size(); i++) {
     result += allLines[i];
-
-    int16_t x1, y1;
-    uint16_t charWidth, charHeight;
-    display.getTextBounds(allLines[i], 0, 0, &x1, &y1, &charWidth, &charHeight);
-
-    // Add newline only if the line doesn't fully use the available space
-    if (charWidth < display.width() && i < allLines.size() - 1) {
-    result += '\n';
+    if (i < allLines.size() - 1) {
+    result += wrapJoin(i < allLineBreaks.size() ? allLineBreaks[i] : WRAP_HARD);
     }
 }
 
@@ -308,46 +338,15 @@ return result;
 
 void stringToVector(String inputText) {
 EINK().setTXTFont(EINK().getCurrentFont());
-allLines.clear();
-String currentLine_;
-
-for (size_t i = 0; i < inputText.length(); i++) {
-    char c = inputText[i];
-
-    int16_t x1, y1;
-    uint16_t charWidth, charHeight;
-    display.getTextBounds(currentLine_, 0, 0, &x1, &y1, &charWidth, &charHeight);
-
-    // Check if new line needed
-    if ((c == '\n' || charWidth >= display.width() - 5) && !currentLine_.isEmpty()) {
-    if (currentLine_.endsWith(" ")) {
-        allLines.push_back(currentLine_);
-        currentLine_ = "";
-    } else {
-        int lastSpace = currentLine_.lastIndexOf(' ');
-        if (lastSpace != -1) {
-        // Split line at last space
-        String partialWord = currentLine_.substring(lastSpace + 1);
-        currentLine_ = currentLine_.substring(0, lastSpace);
-        allLines.push_back(currentLine_);
-        currentLine_ = partialWord;  // Start new line with partial word
-        } else {
-        // No spaces, whole line is a single word
-        allLines.push_back(currentLine_);
-        currentLine_ = "";
-        }
-    }
-    }
-
-    if (c != '\n') {
-    currentLine_ += c;
-    }
-}
-
-// Push last line if not empty
-if (!currentLine_.isEmpty()) {
-    allLines.push_back(currentLine_);
-}
+clearLines();
+
+const FontMetrics& fm = fontMetrics(EINK().getCurrentFont());
+wrapText(inputText.c_str(), inputText.length(), fm, display.width() - 5,
+         [](const char* line, size_t len, uint8_t brk) {
+           String s;
+           s.concat(line, len);
+           addLine(s, brk);
+         });
 }
 
 String removeChar(String str, char character) {
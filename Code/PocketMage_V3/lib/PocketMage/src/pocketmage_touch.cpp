@@ -16,8 +16,7 @@ void setupTouch(){
   // MPR121 / SLIDER
   if (!cap.begin(MPR121_ADDR)) {
     ESP_LOGE(TAG, "TouchPad Failed");
-    OLED().oledWord("TouchPad Failed");
-    delay(1000);
+    OLED().toast("TouchPad Failed", 1000);
   }
   cap.setAutoconfig(true);
 }
@@ -53,6 +52,7 @@ void PocketmageTOUCH::updateScrollFromTouch() {
     if (prev_dynamicScroll_ != dynamicScroll_)
       newLineAdded = true;
   }
+  sampled(newTouch, lastTouch_ != -1);
 }
 
 bool PocketmageTOUCH::updateScroll(int maxScroll,ulong& lineScroll) {
@@ -111,5 +111,16 @@ bool PocketmageTOUCH::updateScroll(int maxScroll,ulong& lineScroll) {
 
     prev_lineScroll = lineScroll;
   }
+  sampled(touchPos, lastTouchPos != -1);
   return updateScreen;
+}
+
+// The slider has no IRQ line: it's sampled every input loop pass while touched or until
+// the touch times out, every INPUT_TOUCH_POLL_MS otherwise. A new pad wakes the loop
+void PocketmageTOUCH::sampled(int pad, bool tracking) {
+  if (pad != sampledPad_) {
+    sampledPad_ = pad;
+    if (pad != -1) KB().postInput(INPUT_TOUCH, pad);
+  }
+  KB().wakeIn(tracking ? INPUT_POLL_MS : INPUT_TOUCH_POLL_MS);
 }
\ No newline at end of file
@@ -21,6 +21,22 @@ volatile uint8_t g_installProgress = 0; // 0-100 (0-50: extract, 50-100: intall)
 volatile bool g_installDone = false;
 volatile bool g_installFailed = false;
 
+// ---------- Install Log ----------
+// newest lines of the running install, pushed by installTask and shown on the e-ink
+static RingArenaSource<24, 1024> installLog;
+static Frame installLogFrame(10, 10, 10, 26, &installLog, false, true);
+static uint32_t installLogShown = 0;  // installLog.pushed() when last drawn
+
+static void installLogf(const char *fmt, ...) {
+  char line[96];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  Serial.println(line);
+  installLog.pushLine(line, (uint16_t)strlen(line));
+}
+
 // ---------- Utilities ----------
 static bool ensureDir(fs::FS &fs, const char *path) {
     if (fs.exists(path)) return true;
@@ -275,7 +291,7 @@ static void installTask(void *param) {
 
 	// --- Check TAR exists ---
 	if (!SD_MMC.exists(tarPath.c_str())) {
-		Serial.printf("Tar not found: %s\n", tarPath.c_str());
+		installLogf("Tar not found: %s", tarPath.c_str());
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
 		g_installFailed = true;
 		g_installDone = true;
@@ -287,7 +303,7 @@ static void installTask(void *param) {
 	if (!ensureDir(SD_MMC, APP_DIRECTORY) ||
 		//!rmRF(SD_MMC, TEMP_DIR) ||
 		!ensureDir(SD_MMC, TEMP_DIR)) {
-		Serial.println("Failed to prepare TEMP_DIR");
+		installLogf("Failed to prepare TEMP_DIR");
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
 		g_installFailed = true;
 		g_installDone = true;
@@ -302,8 +318,9 @@ static void installTask(void *param) {
 		g_installProgress = progress / 2; // 0–50% for extraction
 	});
 
+	installLogf("Extracting %s", tarPath.c_str());
 	if (!unpacker.tarExpander(SD_MMC, tarPath.c_str(), SD_MMC, TEMP_DIR)) {
-		Serial.printf("Extraction failed (err=%d)\n", unpacker.tarGzGetError());
+		installLogf("Extraction failed (err=%d)", unpacker.tarGzGetError());
 
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
 
@@ -356,14 +373,14 @@ if (tempRoot && tempRoot.isDirectory()) {
 }
 
 if (binPath.length() == 0 || base.length() == 0) {
-    Serial.printf("Bin not found after extraction in %s\n", TEMP_DIR);
+    installLogf("Bin not found after extraction in %s", TEMP_DIR);
     g_installFailed = true;
     g_installDone = true;
     delete p;
     vTaskDelete(NULL);
 }
 
-Serial.printf("App base name determined: '%s'\n", base.c_str());
+installLogf("App base name determined: '%s'", base.c_str());
 
 
 // Wait up to ~200 ms for SD_MMC to see the files
@@ -390,19 +407,19 @@ while (waitMs < 200) {
     waitMs += 10;
 }
 
-Serial.println("Listing /apps/temp:");
+installLogf("Listing /apps/temp:");
 tempRoot = SD_MMC.open(TEMP_DIR);
 if (tempRoot && tempRoot.isDirectory()) {
     File entry;
     while ((entry = tempRoot.openNextFile())) {
-        Serial.printf("  %s%s\n", entry.name(), entry.isDirectory() ? "/" : "");
+        installLogf("  %s%s", entry.name(), entry.isDirectory() ? "/" : "");
         entry.close();
     }
     tempRoot.close();
 }
 
 if (binPath.length() == 0 || !SD_MMC.exists(binPath.c_str())) {
-    Serial.printf("Bin not found after extraction: %s\n", binPath.c_str());
+    installLogf("Bin not found after extraction: %s", binPath.c_str());
     cleanupAppsTempRecursive(SD_MMC, TEMP_DIR);
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
     g_installFailed = true;
@@ -419,9 +436,9 @@ String assetsDst = pathJoin("/assets", base);   // <-- correct target path
 
 if (SD_MMC.exists(assetsSrc.c_str())) {
     rmRF(SD_MMC, assetsDst.c_str()); // clean old assets
-    Serial.printf("Copying assets: %s -> %s\n", assetsSrc.c_str(), assetsDst.c_str());
+    installLogf("Copying assets: %s -> %s", assetsSrc.c_str(), assetsDst.c_str());
     if (!copyAssetsFlat(SD_MMC, assetsSrc.c_str(), assetsDst.c_str())) {
-        Serial.println("Failed to copy assets!");
+        installLogf("Failed to copy assets!");
         g_installFailed = true;
         g_installDone = true;
         cleanupAppsTempRecursive(SD_MMC, TEMP_DIR);
@@ -439,7 +456,7 @@ if (SD_MMC.exists(assetsSrc.c_str())) {
 		nullptr);
 
 	if (!partition) {
-		Serial.printf("OTA_%d partition not found\n", p->otaIndex);
+		installLogf("OTA_%d partition not found", p->otaIndex);
 
     cleanupAppsTempRecursive(SD_MMC, TEMP_DIR);
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
@@ -452,7 +469,7 @@ if (SD_MMC.exists(assetsSrc.c_str())) {
 
 	File f = SD_MMC.open(binPath, "r");
 	if (!f) {
-		Serial.printf("Failed to open: %s\n", binPath.c_str());
+		installLogf("Failed to open: %s", binPath.c_str());
 
     cleanupAppsTempRecursive(SD_MMC, TEMP_DIR);
     if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
@@ -464,13 +481,13 @@ if (SD_MMC.exists(assetsSrc.c_str())) {
 	}
 
 	uint32_t sz = f.size();
-	Serial.printf("Flashing %s (%u bytes) -> OTA_%d @ 0x%08x\n",
+	installLogf("Flashing %s (%u bytes) -> OTA_%d @ 0x%08x",
 				  binPath.c_str(), sz, p->otaIndex, partition->address);
 
 	esp_ota_handle_t ota_handle;
 	esp_err_t err = esp_ota_begin(partition, sz, &ota_handle);
 	if (err != ESP_OK) {
-		Serial.printf("esp_ota_begin failed: %s\n", esp_err_to_name(err));
+		installLogf("esp_ota_begin failed: %s", esp_err_to_name(err));
 		f.close();
     
     cleanupAppsTempRecursive(SD_MMC, TEMP_DIR);
@@ -488,7 +505,7 @@ if (SD_MMC.exists(assetsSrc.c_str())) {
 		size_t rd = f.read(buf, sizeof(buf));
 		err = esp_ota_write(ota_handle, buf, rd);
 		if (err != ESP_OK) {
-			Serial.printf("esp_ota_write failed: %s\n", esp_err_to_name(err));
+			installLogf("esp_ota_write failed: %s", esp_err_to_name(err));
 			esp_ota_abort(ota_handle);
 			f.close();
 
@@ -501,22 +518,24 @@ if (SD_MMC.exists(assetsSrc.c_str())) {
 			vTaskDelete(NULL);
 		}
 		written += rd;
+		const uint32_t tenths = written * 10 / sz;
+		if (tenths != (written - rd) * 10 / sz) installLogf("Flashed %u%%", (unsigned)(tenths * 10));
 		g_installProgress = 50 + (written * 50 / sz); // 50–100% flashing
 	}
 
 	f.close();
 	err = esp_ota_end(ota_handle);
 	if (err != ESP_OK) {
-		Serial.printf("esp_ota_end failed: %s\n", esp_err_to_name(err));
+		installLogf("esp_ota_end failed: %s", esp_err_to_name(err));
 		g_installFailed = true;
 	} else {
-		Serial.println("Flash OK");
+		installLogf("Flash OK");
 
 
 if (iconPath.length() == 0) {
-    Serial.printf("Icon not found for app '%s'\n", base.c_str());
+    installLogf("Icon not found for app '%s'", base.c_str());
 } else {
-    Serial.printf("Icon found: %s\n", iconPath.c_str());
+    installLogf("Icon found: %s", iconPath.c_str());
 }
 
 
@@ -528,7 +547,7 @@ if (iconPath.length() == 0) {
 		strncpy(info.iconPath, iconPath.c_str(), sizeof(info.iconPath)-1);
 
 		if (!saveAppInfo(p->otaIndex, info)) {
-			Serial.printf("Failed to save AppInfo for OTA_%d\n", p->otaIndex);
+			installLogf("Failed to save AppInfo for OTA_%d", p->otaIndex);
 		}
 	}
 
@@ -546,6 +565,10 @@ if (iconPath.length() == 0) {
 bool installAppTarToOtaAsync(const char *tarRelName, int otaIndex) {
     auto *params = new InstallTaskParams{tarRelName, otaIndex};
 
+    installLog.clear();
+    installLogFrame.overlap = true;
+    installLogFrame.markDirty();
+
     BaseType_t res = xTaskCreate(
         installTask,
         "installTask",
@@ -598,37 +621,8 @@ String getInstalledAppForOta(int otaIndex) {
 }
 
 void drawProgressBar(uint8_t progress) {
-  uint progressPx = map(progress, 0, 100, 1, 216);
-
-  u8g2.clearBuffer();
-  // Draw rounded rectangle border
-  u8g2.drawRFrame(20, 3, 216, 16, 5);
-  // Draw progress bar
-  if (progressPx > 10) u8g2.drawRBox(20, 3, progressPx, 16, 5);
-  /*// Draw sawtooth animation
-  uint period = 1000;
-  uint x1 = map(millis() % period, 0, period, 0, progressPx);
-  uint x2 = map((millis() + period / 4) % period, 0, period, 0, progressPx);
-  uint x3 = map((millis() + period / 2) % period, 0, period, 0, progressPx);
-  uint x4 = map((millis() + (3 * period) / 4) % period, 0, period, 0, progressPx);
-
-  // Draw scrolling box
-  u8g2.setDrawColor(0);
-  u8g2.drawBox(20+x1, 10, 2, 2);
-  u8g2.drawBox(20+x2, 10, 2, 2);
-  u8g2.drawBox(20+x3, 10, 2, 2);
-  u8g2.drawBox(20+x4, 10, 2, 2);
-  u8g2.setDrawColor(1);*/
-
-  // Show text
-  String progressText = "";
-  if (progress < 52) progressText = "Extracting";
-  else               progressText = "Installing";
-  u8g2.setFont(u8g2_font_7x13B_tf);
-  u8g2.drawStr((u8g2.getDisplayWidth() - u8g2.getStrWidth(progressText.c_str()))/2,
-               u8g2.getDisplayHeight()-3,progressText.c_str());
-
-  u8g2.sendBuffer();
+  // Posted, the install task never waits on the OLED
+  OLED().progressBar(progress, (progress < 52) ? "Extracting" : "Installing");
 }
 
 // ---------- Operations ----------
@@ -642,136 +636,121 @@ void APPLOADER_INIT() {
 }
 
 void processKB_APPLOADER() {
-  int currentMillis = millis();
+  char inchar;
   String outPath = "";
 
   switch (CurrentAppLoaderState) {
     case MENU:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          currentLine.toLowerCase();
-          if (currentLine == "a") {
-            // edit a
-            selectedSlot = 1;
-          }
-          else if (currentLine == "b") {
-            // edit b
-            selectedSlot = 2;
-          }
-          else if (currentLine == "c") {
-            // edit c
-            selectedSlot = 3;
-          }
-          else if (currentLine == "d") {
-            // edit d
-            selectedSlot = 4;
-          }
-          CurrentAppLoaderState = SWAP_OR_EDIT;
-          KB().setKeyboardState(NORMAL);
-
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        currentLine.toLowerCase();
+        if (currentLine == "a") {
+          // edit a
+          selectedSlot = 1;
         }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+        else if (currentLine == "b") {
+          // edit b
+          selectedSlot = 2;
         }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
+        else if (currentLine == "c") {
+          // edit c
+          selectedSlot = 3;
         }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
-          HOME_INIT();
+        else if (currentLine == "d") {
+          // edit d
+          selectedSlot = 4;
         }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+        CurrentAppLoaderState = SWAP_OR_EDIT;
+        KB().setKeyboardState(NORMAL);
+
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
     case SWAP_OR_EDIT:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        // Swap
-        else if (inchar == 'S' || inchar == 's' || inchar == '!') {
-          // Switch to swap loop
-          CurrentAppLoaderState = SWAP;
-        }
-        // Delete
-        else if (inchar == 'D' || inchar == 'd' || inchar == '$') {
-          // Clear the slot
-          prefs.begin("PocketMage", false);
-          prefs.remove(("OTA" + String(selectedSlot)).c_str());
-          prefs.end();
-
-          const esp_partition_t *partition =
-            esp_partition_find_first(ESP_PARTITION_TYPE_APP,
-            (esp_partition_subtype_t)(ESP_PARTITION_SUBTYPE_APP_OTA_MIN + selectedSlot),
-            nullptr);
-
-          if (partition) {
-            esp_err_t err = esp_partition_erase_range(partition, 0, partition->size);
-            if (err == ESP_OK) {
-              Serial.printf("OTA_%d erased\n", selectedSlot);
-            }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      // Swap
+      else if (inchar == 'S' || inchar == 's' || inchar == '!') {
+        // Switch to swap loop
+        CurrentAppLoaderState = SWAP;
+      }
+      // Delete
+      else if (inchar == 'D' || inchar == 'd' || inchar == '$') {
+        // Clear the slot
+        prefs.begin("PocketMage", false);
+        prefs.remove(("OTA" + String(selectedSlot)).c_str());
+        prefs.end();
+
+        const esp_partition_t *partition =
+          esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+          (esp_partition_subtype_t)(ESP_PARTITION_SUBTYPE_APP_OTA_MIN + selectedSlot),
+          nullptr);
+
+        if (partition) {
+          esp_err_t err = esp_partition_erase_range(partition, 0, partition->size);
+          if (err == ESP_OK) {
+            Serial.printf("OTA_%d erased\n", selectedSlot);
           }
+        }
 
-          OLED().oledWord("App removed");
+        OLED().toast("App removed", 2000);
 
-          // Return to menu
-          newState = true;
-          CurrentAppLoaderState = MENU;
-          delay(2000);
-        }
-        
-        // Home recieved
-        else if (inchar == 12) {
-          selectedSlot = 0;
-          CurrentAppLoaderState = MENU;
-          currentLine = "";
-        }
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          //OLED().oledLine(currentLine, false);
-          OLED().oledWord("(S)wap app or (D)elete app");
-        }
+        // Return to menu
+        newState = true;
+        CurrentAppLoaderState = MENU;
       }
+      
+      // Home recieved
+      else if (inchar == 12) {
+        selectedSlot = 0;
+        CurrentAppLoaderState = MENU;
+        currentLine = "";
+      }
+      //OLED().oledLine(currentLine, false);
+      OLED().oledWord("(S)wap app or (D)elete app");
       break;
     case SWAP:
       outPath = fileWizardMini(false, APP_DIRECTORY);
@@ -796,8 +775,7 @@ void processKB_APPLOADER() {
           installAppTarToOtaAsync(relName.c_str(), selectedSlot);
           CurrentAppLoaderState = INSTALLING;
         } else {
-          OLED().oledWord("Not a .tar file!");
-          delay(2000);
+          OLED().toast("Not a .tar file!", 2000);
           CurrentAppLoaderState = MENU;
         }
       }
@@ -807,14 +785,12 @@ void processKB_APPLOADER() {
       if (!g_installDone) {
         drawProgressBar(g_installProgress);
       } else {
-        delay(500);
         if (g_installFailed) {
-          OLED().oledWord("Install failed!");
+          OLED().toast("Install failed!", 2500);
         } 
         else {
-          OLED().oledWord("Install complete!");
+          OLED().toast("Install complete!", 2500);
         }
-        delay(2000);
         newState = true;
         CurrentAppLoaderState = MENU;
       }
@@ -838,7 +814,15 @@ void einkHandler_APPLOADER() {
         EINK().drawStatusBar("Type Letter A-D:");
 
         //EINK().multiPassRefresh(2);
-        EINK().refresh();
+        EINK().refresh(REFRESH_IMAGE);
+      }
+      break;
+    case INSTALLING:
+      // redraw the log only when installTask pushed something
+      if (installLog.pushed() != installLogShown) {
+        static std::vector<Frame*> logFrames = { &installLogFrame };
+        installLogShown = installLog.pushed();
+        einkFramesDynamic(logFrames, false);
       }
       break;
   }
@@ -272,8 +272,7 @@ void commandSelectMonth(String command) {
       if (prefix == monthNames[i]) {
         int yearInt = stringToInt(yearPart);
         if (yearInt == -1 || yearInt < 1970 || yearInt > 2200) {
-          OLED().oledWord("Invalid");
-          delay(500);
+          OLED().toast("Invalid", 500);
           return;
         }
 
@@ -299,8 +298,7 @@ void commandSelectMonth(String command) {
     int date = command.substring(6, 8).toInt();
 
     if (year < 1970 || year > 2200 || month < 1 || month > 12 || date < 1 || date > daysInMonth(month, year)) {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -349,8 +347,7 @@ void commandSelectMonth(String command) {
     int intDay = stringToPositiveInt(command);
     DateTime now = CLOCK().nowDT();
     if (intDay == -1 || intDay > daysInMonth(currentMonth, currentYear)) {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
     else {
@@ -882,559 +879,515 @@ void drawCalendarWeek(int weekOffset) {
 
 // Loops
 void processKB_CALENDAR() {
-  int currentMillis = millis();
+  char inchar;
   DateTime now = CLOCK().nowDT();
 
   switch (CurrentCalendarState) {
     case MONTH:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        // HOME Recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }  
-        //CR Recieved
-        else if (inchar == 13) {                          
-          commandSelectMonth(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // LEFT Recieved
-        else if (inchar == 19) {
-          monthOffsetCount--;
-          newState = true;
-        }
-        // RIGHT Recieved
-        else if (inchar == 21) {
-          monthOffsetCount++;
-          newState = true;
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      // HOME Recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }  
+      //CR Recieved
+      else if (inchar == 13) {                          
+        commandSelectMonth(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        // CENTER Recieved
-        else if (inchar == 20 || inchar == 7) {
-          CurrentCalendarState = WEEK;
+      }
+      // LEFT Recieved
+      else if (inchar == 19) {
+        monthOffsetCount--;
+        newState = true;
+      }
+      // RIGHT Recieved
+      else if (inchar == 21) {
+        monthOffsetCount++;
+        newState = true;
+      }
+      // CENTER Recieved
+      else if (inchar == 20 || inchar == 7) {
+        CurrentCalendarState = WEEK;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+        delay(200);
+        break;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
           KB().setKeyboardState(NORMAL);
-          newState = true;
-          delay(200);
-          break;
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
     case WEEK:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        // HOME Recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }  
-        //CR Recieved
-        else if (inchar == 13) {                          
-          //commandSelectMonth(currentLine);
-          commandSelectWeek(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // LEFT Recieved
-        else if (inchar == 19) {
-          weekOffsetCount--;
-          newState = true;
-        }
-        // RIGHT Recieved
-        else if (inchar == 21) {
-          weekOffsetCount++;
-          newState = true;
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      // HOME Recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }  
+      //CR Recieved
+      else if (inchar == 13) {                          
+        //commandSelectMonth(currentLine);
+        commandSelectWeek(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        // CENTER Recieved
-        else if (inchar == 20 || inchar == 7) {
-          CurrentCalendarState = MONTH;
+      }
+      // LEFT Recieved
+      else if (inchar == 19) {
+        weekOffsetCount--;
+        newState = true;
+      }
+      // RIGHT Recieved
+      else if (inchar == 21) {
+        weekOffsetCount++;
+        newState = true;
+      }
+      // CENTER Recieved
+      else if (inchar == 20 || inchar == 7) {
+        CurrentCalendarState = MONTH;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+        delay(200);
+        break;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
           KB().setKeyboardState(NORMAL);
-          newState = true;
-          delay(200);
-          break;
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
     case NEW_EVENT:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        // HOME Recieved
-        else if (inchar == 12) {
-          newEventState--;
-          currentLine = "";
-          if (newEventState < 0) {
-            CurrentCalendarState = MONTH;
-            currentLine     = "";
-            newState        = true;
-            KB().setKeyboardState(NORMAL);
-          }
-        }  
-        //CR Recieved
-        else if (inchar == 13) {                          
-          switch (newEventState) {
-            case 0:
-              // Event Name: must be non-empty
-              if (currentLine.length() > 0) {
-                newEventName = currentLine;
-                newEventState++;
-                currentLine = newEventStartDate;
-              } else {
-                OLED().oledWord("Error: Empty event name");
-                delay(2000);
-                currentLine = "";
-              }
-              break;
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      // HOME Recieved
+      else if (inchar == 12) {
+        newEventState--;
+        currentLine = "";
+        if (newEventState < 0) {
+          CurrentCalendarState = MONTH;
+          currentLine     = "";
+          newState        = true;
+          KB().setKeyboardState(NORMAL);
+        }
+      }  
+      //CR Recieved
+      else if (inchar == 13) {                          
+        switch (newEventState) {
+          case 0:
+            // Event Name: must be non-empty
+            if (currentLine.length() > 0) {
+              newEventName = currentLine;
+              newEventState++;
+              currentLine = newEventStartDate;
+            } else {
+              OLED().toast("Error: Empty event name", 2000);
+              currentLine = "";
+            }
+            break;
 
-            case 1:
-              // Start Date: must be YYYYMMDD (8-digit number)
-              if (currentLine.length() == 8 && currentLine.toInt() > 10000000) {
-                newEventStartDate = currentLine;
+          case 1:
+            // Start Date: must be YYYYMMDD (8-digit number)
+            if (currentLine.length() == 8 && currentLine.toInt() > 10000000) {
+              newEventStartDate = currentLine;
+              newEventState++;
+              currentLine = "";
+            } else {
+              OLED().toast("Error: Invalid date (YYYYMMDD)", 2000);
+              currentLine = "";
+            }
+            break;
+
+          case 2:
+            // Start Time: must be HH:MM
+            if (currentLine.length() == 5 && currentLine.charAt(2) == ':' &&
+                isDigit(currentLine.charAt(0)) && isDigit(currentLine.charAt(1)) &&
+                isDigit(currentLine.charAt(3)) && isDigit(currentLine.charAt(4))) {
+              newEventStartTime = currentLine;
+              newEventState++;
+              currentLine = "";
+            } else {
+              OLED().toast("Error: Invalid time (HH:MM)", 2000);
+              currentLine = "";
+            }
+            break;
+
+          case 3:
+            // Duration: must be H:MM or HH:MM
+            {
+              int colonIdx = currentLine.indexOf(':');
+              if ((colonIdx == 1 || colonIdx == 2) &&
+                  isDigit(currentLine.charAt(0)) &&
+                  isDigit(currentLine.charAt(colonIdx + 1)) &&
+                  isDigit(currentLine.charAt(colonIdx + 2))) {
+                newEventDuration = currentLine;
                 newEventState++;
                 currentLine = "";
               } else {
-                OLED().oledWord("Error: Invalid date (YYYYMMDD)");
-                delay(2000);
+                OLED().toast("Error: Invalid duration (H:MM)", 2000);
                 currentLine = "";
               }
-              break;
-
-            case 2:
-              // Start Time: must be HH:MM
-              if (currentLine.length() == 5 && currentLine.charAt(2) == ':' &&
-                  isDigit(currentLine.charAt(0)) && isDigit(currentLine.charAt(1)) &&
-                  isDigit(currentLine.charAt(3)) && isDigit(currentLine.charAt(4))) {
-                newEventStartTime = currentLine;
+            }
+            break;
+
+          case 4:
+            // Repeat: must be NO, DAILY, WEEKLY xx, MONTHLY xx, or YEARLY xx
+            {
+              String code = currentLine;
+              code.toUpperCase();
+              if (code == "HELP") {
+                // Display help screen here
+                OLED().toast("Help screen coming soon!", 5000);
+                currentLine = "";
+              } else if (code == "NO" || code == "DAILY" ||
+                  code.startsWith("WEEKLY ") ||
+                  code.startsWith("MONTHLY ") ||
+                  code.startsWith("YEARLY ")) {
+                newEventRepeat = code;
                 newEventState++;
                 currentLine = "";
               } else {
-                OLED().oledWord("Error: Invalid time (HH:MM)");
-                delay(2000);
+                OLED().toast("Error: Invalid repeat value", 2000);
                 currentLine = "";
               }
-              break;
-
-            case 3:
-              // Duration: must be H:MM or HH:MM
-              {
-                int colonIdx = currentLine.indexOf(':');
-                if ((colonIdx == 1 || colonIdx == 2) &&
-                    isDigit(currentLine.charAt(0)) &&
-                    isDigit(currentLine.charAt(colonIdx + 1)) &&
-                    isDigit(currentLine.charAt(colonIdx + 2))) {
-                  newEventDuration = currentLine;
-                  newEventState++;
-                  currentLine = "";
-                } else {
-                  OLED().oledWord("Error: Invalid duration (H:MM)");
-                  delay(2000);
-                  currentLine = "";
-                }
-              }
-              break;
-
-            case 4:
-              // Repeat: must be NO, DAILY, WEEKLY xx, MONTHLY xx, or YEARLY xx
-              {
-                String code = currentLine;
-                code.toUpperCase();
-                if (code == "HELP") {
-                  // Display help screen here
-                  OLED().oledWord("Help screen coming soon!");
-                  delay(5000);
-                  currentLine = "";
-                } else if (code == "NO" || code == "DAILY" ||
-                    code.startsWith("WEEKLY ") ||
-                    code.startsWith("MONTHLY ") ||
-                    code.startsWith("YEARLY ")) {
-                  newEventRepeat = code;
-                  newEventState++;
-                  currentLine = "";
-                } else {
-                  OLED().oledWord("Error: Invalid repeat value");
-                  delay(2000);
-                  currentLine = "";
-                }
-              }
-              break;
-
-            case 5:
-              // Note: no restrictions
-              newEventNote = currentLine;
-              newEventState++;
-              currentLine = "";
-              break;
-          }
+            }
+            break;
 
-          if (newEventState > 5) {
-            // Create Event
-            addEvent( 
-                      newEventName, 
-                      newEventStartDate, 
-                      newEventStartTime, 
-                      newEventDuration, 
-                      newEventRepeat, 
-                      newEventNote 
-                    );
-            // Return to app
-            OLED().oledWord("New Event \"" + newEventName + "\" Created");
-            delay(2000);
-            CurrentCalendarState = MONTH;
-            KB().setKeyboardState(NORMAL);
-          }
-          newState = true;
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
+          case 5:
+            // Note: no restrictions
+            newEventNote = currentLine;
+            newEventState++;
+            currentLine = "";
+            break;
         }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+
+        if (newEventState > 5) {
+          // Create Event
+          addEvent( 
+                    newEventName, 
+                    newEventStartDate, 
+                    newEventStartTime, 
+                    newEventDuration, 
+                    newEventRepeat, 
+                    newEventNote 
+                  );
+          // Return to app
+          OLED().toast("New Event \"" + newEventName + "\" Created", 2000);
+          CurrentCalendarState = MONTH;
+          KB().setKeyboardState(NORMAL);
         }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
+        newState = true;
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
+      }
 
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          switch(newEventState) {
-            case 0:
-              OLED().oledLine(currentLine, false, "Enter the Event Name");
-              break;
-            case 1:
-              OLED().oledLine(currentLine, false, "Enter the Start Date (YYYYMMDD)");
-              break;
-            case 2:
-              OLED().oledLine(currentLine, false, "Enter the Start Time (HH:MM)");
-              break;
-            case 3:
-              OLED().oledLine(currentLine, false, "Enter the Event Duration (HH:MM)");
-              break;
-            case 4:
-              OLED().oledLine(currentLine, false, "Enter the Repeat Code or \"Help\"");
-              break;
-            case 5:
-              OLED().oledLine(currentLine, false, "Attach a Note to the Event");
-              break;
-          }
-        }
+      switch(newEventState) {
+        case 0:
+          OLED().oledLine(currentLine, false, "Enter the Event Name");
+          break;
+        case 1:
+          OLED().oledLine(currentLine, false, "Enter the Start Date (YYYYMMDD)");
+          break;
+        case 2:
+          OLED().oledLine(currentLine, false, "Enter the Start Time (HH:MM)");
+          break;
+        case 3:
+          OLED().oledLine(currentLine, false, "Enter the Event Duration (HH:MM)");
+          break;
+        case 4:
+          OLED().oledLine(currentLine, false, "Enter the Repeat Code or \"Help\"");
+          break;
+        case 5:
+          OLED().oledLine(currentLine, false, "Attach a Note to the Event");
+          break;
       }
       break;
     case VIEW_EVENT:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        // HOME Recieved
-        else if (inchar == 12) {
-          CurrentCalendarState = MONTH;
-          currentLine     = "";
-          newState        = true;
-          KB().setKeyboardState(NORMAL);
-        }  
-        //CR Recieved
-        else if (inchar == 13) {                          
-          switch (newEventState) {
-            case -1:
-              if (currentLine == "1") {
-                newEventState = 0;
-              }
-              else if (currentLine == "2") {
-                newEventState = 1;
-              }
-              else if (currentLine == "3") {
-                newEventState = 2;
-              }
-              else if (currentLine == "4") {
-                newEventState = 3;
-              }
-              else if (currentLine == "5") {
-                newEventState = 4;
-              }
-              else if (currentLine == "6") {
-                newEventState = 5;
-              }
-              else if (currentLine == "d" || currentLine == "D") {
-                deleteEventByIndex(editingEventIndex);
-                updateEventsFile();
-                OLED().oledWord("Event : \"" + newEventName + "\" Deleted");
-                delay(2000);
-                CurrentCalendarState = MONTH;
-                currentLine     = "";
-                newState        = true;
-                KB().setKeyboardState(NORMAL);
-              }
-              else if (currentLine == "s" || currentLine == "S") {
-                updateEventByIndex(editingEventIndex);
-                updateEventsFile();
-                OLED().oledWord("Event : \"" + newEventName + "\" Edited");
-                delay(2000);
-                CurrentCalendarState = MONTH;
-                currentLine     = "";
-                newState        = true;
-                KB().setKeyboardState(NORMAL);
-              }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      // HOME Recieved
+      else if (inchar == 12) {
+        CurrentCalendarState = MONTH;
+        currentLine     = "";
+        newState        = true;
+        KB().setKeyboardState(NORMAL);
+      }  
+      //CR Recieved
+      else if (inchar == 13) {                          
+        switch (newEventState) {
+          case -1:
+            if (currentLine == "1") {
+              newEventState = 0;
+            }
+            else if (currentLine == "2") {
+              newEventState = 1;
+            }
+            else if (currentLine == "3") {
+              newEventState = 2;
+            }
+            else if (currentLine == "4") {
+              newEventState = 3;
+            }
+            else if (currentLine == "5") {
+              newEventState = 4;
+            }
+            else if (currentLine == "6") {
+              newEventState = 5;
+            }
+            else if (currentLine == "d" || currentLine == "D") {
+              deleteEventByIndex(editingEventIndex);
+              updateEventsFile();
+              OLED().toast("Event : \"" + newEventName + "\" Deleted", 2000);
+              CurrentCalendarState = MONTH;
+              currentLine     = "";
+              newState        = true;
+              KB().setKeyboardState(NORMAL);
+            }
+            else if (currentLine == "s" || currentLine == "S") {
+              updateEventByIndex(editingEventIndex);
+              updateEventsFile();
+              OLED().toast("Event : \"" + newEventName + "\" Edited", 2000);
+              CurrentCalendarState = MONTH;
+              currentLine     = "";
+              newState        = true;
+              KB().setKeyboardState(NORMAL);
+            }
+            currentLine = "";
+            break;
+          case 0:
+            // Event Name: must be non-empty
+            if (currentLine.length() > 0) {
+              newEventName = currentLine;
+              currentLine = "";
+              newEventState = -1;
+            } else {
+              OLED().toast("Error: Empty event name", 2000);
+              currentLine = "";
+            }
+            break;
+
+          case 1:
+            // Start Date: must be YYYYMMDD (8-digit number)
+            if (currentLine.length() == 8 && currentLine.toInt() > 10000000) {
+              newEventStartDate = currentLine;
+              currentLine = "";
+              newEventState = -1;
+            } else {
+              OLED().toast("Error: Invalid date (YYYYMMDD)", 2000);
               currentLine = "";
-              break;
-            case 0:
-              // Event Name: must be non-empty
-              if (currentLine.length() > 0) {
-                newEventName = currentLine;
+            }
+            break;
+
+          case 2:
+            // Start Time: must be HH:MM
+            if (currentLine.length() == 5 && currentLine.charAt(2) == ':' &&
+                isDigit(currentLine.charAt(0)) && isDigit(currentLine.charAt(1)) &&
+                isDigit(currentLine.charAt(3)) && isDigit(currentLine.charAt(4))) {
+              newEventStartTime = currentLine;
+              currentLine = "";
+              newEventState = -1;
+            } else {
+              OLED().toast("Error: Invalid time (HH:MM)", 2000);
+              currentLine = "";
+            }
+            break;
+
+          case 3:
+            // Duration: must be H:MM or HH:MM
+            {
+              int colonIdx = currentLine.indexOf(':');
+              if ((colonIdx == 1 || colonIdx == 2) &&
+                  isDigit(currentLine.charAt(0)) &&
+                  isDigit(currentLine.charAt(colonIdx + 1)) &&
+                  isDigit(currentLine.charAt(colonIdx + 2))) {
+                newEventDuration = currentLine;
                 currentLine = "";
                 newEventState = -1;
               } else {
-                OLED().oledWord("Error: Empty event name");
-                delay(2000);
+                OLED().toast("Error: Invalid duration (H:MM)", 2000);
                 currentLine = "";
               }
-              break;
+            }
+            break;
 
-            case 1:
-              // Start Date: must be YYYYMMDD (8-digit number)
-              if (currentLine.length() == 8 && currentLine.toInt() > 10000000) {
-                newEventStartDate = currentLine;
+          case 4:
+            // Repeat: must be NO, DAILY, WEEKLY xx, MONTHLY xx, or YEARLY xx
+            {
+              String code = currentLine;
+              code.toUpperCase();
+              if (code == "HELP") {
+                // Display help screen here
+                OLED().toast("Help screen coming soon!", 5000);
                 currentLine = "";
-                newEventState = -1;
-              } else {
-                OLED().oledWord("Error: Invalid date (YYYYMMDD)");
-                delay(2000);
-                currentLine = "";
-              }
-              break;
-
-            case 2:
-              // Start Time: must be HH:MM
-              if (currentLine.length() == 5 && currentLine.charAt(2) == ':' &&
-                  isDigit(currentLine.charAt(0)) && isDigit(currentLine.charAt(1)) &&
-                  isDigit(currentLine.charAt(3)) && isDigit(currentLine.charAt(4))) {
-                newEventStartTime = currentLine;
+              } else if (code == "NO" || code == "DAILY" ||
+                  code.startsWith("WEEKLY ") ||
+                  code.startsWith("MONTHLY ") ||
+                  code.startsWith("YEARLY ")) {
+                newEventRepeat = code;
                 currentLine = "";
                 newEventState = -1;
               } else {
-                OLED().oledWord("Error: Invalid time (HH:MM)");
-                delay(2000);
+                OLED().toast("Error: Invalid repeat value", 2000);
                 currentLine = "";
               }
-              break;
-
-            case 3:
-              // Duration: must be H:MM or HH:MM
-              {
-                int colonIdx = currentLine.indexOf(':');
-                if ((colonIdx == 1 || colonIdx == 2) &&
-                    isDigit(currentLine.charAt(0)) &&
-                    isDigit(currentLine.charAt(colonIdx + 1)) &&
-                    isDigit(currentLine.charAt(colonIdx + 2))) {
-                  newEventDuration = currentLine;
-                  currentLine = "";
-                  newEventState = -1;
-                } else {
-                  OLED().oledWord("Error: Invalid duration (H:MM)");
-                  delay(2000);
-                  currentLine = "";
-                }
-              }
-              break;
-
-            case 4:
-              // Repeat: must be NO, DAILY, WEEKLY xx, MONTHLY xx, or YEARLY xx
-              {
-                String code = currentLine;
-                code.toUpperCase();
-                if (code == "HELP") {
-                  // Display help screen here
-                  OLED().oledWord("Help screen coming soon!");
-                  delay(5000);
-                  currentLine = "";
-                } else if (code == "NO" || code == "DAILY" ||
-                    code.startsWith("WEEKLY ") ||
-                    code.startsWith("MONTHLY ") ||
-                    code.startsWith("YEARLY ")) {
-                  newEventRepeat = code;
-                  currentLine = "";
-                  newEventState = -1;
-                } else {
-                  OLED().oledWord("Error: Invalid repeat value");
-                  delay(2000);
-                  currentLine = "";
-                }
-              }
-              break;
-
-            case 5:
-              // Note: no restrictions
-              newEventNote = currentLine;
-              currentLine = "";
-              newEventState = -1;
-              break;
-          }
+            }
+            break;
 
-          if (newEventState > 5) {
-            // Create Event
-            addEvent( 
-                      newEventName, 
-                      newEventStartDate, 
-                      newEventStartTime, 
-                      newEventDuration, 
-                      newEventRepeat, 
-                      newEventNote 
-                    );
-            // Return to app
-            OLED().oledWord("New Event \"" + newEventName + "\" Created");
-            delay(2000);
-            CurrentCalendarState = MONTH;
-            KB().setKeyboardState(NORMAL);
-          }
-          newState = true;
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
+          case 5:
+            // Note: no restrictions
+            newEventNote = currentLine;
+            currentLine = "";
+            newEventState = -1;
+            break;
         }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+
+        if (newEventState > 5) {
+          // Create Event
+          addEvent( 
+                    newEventName, 
+                    newEventStartDate, 
+                    newEventStartTime, 
+                    newEventDuration, 
+                    newEventRepeat, 
+                    newEventNote 
+                  );
+          // Return to app
+          OLED().toast("New Event \"" + newEventName + "\" Created", 2000);
+          CurrentCalendarState = MONTH;
+          KB().setKeyboardState(NORMAL);
         }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
+        newState = true;
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
+      }
 
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          switch(newEventState) {
-            case -1:
-              OLED().oledLine(currentLine, false);
-              break;
-            case 0:
-              OLED().oledLine(currentLine, false, "Enter the Event Name");
-              break;
-            case 1:
-              OLED().oledLine(currentLine, false, "Enter the Start Date (YYYYMMDD)");
-              break;
-            case 2:
-              OLED().oledLine(currentLine, false, "Enter the Start Time (HH:MM)");
-              break;
-            case 3:
-              OLED().oledLine(currentLine, false, "Enter the Event Duration (HH:MM)");
-              break;
-            case 4:
-              OLED().oledLine(currentLine, false, "Enter the Repeat Code or \"Help\"");
-              break;
-            case 5:
-              OLED().oledLine(currentLine, false, "Attach a Note to the Event");
-              break;
-          }
-        }
+      switch(newEventState) {
+        case -1:
+          OLED().oledLine(currentLine, false);
+          break;
+        case 0:
+          OLED().oledLine(currentLine, false, "Enter the Event Name");
+          break;
+        case 1:
+          OLED().oledLine(currentLine, false, "Enter the Start Date (YYYYMMDD)");
+          break;
+        case 2:
+          OLED().oledLine(currentLine, false, "Enter the Start Time (HH:MM)");
+          break;
+        case 3:
+          OLED().oledLine(currentLine, false, "Enter the Event Duration (HH:MM)");
+          break;
+        case 4:
+          OLED().oledLine(currentLine, false, "Enter the Repeat Code or \"Help\"");
+          break;
+        case 5:
+          OLED().oledLine(currentLine, false, "Attach a Note to the Event");
+          break;
       }
       break;
     case SUN:
@@ -1444,122 +1397,115 @@ void processKB_CALENDAR() {
     case THU:
     case FRI:
     case SAT:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        // HOME Recieved
-        else if (inchar == 12) {
-          CurrentCalendarState = MONTH;
-          currentLine     = "";
-          newState        = true;
-          KB().setKeyboardState(NORMAL);
-        }  
-        //CR Recieved
-        else if (inchar == 13) {                          
-          commandSelectDay(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      // HOME Recieved
+      else if (inchar == 12) {
+        CurrentCalendarState = MONTH;
+        currentLine     = "";
+        newState        = true;
+        KB().setKeyboardState(NORMAL);
+      }  
+      //CR Recieved
+      else if (inchar == 13) {                          
+        commandSelectDay(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
+      }
+      
+      // LEFT Received
+      else if (inchar == 19) {
+        // Go back one day
+        currentDate--;
+        if (currentDate < 1) {
+          currentMonth--;
+          if (currentMonth < 1) {
+            currentMonth = 12;
+            currentYear--;
           }
+          currentDate = daysInMonth(currentMonth, currentYear);
         }
-        
-        // LEFT Received
-        else if (inchar == 19) {
-          // Go back one day
-          currentDate--;
-          if (currentDate < 1) {
-            currentMonth--;
-            if (currentMonth < 1) {
-              currentMonth = 12;
-              currentYear--;
-            }
-            currentDate = daysInMonth(currentMonth, currentYear);
-          }
-
-          int dayOfWeek = getDayOfWeek(currentYear, currentMonth, currentDate);
-          switch (dayOfWeek) {
-            case 0: CurrentCalendarState = SUN; break;
-            case 1: CurrentCalendarState = MON; break;
-            case 2: CurrentCalendarState = TUE; break;
-            case 3: CurrentCalendarState = WED; break;
-            case 4: CurrentCalendarState = THU; break;
-            case 5: CurrentCalendarState = FRI; break;
-            case 6: CurrentCalendarState = SAT; break;
-          }
 
-          newState = true;
+        int dayOfWeek = getDayOfWeek(currentYear, currentMonth, currentDate);
+        switch (dayOfWeek) {
+          case 0: CurrentCalendarState = SUN; break;
+          case 1: CurrentCalendarState = MON; break;
+          case 2: CurrentCalendarState = TUE; break;
+          case 3: CurrentCalendarState = WED; break;
+          case 4: CurrentCalendarState = THU; break;
+          case 5: CurrentCalendarState = FRI; break;
+          case 6: CurrentCalendarState = SAT; break;
         }
 
-        // RIGHT Received
-        else if (inchar == 21) {
-          // Go forward one day
-          int daysThisMonth = daysInMonth(currentMonth, currentYear);
-          currentDate++;
-          if (currentDate > daysThisMonth) {
-            currentDate = 1;
-            currentMonth++;
-            if (currentMonth > 12) {
-              currentMonth = 1;
-              currentYear++;
-            }
-          }
+        newState = true;
+      }
 
-          int dayOfWeek = getDayOfWeek(currentYear, currentMonth, currentDate);
-          switch (dayOfWeek) {
-            case 0: CurrentCalendarState = SUN; break;
-            case 1: CurrentCalendarState = MON; break;
-            case 2: CurrentCalendarState = TUE; break;
-            case 3: CurrentCalendarState = WED; break;
-            case 4: CurrentCalendarState = THU; break;
-            case 5: CurrentCalendarState = FRI; break;
-            case 6: CurrentCalendarState = SAT; break;
+      // RIGHT Received
+      else if (inchar == 21) {
+        // Go forward one day
+        int daysThisMonth = daysInMonth(currentMonth, currentYear);
+        currentDate++;
+        if (currentDate > daysThisMonth) {
+          currentDate = 1;
+          currentMonth++;
+          if (currentMonth > 12) {
+            currentMonth = 1;
+            currentYear++;
           }
-
-          newState = true;
         }
 
-        // CENTER Recieved
-        else if (inchar == 20 || inchar == 7) {
-          CurrentCalendarState = WEEK;
-          KB().setKeyboardState(NORMAL);
-          newState = true;
-          delay(200);
-          break;
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+        int dayOfWeek = getDayOfWeek(currentYear, currentMonth, currentDate);
+        switch (dayOfWeek) {
+          case 0: CurrentCalendarState = SUN; break;
+          case 1: CurrentCalendarState = MON; break;
+          case 2: CurrentCalendarState = TUE; break;
+          case 3: CurrentCalendarState = WED; break;
+          case 4: CurrentCalendarState = THU; break;
+          case 5: CurrentCalendarState = FRI; break;
+          case 6: CurrentCalendarState = SAT; break;
         }
 
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+        newState = true;
+      }
+
+      // CENTER Recieved
+      else if (inchar == 20 || inchar == 7) {
+        CurrentCalendarState = WEEK;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+        delay(200);
+        break;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
 
   }
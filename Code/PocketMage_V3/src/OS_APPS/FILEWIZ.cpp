@@ -156,7 +156,7 @@ String renderWizMini(String folder, int8_t scrollDelta) {
   else scroll += scrollDelta;
 
   // Display Icons
-  u8g2.clearBuffer();
+  OLED().beginFrame();
   const int maxDisplay = 14;
   for (size_t i = scroll; i < cachedFiles.size() && i < scroll + maxDisplay; i++) {
     FileObject &f = cachedFiles[i];
@@ -202,7 +202,7 @@ String renderWizMini(String folder, int8_t scrollDelta) {
       break;
   }
 
-  u8g2.sendBuffer();
+  OLED().commit();
 
   return cachedFiles[scroll].address;
 }
@@ -224,93 +224,85 @@ String fileWizardMini(bool allowRecentSelect, String rootDir) {
   }
 
   // Handle Inputs
-  int currentMillis = millis();
-  if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-    char inchar = KB().updateKeypress();
-
-    // HANDLE INPUTS
-    if (inchar == 0);
-    // SHIFT Recieved
-    else if (inchar == 17) {
-      if (KB().getKeyboardState() == SHIFT)
-        KB().setKeyboardState(NORMAL);
-      else
-        KB().setKeyboardState(SHIFT);
-    }
-    // FN Recieved
-    else if (inchar == 18) {
-      if (KB().getKeyboardState() == FUNC)
-        KB().setKeyboardState(NORMAL);
-      else
-        KB().setKeyboardState(FUNC);
-    }
-    // Left received
-    else if (inchar == 19) {
-      scrollDelta = -1;
-    }  
-    // Right received
-    else if (inchar == 21) {
-      scrollDelta = 1;
-    } 
-    // 'n' recieved (new folder)
-    else if (inchar == 'n' || inchar == 'N' || inchar == '/') {
-      #pragma message "TODO: populate"
-    }
-    // Exit received
-    else if (inchar == 12) {
-      return "_EXIT_";
-    }
-    // Back received
-    else if (inchar == 8) {
-      // If not at rootDir, go up one directory
-      if (selectedDirectory != rootDir) {
-        int lastSlash = selectedDirectory.lastIndexOf('/');
-        if (lastSlash > 0) {
-          selectedDirectory = selectedDirectory.substring(0, lastSlash);
-        } else {
-          selectedDirectory = rootDir;
-        }
+  char inchar = KB().updateKeypress();
+
+  // HANDLE INPUTS
+  if (inchar == 0);
+  // SHIFT Recieved
+  else if (inchar == 17) {
+    if (KB().getKeyboardState() == SHIFT)
+      KB().setKeyboardState(NORMAL);
+    else
+      KB().setKeyboardState(SHIFT);
+  }
+  // FN Recieved
+  else if (inchar == 18) {
+    if (KB().getKeyboardState() == FUNC)
+      KB().setKeyboardState(NORMAL);
+    else
+      KB().setKeyboardState(FUNC);
+  }
+  // Left received
+  else if (inchar == 19) {
+    scrollDelta = -1;
+  }  
+  // Right received
+  else if (inchar == 21) {
+    scrollDelta = 1;
+  } 
+  // 'n' recieved (new folder)
+  else if (inchar == 'n' || inchar == 'N' || inchar == '/') {
+    #pragma message "TODO: populate"
+  }
+  // Exit received
+  else if (inchar == 12) {
+    return "_EXIT_";
+  }
+  // Back received
+  else if (inchar == 8) {
+    // If not at rootDir, go up one directory
+    if (selectedDirectory != rootDir) {
+      int lastSlash = selectedDirectory.lastIndexOf('/');
+      if (lastSlash > 0) {
+        selectedDirectory = selectedDirectory.substring(0, lastSlash);
+      } else {
+        selectedDirectory = rootDir;
       }
     }
-    // Select received
-    else if (inchar == 20 || inchar == 29 || inchar == 7 || inchar == 13) {
-      if (selectedPath != "") {
-        File entry = SD_MMC.open(selectedPath);
-        // If selectedPath is a folder, open it and change the selectedDirectory
-        if (entry && entry.isDirectory()) {
-          selectedDirectory = selectedPath;
-          // Clamp to rootDir if needed
-          if (selectedDirectory.length() < rootDir.length() || 
-              !selectedDirectory.startsWith(rootDir)) {
-            selectedDirectory = rootDir;
-          }
+  }
+  // Select received
+  else if (inchar == 20 || inchar == 29 || inchar == 7 || inchar == 13) {
+    if (selectedPath != "") {
+      File entry = SD_MMC.open(selectedPath);
+      // If selectedPath is a folder, open it and change the selectedDirectory
+      if (entry && entry.isDirectory()) {
+        selectedDirectory = selectedPath;
+        // Clamp to rootDir if needed
+        if (selectedDirectory.length() < rootDir.length() || 
+            !selectedDirectory.startsWith(rootDir)) {
+          selectedDirectory = rootDir;
         }
-        // If selectedPath is a file, return the selectedPath as a String 
-        else return selectedPath;
       }
+      // If selectedPath is a file, return the selectedPath as a String 
+      else return selectedPath;
     }
-    else if (allowRecentSelect && (inchar >= '0' && inchar <= '9')) {
-      int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
-      // SET WORKING FILE
-      String selectedFile = SD().getFilesListIndex(fileIndex - 1);
-      if (selectedFile != "-" && selectedFile != "") {
-        SD().setWorkingFile(selectedFile);
-        // GO TO WIZ1_
-        CurrentFileWizState = WIZ1_;
-        newState = true;
-      }
+  }
+  else if (allowRecentSelect && (inchar >= '0' && inchar <= '9')) {
+    int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
+    // SET WORKING FILE
+    String selectedFile = SD().getFilesListIndex(fileIndex - 1);
+    if (selectedFile != "-" && selectedFile != "") {
+      SD().setWorkingFile(selectedFile);
+      // GO TO WIZ1_
+      CurrentFileWizState = WIZ1_;
+      newState = true;
     }
+  }
 
-    KBBounceMillis = currentMillis;  // reset debounce timer
 
-    // Make sure OLED only updates at OLED_MAX_FPS
-    if (currentMillis - OLEDFPSMillis >= (1000 / OLED_MAX_FPS)) {
-      OLEDFPSMillis = currentMillis;
-      // Display OLED file list
-      String temp_selectedPath = renderWizMini(selectedDirectory, scrollDelta);
-      if (temp_selectedPath != "") selectedPath = temp_selectedPath;
-    }
-  }
+  // Display OLED file list
+  String temp_selectedPath = renderWizMini(selectedDirectory, scrollDelta);
+  if (temp_selectedPath != "") selectedPath = temp_selectedPath;
 
   if (SAVE_POWER) pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
   return "";
@@ -318,8 +310,8 @@ String fileWizardMini(bool allowRecentSelect, String rootDir) {
 
 void processKB_FILEWIZ() {
   OLED().setPowerSave(false);
-  int currentMillis = millis();
   String outPath = "";
+  char inchar;
 
   switch (CurrentFileWizState) {
     case WIZ0_:
@@ -346,235 +338,197 @@ void processKB_FILEWIZ() {
       disableTimeout = false;
 
       KB().setKeyboardState(FUNC);
-      currentMillis = millis();
-      //Make sure oled only updates at 60fps
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8 || inchar == 12) {
-          CurrentFileWizState = WIZ0_;
-          newState = true;
-          break;
-        }
-        else if (inchar >= '1' && inchar <= '4') {
-          int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
-          // SELECT OPTION
-          switch (fileIndex) {
-            case 1: // RENAME
-              CurrentFileWizState = WIZ2_R;
-              newState = true;
-              break;
-            case 2: //DELETE
-              CurrentFileWizState = WIZ1_YN;
-              newState = true;
-              break;
-            case 3: // COPY
-              CurrentFileWizState = WIZ2_C;
-              newState = true;
-              break;
-            case 4: // ELABORATE
-              break;
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8 || inchar == 12) {
+        CurrentFileWizState = WIZ0_;
+        newState = true;
+        break;
+      }
+      else if (inchar >= '1' && inchar <= '4') {
+        int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
+        // SELECT OPTION
+        switch (fileIndex) {
+          case 1: // RENAME
+            CurrentFileWizState = WIZ2_R;
+            newState = true;
+            break;
+          case 2: //DELETE
+            CurrentFileWizState = WIZ1_YN;
+            newState = true;
+            break;
+          case 3: // COPY
+            CurrentFileWizState = WIZ2_C;
+            newState = true;
+            break;
+          case 4: // ELABORATE
+            break;
         }
-        KBBounceMillis = currentMillis;
       }
+
+      OLED().oledLine(currentWord, false);
       break;
     case WIZ1_YN:
       disableTimeout = false;
 
       KB().setKeyboardState(NORMAL);
-      currentMillis = millis();
-      //Make sure oled only updates at 60fps
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8 || inchar == 12) {
-          CurrentFileWizState = WIZ1_;
-          newState = true;
-          break;
-        }
-        // Y RECIEVED
-        else if (inchar == 'y' || inchar == 'Y') {
-          // DELETE FILE
-          SD().delFile(SD().getWorkingFile());
-          
-          // RETURN TO FILE WIZ HOME
-          refreshFiles = true;
-          CurrentFileWizState = WIZ0_;
-          newState = true;
-          break;
-        }
-        // N RECIEVED
-        else if (inchar == 'n' || inchar == 'N') {
-          // GO BACK
-          CurrentFileWizState = WIZ1_;
-          newState = true;
-          break;
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        KBBounceMillis = currentMillis;
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8 || inchar == 12) {
+        CurrentFileWizState = WIZ1_;
+        newState = true;
+        break;
+      }
+      // Y RECIEVED
+      else if (inchar == 'y' || inchar == 'Y') {
+        // DELETE FILE
+        SD().delFile(SD().getWorkingFile());
+        
+        // RETURN TO FILE WIZ HOME
+        refreshFiles = true;
+        CurrentFileWizState = WIZ0_;
+        newState = true;
+        break;
+      }
+      // N RECIEVED
+      else if (inchar == 'n' || inchar == 'N') {
+        // GO BACK
+        CurrentFileWizState = WIZ1_;
+        newState = true;
+        break;
       }
+
+      OLED().oledLine(currentWord, false);
       break;
     case WIZ2_R:
       disableTimeout = false;
 
       //KB().setKeyboardState(NORMAL);
-      currentMillis = millis();
-      //Make sure oled only updates at 60fps
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);                                         
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {}
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentWord = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentWord.length() > 0) {
-            currentWord.remove(currentWord.length() - 1);
-          }
-        }
-        else if (inchar == 12) {
-          CurrentFileWizState = WIZ1_;
-          KB().setKeyboardState(NORMAL);
-          currentWord = "";
-          currentLine = "";
-          newState = true;
-          break;
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);                                         
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {}
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentWord = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentWord.length() > 0) {
+          currentWord.remove(currentWord.length() - 1);
         }
-        //ENTER Recieved
-        else if (inchar == 13) {      
-          // RENAME FILE                    
-          String newName = "/" + currentWord + ".txt";
-          SD().renFile(SD().getWorkingFile(), newName);
-
-          // RETURN TO WIZ0
-          refreshFiles = true;
-          CurrentFileWizState = WIZ0_;
+      }
+      else if (inchar == 12) {
+        CurrentFileWizState = WIZ1_;
+        KB().setKeyboardState(NORMAL);
+        currentWord = "";
+        currentLine = "";
+        newState = true;
+        break;
+      }
+      //ENTER Recieved
+      else if (inchar == 13) {      
+        // RENAME FILE                    
+        String newName = "/" + currentWord + ".txt";
+        SD().renFile(SD().getWorkingFile(), newName);
+
+        // RETURN TO WIZ0
+        refreshFiles = true;
+        CurrentFileWizState = WIZ0_;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+        currentWord = "";
+        currentLine = "";
+      }
+      //All other chars
+      else {
+        //Only allow char to be added if it's an allowed char
+        if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL){
           KB().setKeyboardState(NORMAL);
-          newState = true;
-          currentWord = "";
-          currentLine = "";
-        }
-        //All other chars
-        else {
-          //Only allow char to be added if it's an allowed char
-          if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL){
-            KB().setKeyboardState(NORMAL);
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
         }
       }
+
+      OLED().oledLine(currentWord, false);
       break;
     case WIZ2_C:
       disableTimeout = false;
 
       //KB().setKeyboardState(NORMAL);
-      currentMillis = millis();
-      //Make sure oled only updates at 60fps
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);                                         
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {}
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentWord = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentWord.length() > 0) {
-            currentWord.remove(currentWord.length() - 1);
-          }
-        }
-        else if (inchar == 12) {
-          CurrentFileWizState = WIZ1_;
-          KB().setKeyboardState(NORMAL);
-          currentWord = "";
-          currentLine = "";
-          newState = true;
-          break;
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);                                         
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {}
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentWord = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentWord.length() > 0) {
+          currentWord.remove(currentWord.length() - 1);
         }
-        //ENTER Recieved
-        else if (inchar == 13) {      
-          // Copy FILE                    
-          String newName = "/" + currentWord + ".txt";
-          SD().copyFile(SD().getWorkingFile(), newName);
-
-          // RETURN TO WIZ0
-          refreshFiles = true;
-          CurrentFileWizState = WIZ0_;
+      }
+      else if (inchar == 12) {
+        CurrentFileWizState = WIZ1_;
+        KB().setKeyboardState(NORMAL);
+        currentWord = "";
+        currentLine = "";
+        newState = true;
+        break;
+      }
+      //ENTER Recieved
+      else if (inchar == 13) {      
+        // Copy FILE                    
+        String newName = "/" + currentWord + ".txt";
+        SD().copyFile(SD().getWorkingFile(), newName);
+
+        // RETURN TO WIZ0
+        refreshFiles = true;
+        CurrentFileWizState = WIZ0_;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+        currentWord = "";
+        currentLine = "";
+      }
+      //All other chars
+      else {
+        //Only allow char to be added if it's an allowed char
+        if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL){
           KB().setKeyboardState(NORMAL);
-          newState = true;
-          currentWord = "";
-          currentLine = "";
-        }
-        //All other chars
-        else {
-          //Only allow char to be added if it's an allowed char
-          if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL){
-            KB().setKeyboardState(NORMAL);
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
         }
       }
+
+      OLED().oledLine(currentWord, false);
       break;
   
   }
@@ -603,7 +557,7 @@ void einkHandler_FILEWIZ() {
           display.print(SD().getFilesListIndex(i));
         }
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
     case WIZ1_:
@@ -615,7 +569,7 @@ void einkHandler_FILEWIZ() {
         EINK().drawStatusBar("- " + SD().getWorkingFile());
         display.drawBitmap(0, 0, fileWizardallArray[1], 320, 218, GxEPD_BLACK);
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
     case WIZ1_YN:
@@ -627,7 +581,7 @@ void einkHandler_FILEWIZ() {
         EINK().drawStatusBar("DEL:" + SD().getWorkingFile() + "?(Y/N)");
         display.drawBitmap(0, 0, fileWizardallArray[1], 320, 218, GxEPD_BLACK);
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
     case WIZ2_R:
@@ -639,7 +593,7 @@ void einkHandler_FILEWIZ() {
         EINK().drawStatusBar("Enter New Filename:");
         display.drawBitmap(0, 0, fileWizardallArray[2], 320, 218, GxEPD_BLACK);
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
     case WIZ2_C:
@@ -651,7 +605,7 @@ void einkHandler_FILEWIZ() {
         EINK().drawStatusBar("Enter Name For Copy:");
         display.drawBitmap(0, 0, fileWizardallArray[2], 320, 218, GxEPD_BLACK);
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
   }
@@ -72,19 +72,16 @@ void commandSelect(String command) {
     String numStr = command.substring(6);
     int sides = numStr.toInt();
     if (sides < 1) {
-      OLED().oledWord("Please enter a valid number");
-      delay(2000);
+      OLED().toast("Please enter a valid number", 2000);
     } 
     else if (sides == 1) {
-      OLED().oledWord("D1: you rolled a 1, duh!");
-      delay(2000);
+      OLED().toast("D1: you rolled a 1, duh!", 2000);
     }
     else {
       int roll = (esp_random() % sides) + 1;
-      if (roll == sides)  OLED().oledWord("D" + String(sides) + ": " + String(roll) + "!!!");
-      else if (roll == 1) OLED().oledWord("D" + String(sides) + ": " + String(roll) + " :(");
-      else                OLED().oledWord("D" + String(sides) + ": " + String(roll));
-      delay(3000);
+      if (roll == sides)  OLED().toast("D" + String(sides) + ": " + String(roll) + "!!!", 3000);
+      else if (roll == 1) OLED().toast("D" + String(sides) + ": " + String(roll) + " :(", 3000);
+      else                OLED().toast("D" + String(sides) + ": " + String(roll), 3000);
       KB().setKeyboardState(NORMAL);
     }
   }
@@ -106,8 +103,7 @@ void commandSelect(String command) {
   }
   /////////////////////////////
   else if (command == "home") {
-    OLED().oledWord("You're home, silly!");
-    delay(1000);
+    OLED().toast("You're home, silly!", 1000);
   } 
   /////////////////////////////
   else if (command == "note" || command == "text" || command == "write" || command == "notebook" || command == "notepad" || command == "txt" || command == "1") {
@@ -147,32 +143,25 @@ void commandSelect(String command) {
   }
   /////////////////////////////
   else if (command == "i farted") {
-    OLED().oledWord("That smells");
-    delay(1000);
+    OLED().toast("That smells", 1000);
   } 
   else if (command == "poop") {
-    OLED().oledWord("Yuck");
-    delay(1000);
+    OLED().toast("Yuck", 1000);
   } 
   else if (command == "hello") {
-    OLED().oledWord("Hey, you!");
-    delay(1000);
+    OLED().toast("Hey, you!", 1000);
   } 
   else if (command == "hi") {
-    OLED().oledWord("What's up?");
-    delay(1000);
+    OLED().toast("What's up?", 1000);
   } 
   else if (command == "i love you") {
-    OLED().oledWord("luv u 2 <3");
-    delay(1000);
+    OLED().toast("luv u 2 <3", 1000);
   } 
   else if (command == "what can you do") {
-    OLED().oledWord("idk man");
-    delay(1000);
+    OLED().toast("idk man", 1000);
   } 
   else if (command == "alexa") {
-    OLED().oledWord("...");
-    delay(1000);
+    OLED().toast("...", 1000);
   } 
   else {
     settingCommandSelect(command);
@@ -265,6 +254,9 @@ void mageIdle(bool internalRefresh) {
     resetIdleAnim = false;
   }
   
+  // The animation counts passes, keep the input loop at its usual period while it runs
+  KB().wakeIn(INPUT_POLL_MS);
+
   // Frame rate control
   const uint32_t FRAME_INTERVAL = 100; // milliseconds per frame (e.g., 10 FPS = 100 ms)
   static uint32_t lastUpdate = 0;
@@ -273,7 +265,7 @@ void mageIdle(bool internalRefresh) {
   if (millis() - lastUpdate < FRAME_INTERVAL) return; // skip until next frame
   lastUpdate = millis();
 
-  if (internalRefresh) u8g2.clearBuffer();
+  if (internalRefresh) OLED().beginFrame();
   u8g2.setBitmapMode(1);
 
   switch (CurrentMageState) {
@@ -343,80 +335,72 @@ void mageIdle(bool internalRefresh) {
 
   if (internalRefresh) {
     OLED().infoBar();
-    u8g2.sendBuffer();
+    OLED().commit();
   }
 }
 
 void processKB_HOME() {
-  int currentMillis = millis();
+  char inchar;
 
   switch (CurrentHOMEState) {
     case HOME_HOME:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-
-        if (inchar != 0) lastInput = millis();
-
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          commandSelect(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+      inchar = KB().updateKeypress();
+
+      if (inchar != 0) lastInput = millis();
+
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        commandSelect(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        CurrentAppState = HOME;
+        currentLine     = "";
+        newState        = true;
+        KB().setKeyboardState(NORMAL);
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        // Home recieved
-        else if (inchar == 12) {
-          CurrentAppState = HOME;
-          currentLine     = "";
-          newState        = true;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
           KB().setKeyboardState(NORMAL);
         }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
+      }
 
-          if (millis() - lastInput > IDLE_TIME) {
-            mageIdle(true);
-          }
-          else {
-            resetIdle();
-            OLED().oledLine(currentLine, false);
-          }
-        }
+      if (millis() - lastInput > IDLE_TIME) {
+        mageIdle(true);
+      }
+      else {
+        resetIdle();
+        OLED().oledLine(currentLine, false);
       }
       break;
 
@@ -245,64 +245,56 @@ void JMENUCommand(String command) {
 
 // Loops
 void processKB_JOURNAL() {
-  int currentMillis = millis();
   char inchar;
 
   switch (CurrentJournalState) {
     case J_MENU:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          JMENUCommand(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        JMENUCommand(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
     default:
       CurrentJournalState = J_MENU;
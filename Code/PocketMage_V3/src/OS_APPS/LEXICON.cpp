@@ -36,8 +36,7 @@ void loadDefinitions(String word) {
 
   File file = SD_MMC.open(filePath);
   if (!file) {
-    OLED().oledWord("Missing Dictionary!");
-    delay(2000);
+    OLED().toast("Missing Dictionary!", 2000);
     return;
   }
 
@@ -71,8 +70,7 @@ void loadDefinitions(String word) {
   file.close();
 
   if (defList.empty()) {
-    OLED().oledWord("No definitions found");
-    delay(2000);
+    OLED().toast("No definitions found", 2000);
   }
   else {
     CurrentLexState = DEF;
@@ -86,133 +84,119 @@ void loadDefinitions(String word) {
 }
 
 void processKB_LEXICON() {
-  int currentMillis = millis();
+  char inchar;
 
   switch (CurrentLexState) {
     case MENU:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          loadDefinitions(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        loadDefinitions(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
 
     case DEF:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          loadDefinitions(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }
-
-        // LEFT Recieved
-        else if (inchar == 19) {
-          definitionIndex--;
-          if (definitionIndex < 0) definitionIndex = 0;
-          newState = true;
-        }
-        // RIGHT Received
-        else if (inchar == 21) {
-          definitionIndex++;
-          if (definitionIndex >= defList.size()) definitionIndex = defList.size() - 1;
-          newState = true;
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        loadDefinitions(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }
 
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
-        }
+      // LEFT Recieved
+      else if (inchar == 19) {
+        definitionIndex--;
+        if (definitionIndex < 0) definitionIndex = 0;
+        newState = true;
+      }
+      // RIGHT Received
+      else if (inchar == 21) {
+        definitionIndex++;
+        if (definitionIndex >= defList.size()) definitionIndex = defList.size() - 1;
+        newState = true;
+      }
 
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
   }
 }
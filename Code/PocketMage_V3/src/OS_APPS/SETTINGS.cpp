@@ -33,8 +33,7 @@ void settingCommandSelect(String command) {
       DateTime now = CLOCK().nowDT();  // Preserve current time
       CLOCK().getRTC().adjust(DateTime(year, month, day, now.hour(), now.minute(), now.second()));
     } else {
-      OLED().oledWord("Invalid format (use YYYYMMDD)");
-      delay(2000);
+      OLED().toast("Invalid format (use YYYYMMDD)", 2000);
     }
     return;
   }
@@ -42,8 +41,7 @@ void settingCommandSelect(String command) {
     String luminaPart = command.substring(7);
     int lumina = stringToInt(luminaPart);
     if (lumina == -1) {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
     else if (lumina > 255) lumina = 255;
@@ -54,8 +52,7 @@ void settingCommandSelect(String command) {
     prefs.putInt("OLED_BRIGHTNESS", OLED_BRIGHTNESS);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
   else if (command.startsWith("timeout ")) {
@@ -69,16 +66,14 @@ void settingCommandSelect(String command) {
     prefs.putInt("TIMEOUT", TIMEOUT);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
   else if (command.startsWith("oledfps ")) {
     String oledfpsPart = command.substring(8);
     int oledfps = stringToInt(oledfpsPart);
     if (oledfps == -1) {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
     else if (oledfps > 144) oledfps = 144;
@@ -88,8 +83,7 @@ void settingCommandSelect(String command) {
     prefs.putInt("OLED_MAX_FPS", OLED_MAX_FPS);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
   else if (command.startsWith("clock ")) {
@@ -97,8 +91,7 @@ void settingCommandSelect(String command) {
     clockPart.trim();
 
     if (clockPart != "t" && clockPart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -107,8 +100,7 @@ void settingCommandSelect(String command) {
     prefs.putBool("SYSTEM_CLOCK", SYSTEM_CLOCK);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
 
@@ -117,8 +109,7 @@ void settingCommandSelect(String command) {
     yearPart.trim();
 
     if (yearPart != "t" && yearPart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -127,8 +118,7 @@ void settingCommandSelect(String command) {
     prefs.putBool("SHOW_YEAR", SHOW_YEAR);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
 
@@ -137,8 +127,7 @@ void settingCommandSelect(String command) {
     savePowerPart.trim();
 
     if (savePowerPart != "t" && savePowerPart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -147,8 +136,7 @@ void settingCommandSelect(String command) {
     prefs.putBool("SAVE_POWER", SAVE_POWER);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
 
@@ -157,8 +145,7 @@ void settingCommandSelect(String command) {
     debugPart.trim();
 
     if (debugPart != "t" && debugPart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -167,8 +154,7 @@ void settingCommandSelect(String command) {
     prefs.putBool("DEBUG_VERBOSE", DEBUG_VERBOSE);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
 
@@ -177,8 +163,7 @@ void settingCommandSelect(String command) {
     bootHomePart.trim();
 
     if (bootHomePart != "t" && bootHomePart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -187,8 +172,7 @@ void settingCommandSelect(String command) {
     prefs.putBool("HOME_ON_BOOT", HOME_ON_BOOT);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
 
@@ -197,8 +181,7 @@ void settingCommandSelect(String command) {
     noSDPart.trim();
 
     if (noSDPart != "t" && noSDPart != "f") {
-      OLED().oledWord("Invalid");
-      delay(500);
+      OLED().toast("Invalid", 500);
       return;
     }
 
@@ -207,75 +190,66 @@ void settingCommandSelect(String command) {
     prefs.putBool("ALLOW_NO_MICROSD", ALLOW_NO_MICROSD);
     prefs.end();
     newState = true;
-    OLED().oledWord("Settings Updated");
-    delay(200);
+    OLED().toast("Settings Updated", 200);
     return;
   }
   else {
-    OLED().oledWord("Huh?");
-    delay(1000);
+    OLED().toast("Huh?", 1000);
   }
   return;
 }
 
 void processKB_settings() {
-  int currentMillis = millis();
+  char inchar;
 
   switch (CurrentSettingsState) {
     case settings0:
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          settingCommandSelect(currentLine);
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
-          HOME_INIT();
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        settingCommandSelect(currentLine);
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        HOME_INIT();
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
 
     case settings1:
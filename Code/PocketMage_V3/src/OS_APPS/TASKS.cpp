@@ -129,186 +129,157 @@ String convertDateFormat(String yyyymmdd) {
 
 void processKB_TASKS() {
   OLED().setPowerSave(false);
-  int currentMillis = millis();
   disableTimeout = false;
   char inchar;
 
   switch (CurrentTasksState) {
     case TASKS0:
       KB().setKeyboardState(FUNC);
-      //Make keyboard only updates after cooldown
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8 || inchar == 12) {
-          HOME_INIT();
-          break;
-        }
-        // NEW TASK
-        else if (inchar == '/' || inchar == 'n' || inchar == 'N') {
-          CurrentTasksState = TASKS0_NEWTASK;
-          KB().setKeyboardState(NORMAL);
-          newTaskState = 0;
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8 || inchar == 12) {
+        HOME_INIT();
+        break;
+      }
+      // NEW TASK
+      else if (inchar == '/' || inchar == 'n' || inchar == 'N') {
+        CurrentTasksState = TASKS0_NEWTASK;
+        KB().setKeyboardState(NORMAL);
+        newTaskState = 0;
+        newState = true;
+        break;
+      }
+      // SELECT A TASK
+      else if (inchar >= '0' && inchar <= '9') {
+        int taskIndex = (inchar == '0') ? 10 : (inchar - '1');  // Adjust for 1-based input
+
+        // SET SELECTED TASK
+        if (taskIndex < tasks.size()) {
+          selectedTask = taskIndex;
+          // GO TO TASKS1
+          CurrentTasksState = TASKS1;
+          editTaskState = 0;
           newState = true;
-          break;
         }
-        // SELECT A TASK
-        else if (inchar >= '0' && inchar <= '9') {
-          int taskIndex = (inchar == '0') ? 10 : (inchar - '1');  // Adjust for 1-based input
-
-          // SET SELECTED TASK
-          if (taskIndex < tasks.size()) {
-            selectedTask = taskIndex;
-            // GO TO TASKS1
-            CurrentTasksState = TASKS1;
-            editTaskState = 0;
-            newState = true;
-          }
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledWord(currentWord);
-        }
-        KBBounceMillis = currentMillis;
       }
+
+      OLED().oledWord(currentWord);
       break;
     case TASKS0_NEWTASK:
       if (newTaskState == 1) KB().setKeyboardState(FUNC);
 
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        inchar = KB().updateKeypress();
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);                                        
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8 || inchar == 12) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
+      inchar = KB().updateKeypress();
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);                                        
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8 || inchar == 12) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        //ENTER Recieved
-        else if (inchar == 13) {                          
-          // ENTER INFORMATION BASED ON STATE
-          switch (newTaskState) {
-            case 0: // ENTER TASK NAME
-              newTaskName = currentLine;
+      }
+      //ENTER Recieved
+      else if (inchar == 13) {                          
+        // ENTER INFORMATION BASED ON STATE
+        switch (newTaskState) {
+          case 0: // ENTER TASK NAME
+            newTaskName = currentLine;
+            currentLine = "";
+            newTaskState = 1;
+            newState = true;
+            break;
+          case 1: // ENTER DUE DATE
+            String testDate = convertDateFormat(currentLine);
+            // DATE IS VALID
+            if (testDate != "Invalid") {
+              newTaskDueDate = currentLine;
+
+              // ADD NEW TASK
+              addTask(newTaskName, newTaskDueDate, "0", "0");
+              OLED().toast("New Task Added", 1000);
+
+              // RETURN
               currentLine = "";
-              newTaskState = 1;
+              newTaskState = 0;
+              CurrentTasksState = TASKS0;
               newState = true;
-              break;
-            case 1: // ENTER DUE DATE
-              String testDate = convertDateFormat(currentLine);
-              // DATE IS VALID
-              if (testDate != "Invalid") {
-                newTaskDueDate = currentLine;
-
-                // ADD NEW TASK
-                addTask(newTaskName, newTaskDueDate, "0", "0");
-                OLED().oledWord("New Task Added");
-                delay(1000);
-
-                // RETURN
-                currentLine = "";
-                newTaskState = 0;
-                CurrentTasksState = TASKS0;
-                newState = true;
-              }
-              // DATE IS INVALID
-              else {
-                OLED().oledWord("Invalid Date");
-                delay(1000);
-                currentLine = "";
-              }
-              break;
-          }
-        } 
-
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+            }
+            // DATE IS INVALID
+            else {
+              OLED().toast("Invalid Date", 1000);
+              currentLine = "";
+            }
+            break;
         }
+      } 
 
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false);
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false);
       break;
     case TASKS1:
       disableTimeout = false;
 
       KB().setKeyboardState(FUNC);
-      currentMillis = millis();
-      //Make sure oled only updates at 60fps
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-        char inchar = KB().updateKeypress();
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8 || inchar == 12) {
-          CurrentTasksState = TASKS0;
-          EINK().forceSlowFullUpdate(true);
-          newState = true;
-          break;
-        }
-        // SELECT A TASK
-        else if (inchar >= '1' && inchar <= '4') {
-          if (inchar == '1') {      // RENAME TASK
-
-          }
-          else if (inchar == '2') { // CHANGE DUE DATE
+      inchar = KB().updateKeypress();
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8 || inchar == 12) {
+        CurrentTasksState = TASKS0;
+        EINK().forceSlowFullUpdate(true);
+        newState = true;
+        break;
+      }
+      // SELECT A TASK
+      else if (inchar >= '1' && inchar <= '4') {
+        if (inchar == '1') {      // RENAME TASK
 
-          }
-          else if (inchar == '3') { // DELETE TASK
-            deleteTask(selectedTask);
-            updateTasksFile();
-            
-            CurrentTasksState = TASKS0;
-            EINK().forceSlowFullUpdate(true);
-            newState = true;
-          }
-          else if (inchar == '4') { // COPY TASK
+        }
+        else if (inchar == '2') { // CHANGE DUE DATE
 
-          }
+        }
+        else if (inchar == '3') { // DELETE TASK
+          deleteTask(selectedTask);
+          updateTasksFile();
           
+          CurrentTasksState = TASKS0;
+          EINK().forceSlowFullUpdate(true);
+          newState = true;
         }
+        else if (inchar == '4') { // COPY TASK
 
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledWord(currentWord);
         }
-        KBBounceMillis = currentMillis;
+        
       }
+
+      OLED().oledWord(currentWord);
       break;
   
   }
@@ -348,7 +319,7 @@ void einkHandler_TASKS() {
         }
         else EINK().drawStatusBar("No Tasks! Add New Task (N)");
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
       case TASKS0_NEWTASK:
@@ -389,7 +360,7 @@ void einkHandler_TASKS() {
               break;
           }
 
-          EINK().refresh();
+          EINK().requestRefresh(REFRESH_MENU);
         }
         break;
     case TASKS1:
@@ -401,7 +372,7 @@ void einkHandler_TASKS() {
         EINK().drawStatusBar("T:" + tasks[selectedTask][0]);
         display.drawBitmap(0, 0, tasksApp1, 320, 218, GxEPD_BLACK);
 
-        EINK().refresh();
+        EINK().requestRefresh(REFRESH_MENU);
       }
       break;
     
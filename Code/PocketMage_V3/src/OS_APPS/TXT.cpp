@@ -8,6 +8,8 @@
 
 #include <globals.h>
 #if !OTA_APP // POCKETMAGE_OS
+#include <wordWrap.h>
+
 enum TXTState { TXT_, WIZ0, WIZ1, WIZ2, WIZ3, FONT };
 TXTState CurrentTXTState = TXT_;
 
@@ -32,257 +34,231 @@ void processKB_TXT_OLD() {
   
   disableTimeout = false;
 
-  unsigned long currentMillis = millis();
-  if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-    char inchar = KB().updateKeypress();
-    switch (CurrentTXTState) {
-      case TXT_:
-        // SET MAXIMUMS AND FONT
-        EINK().setTXTFont(EINK().getCurrentFont());
-
-        // UPDATE SCROLLBAR
-        TOUCH().updateScrollFromTouch();
-
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);  
-        else if (inchar == 12) {
-          CurrentAppState = HOME;
-          currentLine     = "";
-          newState        = true;
-          KB().setKeyboardState(NORMAL);
-        }
-        //TAB Recieved
-        else if (inchar == 9) {                                  
-          currentLine += "    ";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          currentLine += " ";
+  char inchar = KB().updateKeypress();
+  switch (CurrentTXTState) {
+    case TXT_:
+      // SET MAXIMUMS AND FONT
+      EINK().setTXTFont(EINK().getCurrentFont());
+
+      // UPDATE SCROLLBAR
+      TOUCH().updateScrollFromTouch();
+
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);  
+      else if (inchar == 12) {
+        CurrentAppState = HOME;
+        currentLine     = "";
+        newState        = true;
+        KB().setKeyboardState(NORMAL);
+      }
+      //TAB Recieved
+      else if (inchar == 9) {                                  
+        currentLine += "    ";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        currentLine += " ";
+      }
+      //CR Recieved
+      else if (inchar == 13) {                          
+        addLine(currentLine, WRAP_HARD);
+        currentLine = "";
+        newLineAdded = true;
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        clearLines();
+        currentLine = "";
+        OLED().toast("Clearing...", 300);
+        doFull = true;
+        newLineAdded = true;
+      }
+      // LEFT
+      else if (inchar == 19) {                                  
+        
+      }
+      // RIGHT
+      else if (inchar == 21) {                                  
+        
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        //CR Recieved
-        else if (inchar == 13) {                          
-          allLines.push_back(currentLine);
-          currentLine = "";
+      }
+      //SAVE Recieved
+      else if (inchar == 6) {
+        //File exists, save normally
+        if (SD().getEditingFile() != "" && SD().getEditingFile() != "-") {
+          SD().saveFile();
+          KB().setKeyboardState(NORMAL);
           newLineAdded = true;
         }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          allLines.clear();
+        //File does not exist, make a new one
+        else {
+          CurrentTXTState = WIZ3;
           currentLine = "";
-          OLED().oledWord("Clearing...");
+          KB().setKeyboardState(NORMAL);
           doFull = true;
-          newLineAdded = true;
-          delay(300);
-        }
-        // LEFT
-        else if (inchar == 19) {                                  
-          
-        }
-        // RIGHT
-        else if (inchar == 21) {                                  
-          
+          newState = true;
         }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
+      }
+      //LOAD Recieved
+      else if (inchar == 5) {
+        SD().loadFile();
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+      }
+      //FILE Recieved
+      else if (inchar == 7) {
+        CurrentTXTState = WIZ0;
+        KB().setKeyboardState(NORMAL);
+        newState = true;
+      }
+      // Font Switcher 
+      else if (inchar == 14) {                                  
+        CurrentTXTState = FONT;
+        KB().setKeyboardState(FUNC);
+        newState = true;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
-        //SAVE Recieved
-        else if (inchar == 6) {
-          //File exists, save normally
-          if (SD().getEditingFile() != "" && SD().getEditingFile() != "-") {
-            SD().saveFile();
-            KB().setKeyboardState(NORMAL);
-            newLineAdded = true;
+      }
+
+      // ONLY SHOW OLEDLINE WHEN NOT IN SCROLL MODE
+      if (TOUCH().getLastTouch() == -1) {
+        OLED().oledLine(currentLine);
+        if (TOUCH().getPrevDynamicScroll() != TOUCH().getDynamicScroll()) TOUCH().setPrevDynamicScroll(TOUCH().getDynamicScroll());
+      }
+      else OLED().oledScroll();
+
+      if (currentLine.length() > 0) {
+        int16_t x1, y1;
+        uint16_t charWidth, charHeight;
+        display.getTextBounds(currentLine, 0, 0, &x1, &y1, &charWidth, &charHeight);
+
+        if (charWidth >= display.width()-5) {
+          // If currentLine ends with a space, just start a new line
+          if (currentLine.endsWith(" ")) {
+            addLine(currentLine, WRAP_SOFT);
+            currentLine = "";
           }
-          //File does not exist, make a new one
+          // If currentLine ends with a letter, we are in the middle of a word
           else {
-            CurrentTXTState = WIZ3;
-            currentLine = "";
-            KB().setKeyboardState(NORMAL);
-            doFull = true;
-            newState = true;
+            int lastSpace = currentLine.lastIndexOf(' ');
+            String partialWord;
+
+            if (lastSpace != -1) {
+              partialWord = currentLine.substring(lastSpace + 1);
+              currentLine = currentLine.substring(0, lastSpace);  // Strip partial word
+              addLine(currentLine, WRAP_SPACE);
+              currentLine = partialWord;  // Start new line with the partial word
+            } 
+            // No spaces found, whole line is a single word
+            else {
+              addLine(currentLine, WRAP_SOFT);
+              currentLine = "";
+            }
           }
-        }
-        //LOAD Recieved
-        else if (inchar == 5) {
-          SD().loadFile();
-          KB().setKeyboardState(NORMAL);
           newLineAdded = true;
         }
-        //FILE Recieved
-        else if (inchar == 7) {
-          CurrentTXTState = WIZ0;
-          KB().setKeyboardState(NORMAL);
-          newState = true;
-        }
-        // Font Switcher 
-        else if (inchar == 14) {                                  
-          CurrentTXTState = FONT;
-          KB().setKeyboardState(FUNC);
-          newState = true;
-        }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
-        }
+      }
 
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/60)) {
-          OLEDFPSMillis = currentMillis;
-          // ONLY SHOW OLEDLINE WHEN NOT IN SCROLL MODE
-          if (TOUCH().getLastTouch() == -1) {
-            OLED().oledLine(currentLine);
-            if (TOUCH().getPrevDynamicScroll() != TOUCH().getDynamicScroll()) TOUCH().setPrevDynamicScroll(TOUCH().getDynamicScroll());
+      break;
+    case WIZ0:
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8) {                  
+        CurrentTXTState = TXT_;
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+        currentWord = "";
+        currentLine = "";
+        display.fillScreen(GxEPD_WHITE);
+      }
+      else if (inchar >= '0' && inchar <= '9'){
+        int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
+        //Edit a new file
+        if (SD().getFilesListIndex(fileIndex - 1) != SD().getEditingFile()) { 
+          //Selected file does not exist, create a new one
+          if (SD().getFilesListIndex(fileIndex - 1) == "-") {
+            CurrentTXTState = WIZ3;
+            EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
+            newState = true;
+            display.fillScreen(GxEPD_WHITE);
           }
-          else OLED().oledScroll();
-        }
-
-        if (currentLine.length() > 0) {
-          int16_t x1, y1;
-          uint16_t charWidth, charHeight;
-          display.getTextBounds(currentLine, 0, 0, &x1, &y1, &charWidth, &charHeight);
-
-          if (charWidth >= display.width()-5) {
-            // If currentLine ends with a space, just start a new line
-            if (currentLine.endsWith(" ")) {
-              allLines.push_back(currentLine);
-              currentLine = "";
-            }
-            // If currentLine ends with a letter, we are in the middle of a word
-            else {
-              int lastSpace = currentLine.lastIndexOf(' ');
-              String partialWord;
-
-              if (lastSpace != -1) {
-                partialWord = currentLine.substring(lastSpace + 1);
-                currentLine = currentLine.substring(0, lastSpace);  // Strip partial word
-                allLines.push_back(currentLine);
-                currentLine = partialWord;  // Start new line with the partial word
-              } 
-              // No spaces found, whole line is a single word
-              else {
-                allLines.push_back(currentLine);
-                currentLine = "";
-              }
-            }
-            newLineAdded = true;
+          //Selected file exists, prompt to save current file
+          else {      
+            prevEditingFile = SD().getEditingFile();
+            SD().setEditingFile(SD().getFilesListIndex(fileIndex - 1));      
+            CurrentTXTState = WIZ1;
+            EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
+            newState = true;
+            display.fillScreen(GxEPD_WHITE);
           }
         }
-
-        break;
-      case WIZ0:
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8) {                  
-          CurrentTXTState = TXT_;
+        //Selected file is current file, return to editor
+        else {
           KB().setKeyboardState(NORMAL);
+          CurrentTXTState = TXT_;
           newLineAdded = true;
           currentWord = "";
           currentLine = "";
           display.fillScreen(GxEPD_WHITE);
         }
-        else if (inchar >= '0' && inchar <= '9'){
-          int fileIndex = (inchar == '0') ? 10 : (inchar - '0');
-          //Edit a new file
-          if (SD().getFilesListIndex(fileIndex - 1) != SD().getEditingFile()) { 
-            //Selected file does not exist, create a new one
-            if (SD().getFilesListIndex(fileIndex - 1) == "-") {
-              CurrentTXTState = WIZ3;
-              EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
-              newState = true;
-              display.fillScreen(GxEPD_WHITE);
-            }
-            //Selected file exists, prompt to save current file
-            else {      
-              prevEditingFile = SD().getEditingFile();
-              SD().setEditingFile(SD().getFilesListIndex(fileIndex - 1));      
-              CurrentTXTState = WIZ1;
-              EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
-              newState = true;
-              display.fillScreen(GxEPD_WHITE);
-            }
-          }
-          //Selected file is current file, return to editor
-          else {
-            KB().setKeyboardState(NORMAL);
-            CurrentTXTState = TXT_;
-            newLineAdded = true;
+
+      }
+
+      OLED().oledLine(currentWord, false);
+      break;
+    case WIZ1:
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8) {                  
+        CurrentTXTState = WIZ0;
+        KB().setKeyboardState(FUNC);
+        EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
+        newState = true;
+        display.fillScreen(GxEPD_WHITE);
+      }
+      else if (inchar >= '0' && inchar <= '9'){
+        int numSelect = (inchar == '0') ? 10 : (inchar - '0');
+        //YES (save current file)
+        if (numSelect == 1) {
+          //File to be saved does not exist
+          if (prevEditingFile == "" || prevEditingFile == "-") {
+            CurrentTXTState = WIZ2;
             currentWord = "";
-            currentLine = "";
+            KB().setKeyboardState(NORMAL);
+            EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
+            newState = true;
             display.fillScreen(GxEPD_WHITE);
           }
+          //File to be saved exists
+          else {
+            //Save current file
+            SD().saveFile();
 
-        }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        break;
-      case WIZ1:
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8) {                  
-          CurrentTXTState = WIZ0;
-          KB().setKeyboardState(FUNC);
-          EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
-          newState = true;
-          display.fillScreen(GxEPD_WHITE);
-        }
-        else if (inchar >= '0' && inchar <= '9'){
-          int numSelect = (inchar == '0') ? 10 : (inchar - '0');
-          //YES (save current file)
-          if (numSelect == 1) {
-            //File to be saved does not exist
-            if (prevEditingFile == "" || prevEditingFile == "-") {
-              CurrentTXTState = WIZ2;
-              currentWord = "";
-              KB().setKeyboardState(NORMAL);
-              EINK().setFullRefreshAfter(FULL_REFRESH_AFTER + 1);
-              newState = true;
-              display.fillScreen(GxEPD_WHITE);
-            }
-            //File to be saved exists
-            else {
-              //Save current file
-              SD().saveFile();
-
-              delay(200);
-              //Load new file
-              SD().loadFile();
-              //Return to TXT
-              CurrentTXTState = TXT_;
-              KB().setKeyboardState(NORMAL);
-              newLineAdded = true;
-              currentWord = "";
-              currentLine = "";
-              display.fillScreen(GxEPD_WHITE);
-            }
-          }
-          //NO  (don't save current file)
-          else if (numSelect == 2) {
-            //Just load new file
+            delay(200);
+            //Load new file
             SD().loadFile();
             //Return to TXT
             CurrentTXTState = TXT_;
@@ -293,201 +269,192 @@ void processKB_TXT_OLD() {
             display.fillScreen(GxEPD_WHITE);
           }
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        break;
-
-      case WIZ2:
-        //No char recieved
-        if (inchar == 0);                                         
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-          newState = true;
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-          newState = true;
-        }
-        //Space Recieved
-        else if (inchar == 32) {}
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentWord = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentWord.length() > 0) {
-            currentWord.remove(currentWord.length() - 1);
-          }
-        }
-        //ENTER Recieved
-        else if (inchar == 13) {                          
-          prevEditingFile = "/" + currentWord + ".txt";
-
-          //Save the file
-          SD().saveFile();
-
-          delay(200);
-          //Load new file
+        //NO  (don't save current file)
+        else if (numSelect == 2) {
+          //Just load new file
           SD().loadFile();
-
-          keypad.enableInterrupts();
-
-          //Return to TXT_
+          //Return to TXT
           CurrentTXTState = TXT_;
           KB().setKeyboardState(NORMAL);
           newLineAdded = true;
           currentWord = "";
           currentLine = "";
+          display.fillScreen(GxEPD_WHITE);
         }
-        //All other chars
-        else {
-          //Only allow char to be added if it's an allowed char
-          if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL){
-            KB().setKeyboardState(NORMAL);
-          }
-        }
+      }
+
+      OLED().oledLine(currentWord, false);
+      break;
+
+    case WIZ2:
+      //No char recieved
+      if (inchar == 0);                                         
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+        newState = true;
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+        newState = true;
+      }
+      //Space Recieved
+      else if (inchar == 32) {}
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentWord = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentWord.length() > 0) {
+          currentWord.remove(currentWord.length() - 1);
+        }
+      }
+      //ENTER Recieved
+      else if (inchar == 13) {                          
+        prevEditingFile = "/" + currentWord + ".txt";
+
+        //Save the file
+        SD().saveFile();
+
+        delay(200);
+        //Load new file
+        SD().loadFile();
 
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        break;
-      case WIZ3:
-        //No char recieved
-        if (inchar == 0);                                         
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {}
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentWord = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentWord.length() > 0) {
-            currentWord.remove(currentWord.length() - 1);
-          }
-        }
-        //ENTER Recieved
-        else if (inchar == 13) {                          
-          prevEditingFile = "/" + currentWord + ".txt";
+        keypad.enableInterrupts();
 
-          //Save the file
-          SD().saveFile();
-          //Ask to save prev file
-          
-          //Return to TXT_
-          CurrentTXTState = TXT_;
+        //Return to TXT_
+        CurrentTXTState = TXT_;
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+        currentWord = "";
+        currentLine = "";
+      }
+      //All other chars
+      else {
+        //Only allow char to be added if it's an allowed char
+        if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL){
           KB().setKeyboardState(NORMAL);
-          newLineAdded = true;
-          currentWord = "";
-          currentLine = "";
-        }
-        //All other chars
-        else {
-          //Only allow char to be added if it's an allowed char
-          if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL){
-            KB().setKeyboardState(NORMAL);
-          }
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        break;
-      case FONT:
-        //No char recieved
-        if (inchar == 0);
-        //BKSP Recieved
-        else if (inchar == 127 || inchar == 8) {                  
-          CurrentTXTState = TXT_;
+      }
+
+      OLED().oledLine(currentWord, false);
+      break;
+    case WIZ3:
+      //No char recieved
+      if (inchar == 0);                                         
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {}
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentWord = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentWord.length() > 0) {
+          currentWord.remove(currentWord.length() - 1);
+        }
+      }
+      //ENTER Recieved
+      else if (inchar == 13) {                          
+        prevEditingFile = "/" + currentWord + ".txt";
+
+        //Save the file
+        SD().saveFile();
+        //Ask to save prev file
+        
+        //Return to TXT_
+        CurrentTXTState = TXT_;
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+        currentWord = "";
+        currentLine = "";
+      }
+      //All other chars
+      else {
+        //Only allow char to be added if it's an allowed char
+        if (isalnum(inchar) || inchar == '_' || inchar == '-' || inchar == '.') currentWord += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL){
           KB().setKeyboardState(NORMAL);
-          newLineAdded = true;
-          currentWord = "";
-          currentLine = "";
-          display.fillScreen(GxEPD_WHITE);
         }
-        else if (inchar >= '0' && inchar <= '9') {
-          int fontIndex = (inchar == '0') ? 10 : (inchar - '0');
-          switch (fontIndex) {
-            case 1:
-              EINK().setCurrentFont(&FreeMonoBold9pt7b);
-              break;
-            case 2:
-              EINK().setCurrentFont(&FreeSans9pt7b);
-              break;
-            case 3:
-              EINK().setCurrentFont(&FreeSerif9pt7b);
-              break;
-            case 4:
-              EINK().setCurrentFont(&FreeSerifBold9pt7b);
-              break;
-            case 5:
-              EINK().setCurrentFont(&FreeMono12pt7b);
-              break;
-            case 6:
-              EINK().setCurrentFont(&FreeSans12pt7b);
-              break;
-            case 7:
-              EINK().setCurrentFont(&FreeSerif12pt7b);
-              break;
-            default:
-              EINK().setCurrentFont(&FreeMonoBold9pt7b);
-              break;
-          }
-          // SET THE FONT
-          EINK().setTXTFont(EINK().getCurrentFont());
+      }
 
-          // UPDATE THE ARRAY TO MATCH NEW FONT SIZE
-          String fullTextStr = vectorToString();
-          stringToVector(fullTextStr);
+      OLED().oledLine(currentWord, false);
+      break;
+    case FONT:
+      //No char recieved
+      if (inchar == 0);
+      //BKSP Recieved
+      else if (inchar == 127 || inchar == 8) {                  
+        CurrentTXTState = TXT_;
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+        currentWord = "";
+        currentLine = "";
+        display.fillScreen(GxEPD_WHITE);
+      }
+      else if (inchar >= '0' && inchar <= '9') {
+        int fontIndex = (inchar == '0') ? 10 : (inchar - '0');
+        switch (fontIndex) {
+          case 1:
+            EINK().setCurrentFont(&FreeMonoBold9pt7b);
+            break;
+          case 2:
+            EINK().setCurrentFont(&FreeSans9pt7b);
+            break;
+          case 3:
+            EINK().setCurrentFont(&FreeSerif9pt7b);
+            break;
+          case 4:
+            EINK().setCurrentFont(&FreeSerifBold9pt7b);
+            break;
+          case 5:
+            EINK().setCurrentFont(&FreeMono12pt7b);
+            break;
+          case 6:
+            EINK().setCurrentFont(&FreeSans12pt7b);
+            break;
+          case 7:
+            EINK().setCurrentFont(&FreeSerif12pt7b);
+            break;
+          default:
+            EINK().setCurrentFont(&FreeMonoBold9pt7b);
+            break;
+        }
+        // SET THE FONT
+        EINK().setTXTFont(EINK().getCurrentFont());
 
-          CurrentTXTState = TXT_;
-          KB().setKeyboardState(NORMAL);
-          newLineAdded = true;
-          currentWord = "";
-          currentLine = "";
-          display.fillScreen(GxEPD_WHITE);
-        }
+        // UPDATE THE ARRAY TO MATCH NEW FONT SIZE
+        String fullTextStr = vectorToString();
+        stringToVector(fullTextStr);
 
-        currentMillis = millis();
-        //Make sure oled only updates at 60fps
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentWord, false);
-        }
-        break;
+        CurrentTXTState = TXT_;
+        KB().setKeyboardState(NORMAL);
+        newLineAdded = true;
+        currentWord = "";
+        currentLine = "";
+        display.fillScreen(GxEPD_WHITE);
+      }
+
+      OLED().oledLine(currentWord, false);
+      break;
 
-    }
-    KBBounceMillis = currentMillis;
   }
 }
 
@@ -10,7 +10,8 @@
 #if !OTA_APP // POCKETMAGE_OS
 static constexpr const char* TAG = "TXT_NEWz";
 
-// Font includes
+// Fonts compiled in for packs that are missing (TXT_BUILTIN_FONTS in config.h)
+#if TXT_BUILTIN_FONTS
 // Mono
 #include <Fonts/FreeMono9pt8b.h>
 #include <Fonts/FreeMonoBold12pt8b.h>
@@ -47,12 +48,62 @@ static constexpr const char* TAG = "TXT_NEWz";
 #include <Fonts/FreeSansBoldOblique9pt8b.h>
 #include <Fonts/FreeSansOblique9pt8b.h>
 
+#define TXT_FONT(name) fontPack(#name "8b", &name##8b)
+#else
+// The same faces without the 8-bit glyphs, the 9pt ones missing here come with pocketmage_eink.h
+// Mono
+#include <Fonts/FreeMono9pt7b.h>
+#include <Fonts/FreeMonoBold12pt7b.h>
+#include <Fonts/FreeMonoBold18pt7b.h>
+#include <Fonts/FreeMonoBold24pt7b.h>
+#include <Fonts/FreeMonoBoldOblique12pt7b.h>
+#include <Fonts/FreeMonoBoldOblique18pt7b.h>
+#include <Fonts/FreeMonoBoldOblique24pt7b.h>
+#include <Fonts/FreeMonoBoldOblique9pt7b.h>
+#include <Fonts/FreeMonoOblique9pt7b.h>
+
+// Serif
+#include <Fonts/FreeSerifBold12pt7b.h>
+#include <Fonts/FreeSerifBold18pt7b.h>
+#include <Fonts/FreeSerifBold24pt7b.h>
+#include <Fonts/FreeSerifBoldItalic12pt7b.h>
+#include <Fonts/FreeSerifBoldItalic18pt7b.h>
+#include <Fonts/FreeSerifBoldItalic24pt7b.h>
+#include <Fonts/FreeSerifBoldItalic9pt7b.h>
+#include <Fonts/FreeSerifItalic9pt7b.h>
+
+// Sans
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold18pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSansBoldOblique12pt7b.h>
+#include <Fonts/FreeSansBoldOblique18pt7b.h>
+#include <Fonts/FreeSansBoldOblique24pt7b.h>
+#include <Fonts/FreeSansBoldOblique9pt7b.h>
+#include <Fonts/FreeSansOblique9pt7b.h>
+
+#define TXT_FONT(name) fontPack(#name "8b", &name##7b)
+#endif
+
 #include "esp32-hal-log.h"
 #include "esp_log.h"
+#include <textMetrics.h>
+#include <lineIndex.h>
+#include <gapBuffer.h>
+#include <displayList.h>
+#include <doubleBuffer.h>
+#include <markdownParse.h>
+#include <docArena.h>
+#include <bufferedWriter.h>
+#include <editLog.h>
+#include <docSpans.h>
+#include <fontPack.h>
 
 // ------------------ General ------------------
 enum TXTState_NEW { TXT_, FONT, SAVE_AS, LOAD_FILE, JOURNAL_MODE, NEW_FILE };
 TXTState_NEW CurrentTXTState_NEW = TXT_;
+TXTState_NEW PrevTXTState_NEW = TXT_;  // State to return to from FONT
 
 #define TYPE_INTERFACE_TIMEOUT 5000  // ms
 #define SCROLL_LINE_OFFSET 3         // lines
@@ -68,50 +119,90 @@ TXTState_NEW CurrentTXTState_NEW = TXT_;
 enum FontFamily { serif = 0, sans = 1, mono = 2 };
 uint8_t fontStyle = sans;
 
+// Fonts are packs in FONT_DIR (see fontPack.h), loaded by pickFont() when first used. A
+// missing pack falls back to the font compiled in for it (see TXT_FONT)
 struct FontMap {
-  const GFXfont* normal;
-  const GFXfont* normal_B;
-  const GFXfont* normal_I;
-  const GFXfont* normal_BI;
-
-  const GFXfont* h1;
-  const GFXfont* h1_B;
-  const GFXfont* h1_I;
-  const GFXfont* h1_BI;
-
-  const GFXfont* h2;
-  const GFXfont* h2_B;
-  const GFXfont* h2_I;
-  const GFXfont* h2_BI;
-
-  const GFXfont* h3;
-  const GFXfont* h3_B;
-  const GFXfont* h3_I;
-  const GFXfont* h3_BI;
-
-  const GFXfont* code;
-  const GFXfont* code_B;
-  const GFXfont* code_I;
-  const GFXfont* code_BI;
-
-  const GFXfont* quote;
-  const GFXfont* quote_B;
-  const GFXfont* quote_I;
-  const GFXfont* quote_BI;
-
-  const GFXfont* list;
-  const GFXfont* list_B;
-  const GFXfont* list_I;
-  const GFXfont* list_BI;
+  FontHandle* normal;
+  FontHandle* normal_B;
+  FontHandle* normal_I;
+  FontHandle* normal_BI;
+
+  FontHandle* h1;
+  FontHandle* h1_B;
+  FontHandle* h1_I;
+  FontHandle* h1_BI;
+
+  FontHandle* h2;
+  FontHandle* h2_B;
+  FontHandle* h2_I;
+  FontHandle* h2_BI;
+
+  FontHandle* h3;
+  FontHandle* h3_B;
+  FontHandle* h3_I;
+  FontHandle* h3_BI;
+
+  FontHandle* code;
+  FontHandle* code_B;
+  FontHandle* code_I;
+  FontHandle* code_BI;
+
+  FontHandle* quote;
+  FontHandle* quote_B;
+  FontHandle* quote_I;
+  FontHandle* quote_BI;
+
+  FontHandle* list;
+  FontHandle* list_B;
+  FontHandle* list_I;
+  FontHandle* list_BI;
+
+  // SPACEWIDTH_SYMBOL width per slot (see fontSlot), measured once on first use
+  int16_t spaceWidth[28];
 };
 
 FontMap fonts[3];
 
+bool loadPackFromSD(const char* path, FontCache& cache, GFXfont& font, uint8_t*& block,
+                    size_t& bytes) {
+  SDActive = true;
+  File f = SD_MMC.open(path);
+  bool ok = f && loadFontPack([&](uint8_t* dst, size_t n) { return f.read(dst, n); },
+                              [&](size_t n) { return cache.allocate(n); }, font, block, bytes);
+  if (f)
+    f.close();
+  SDActive = false;
+  if (!ok)
+    ESP_LOGW(TAG, "No font pack %s, using the built-in font", path);
+  return ok;
+}
+uint32_t fontClock() { return micros(); }
+FontCache fontCache(FONT_CACHE_BYTES, loadPackFromSD, fontClock);
+
+FontHandle* fontPack(const char* name, const GFXfont* fallback) {
+  return fontCache.handle((String(FONT_DIR) + name + ".pmf").c_str(), fallback);
+}
+
 void setFontStyle(FontFamily f) {
   fontStyle = f;
 }
 
-const GFXfont* pickFont(char style, bool bold, bool italic) {
+// Index of a font inside FontMap: 4 variants (normal, B, I, BI) per style
+uint8_t fontSlot(char style, bool bold, bool italic) {
+  uint8_t base;
+  switch (style) {
+    case '1': base = 4;  break;
+    case '2': base = 8;  break;
+    case '3': base = 12; break;
+    case 'C': base = 16; break;
+    case '>': base = 20; break;
+    case '-': base = 24; break;
+    default:  base = 0;  break;
+  }
+  return base + (bold ? 1 : 0) + (italic ? 2 : 0);
+}
+
+FontHandle* pickHandle(char style, bool bold, bool italic) {
   FontMap& fm = fonts[fontStyle];  // currently active family
 
   switch (style) {
@@ -180,71 +271,186 @@ const GFXfont* pickFont(char style, bool bold, bool italic) {
   }
 }
 
+// Font to draw and measure with, loaded from its pack if it isn't
+const GFXfont* pickFont(char style, bool bold, bool italic) {
+  return fontCache.use(pickHandle(style, bold, italic));
+}
+
+// Glyph tables for the font pickFont() would choose
+const FontMetrics& pickMetrics(char style, bool bold, bool italic) {
+  return fontMetrics(pickFont(style, bold, italic));
+}
+
+// Width used between words, cached per font in the active FontMap
+int16_t pickSpaceWidth(char style, bool bold, bool italic) {
+  int16_t& cached = fonts[fontStyle].spaceWidth[fontSlot(style, bold, italic)];
+  if (cached < 0)
+    cached = pickMetrics(style, bold, italic).width(SPACEWIDTH_SYMBOL);
+  return cached;
+}
+
 // ------------------ Document Variables ------------------
 static bool updateScreen = false;
-ulong indexCounter = 0;
 ulong lineScroll = 0;
 enum EditingModes { edit_inline = 0, edit_append = 1 };
 uint8_t currentEditMode = edit_append;
 String currentLine = "";
 
-struct wordObject {
-  String text;
-  bool bold;
-  bool italic;
+// Inline mode caret, kept up to date by updateCaret()
+ulong caretLine = 0;  // global line index
+int16_t caretX = 0;   // px from the start of the line's text
+
+// E-ink frames
+#define STATUS_BAR_HEIGHT 26           // drawStatusBar() area
+#define ROW_OVERDRAW 6                 // px descenders can hang below a row
+uint32_t fullRefreshRequests = 1;      // bumped when the next frame can't be a partial update
+ulong lastVisibleLine = 0;             // last line that fits above the status bar
+
+// Text, words and lines of the open document, reset when another one is loaded
+DocArena docArena;
+template <typename T>
+using DocVector = std::vector<T, ArenaAllocator<T>>;
+
+// Formatting is stored per character in DocLine::text
+#define ATTR_BOLD MD_BOLD
+#define ATTR_ITALIC MD_ITALIC
+
+// Run of non-space characters sharing one format, measured by splitToLines()
+struct WordSpan {
+  uint16_t start;   // offset into DocLine::text
+  uint16_t len;
+  uint16_t px;      // rendered width
+  uint8_t height;   // glyph box height
+  uint8_t attr;
+
+  bool bold() const { return attr & ATTR_BOLD; }
+  bool italic() const { return attr & ATTR_ITALIC; }
+};
+
+// Run of words that fit on one display line
+struct LineSpan {
+  uint16_t start;      // offset of the first character on this line
+  uint16_t firstWord;  // index into DocLine::words
+  uint16_t wordCount;
 };
 
-struct LineObject {
-  ulong index;
-  std::vector<wordObject> words;
+// Visual line as drawn by displayLine(), frames are compared row by row so only the
+// rows that changed get a partial e-ink update
+struct ScreenRow {
+  int16_t y;
+  uint8_t h;
+  ulong line;    // global line index
+  uint32_t sig;  // hash of everything drawn on the row
+};
+// Everything the e-ink task needs to draw a page. Built on the input loop and handed
+// over through a DoubleBuffer, so the e-ink task never reads docLines
+struct TxtFrame {
+  DisplayList list;
+  std::vector<ScreenRow> rows;
+  String status;
+  ulong scroll = 0;
+  uint32_t fullRefresh = 0;  // fullRefreshRequests when built
+  bool retired = false;      // left empty by retireFrames(), nothing to draw
+
+  void addRow(int y, int h, ulong line, uint32_t sig) {
+    rows.push_back({(int16_t)y, (uint8_t)h, line, sig});
+  }
 };
+DoubleBuffer<TxtFrame> txtFrames;
+
+// Empties both frame buffers, waiting for the e-ink task to let go of each. Their display
+// lists point into font packs, which can be freed once this returns.
+void retireFrames() {
+  for (int i = 0; i < 2; i++) {
+    TxtFrame* frame;
+    while (!(frame = txtFrames.beginWrite()))
+      vTaskDelay(pdMS_TO_TICKS(10));
+    frame->list.clear();
+    frame->rows.clear();
+    frame->retired = true;
+    txtFrames.publish();
+  }
+}
+
+// FNV-1a, only has to tell two versions of a row apart
+uint32_t hashBytes(uint32_t hash, const void* data, size_t n) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i = 0; i < n; i++) hash = (hash ^ p[i]) * 16777619u;
+  return hash;
+}
 
 // Document Line object
 struct DocLine {
-  char style;                     // Markdown style: '1', '2', '3', '>', '-', etc.
-  String line;                    // Raw line content
-  std::vector<wordObject> words;  // Parsed words with formatting
-  std::vector<LineObject> lines;  // split into line objects
-  ulong orderedListNumber;
+  char style = 'T';               // Markdown style: '1', '2', '3', '>', '-', etc.
+  GapBuffer text{&docArena};      // Plain text, bold/italic kept as character attributes
+  // Words as spans into text
+  DocVector<WordSpan> words{ArenaAllocator<WordSpan>(&docArena)};
+  // Display lines, at least one after splitToLines()
+  DocVector<LineSpan> lines{ArenaAllocator<LineSpan>(&docArena)};
+  ulong orderedListNumber = 0;
+
+  explicit DocLine(char style = 'T') : style(style) {}
+
+  // Load markdown content, emphasis markers become attributes. Fills words too
+  void setMarkdown(const char* s, size_t n) {
+    text.clear();
+    words.clear();
+    parseMarkdownInline(
+        s, n,
+        [&](const char* run, size_t len, uint8_t attr) {
+          text.insert(text.size(), run, len, attr);
+        },
+        [&](size_t start, size_t len, uint8_t attr) {
+          words.push_back({(uint16_t)start, (uint16_t)len, 0, 0, attr});
+        });
+    text.shrinkToFit();
+  }
+
+  // Append the markdown form of this line's text to out
+  void appendMarkdown(String& out) const {
+    out.reserve(out.length() + text.size() + 8);
+    for (size_t i = 0; i < words.size(); i++) {
+      const WordSpan& w = words[i];
+      // Keep the spacing between words, markers always hug the word
+      if (i > 0) {
+        for (size_t c = words[i - 1].start + words[i - 1].len; c < w.start; c++) out += ' ';
+      }
+
+      const char* marker = "";
+      if (w.bold() && w.italic())
+        marker = "***";
+      else if (w.bold())
+        marker = "**";
+      else if (w.italic())
+        marker = "*";
+
+      out += marker;
+      for (uint16_t c = 0; c < w.len; c++) out += text.at(w.start + c);
+      out += marker;
+    }
+  }
 
-  // Parse the line into wordObjects
+  bool hasText() const { return !words.empty(); }
+
+  // Rebuild word spans from text
   void parseWords() {
     words.clear();
-    int i = 0;
-    while (i < line.length()) {
-      if (line[i] == '*' && i + 1 < line.length() && line[i + 1] == '*') {
-        // Bold **...**
-        int end = line.indexOf("**", i + 2);
-        if (end == -1)
-          end = line.length();
-        String segment = line.substring(i + 2, end);
-        splitIntoWords(segment, true, false);
-        i = end + 2;
-      } else if (line[i] == '*') {
-        // Italic *...*
-        int end = line.indexOf("*", i + 1);
-        if (end == -1)
-          end = line.length();
-        String segment = line.substring(i + 1, end);
-        splitIntoWords(segment, false, true);
-        i = end + 1;
-      } else {
-        // Normal text until next * or **
-        int nextBold = line.indexOf("**", i);
-        int nextItalic = line.indexOf("*", i);
-        int end = line.length();
-        if (nextBold >= 0)
-          end = min(end, nextBold);
-        if (nextItalic >= 0)
-          end = min(end, nextItalic);
-        String segment = line.substring(i, end);
-        splitIntoWords(segment, false, false);
-        i = end;
+    const size_t n = text.size();
+    size_t i = 0;
+    while (i < n) {
+      if (text.at(i) == ' ') {
+        i++;
+        continue;
       }
+      const uint8_t attr = text.attrAt(i);
+      size_t end = i + 1;
+      while (end < n && text.at(end) != ' ' && text.attrAt(end) == attr) end++;
+      words.push_back({(uint16_t)i, (uint16_t)(end - i), 0, 0, attr});
+      i = end;
     }
   }
 
-  // Split word objects into lines
+  // Measure words and split them into lines
   void splitToLines() {
     uint16_t textWidth = display.width() - DISPLAY_WIDTH_BUFFER;
 
@@ -256,75 +462,67 @@ struct DocLine {
     }
 
     lines.clear();
-    LineObject currentLine;
+    lines.push_back({0, 0, 0});
     int lineWidth = 0;
 
-    for (auto& w : words) {
-      const GFXfont* font = pickFont(style, w.bold, w.italic);
-      display.setFont(font);
-
-      int16_t x1, y1;
-      uint16_t wpx, hpx;
-      display.getTextBounds(w.text.c_str(), 0, 0, &x1, &y1, &wpx, &hpx);
-
-      int spaceWidth;
-      display.getTextBounds(SPACEWIDTH_SYMBOL, 0, 0, &x1, &y1, (uint16_t*)&spaceWidth, &hpx);
+    for (size_t i = 0; i < words.size(); i++) {
+      WordSpan& w = words[i];
+      TextBounds b = pickMetrics(style, w.bold(), w.italic()).bounds(text.contiguous(w.start, w.len), w.len);
+      w.px = b.w;
+      w.height = b.h;
 
       // Calculate width for this word plus space
-      int addWidth =
-          wpx + spaceWidth + WORDWIDTH_BUFFER;  // IDK why 12 makes the text wrap work perfectly...
-
-      // If the word doesn't fit, start a new line
-      if (lineWidth > 0 && (lineWidth + addWidth > textWidth)) {
-        currentLine.index = indexCounter++;
-        lines.push_back(currentLine);
-
-        currentLine.words.clear();
+      int addWidth = w.px + pickSpaceWidth(style, w.bold(), w.italic()) +
+                     WORDWIDTH_BUFFER;  // IDK why 12 makes the text wrap work perfectly...
+
+      // If the word doesn't fit, start a new line. Only break at spaces, a format
+      // change inside a word doesn't split it
+      bool afterSpace = (i > 0) && (words[i - 1].start + words[i - 1].len < w.start);
+      if (afterSpace && lineWidth > 0 && (lineWidth + addWidth > textWidth)) {
+        lines.push_back({w.start, (uint16_t)i, 0});
         lineWidth = 0;
       }
 
-      currentLine.words.push_back(w);
+      lines.back().wordCount++;
       lineWidth += addWidth;
     }
-
-    if (!currentLine.words.empty()) {
-      currentLine.index = indexCounter++;
-      lines.push_back(currentLine);
-    }
   }
 
-  // Compile line objects back into text
-  void compileToText() {
-    String compiled = "";
-
-    for (auto &ln : lines) {
-      for (auto &w : ln.words) {
-        // Determine formatting markers
-        if (w.bold && w.italic)
-          compiled += "***";
-        else if (w.bold)
-          compiled += "**";
-        else if (w.italic)
-          compiled += "*";
-
-        compiled += w.text;
-
-        if (w.bold && w.italic)
-          compiled += "***";
-        else if (w.bold)
-          compiled += "**";
-        else if (w.italic)
-          compiled += "*";
-
-        compiled += " ";
+  // Display line that holds character pos
+  size_t lineOf(size_t pos) const {
+    size_t li = 0;
+    while (li + 1 < lines.size() && lines[li + 1].start <= pos) li++;
+    return li;
+  }
+
+  // Hash of display line li as displayLine() draws it, caret is its x or -1
+  uint32_t rowSignature(size_t li, int16_t caret) const {
+    uint32_t h = 2166136261u;
+    const bool lastLine = (li + 1 == lines.size());
+    h = hashBytes(h, &style, 1);
+    h = hashBytes(h, &caret, sizeof(caret));
+    h = hashBytes(h, &lastLine, 1);
+    if (li == 0 && style == 'L')
+      h = hashBytes(h, &orderedListNumber, sizeof(orderedListNumber));
+    if (li >= lines.size())
+      return h;
+
+    const LineSpan& ln = lines[li];
+    for (uint16_t k = 0; k < ln.wordCount; k++) {
+      const WordSpan& w = words[ln.firstWord + k];
+      h = hashBytes(h, &w.attr, 1);
+      for (uint16_t c = 0; c < w.len; c++) {
+        char ch = text.at(w.start + c);
+        h = hashBytes(h, &ch, 1);
       }
+      h = hashBytes(h, " ", 1);
     }
-
-    compiled.trim();
-    line = compiled;
+    return h;
   }
 
-  int displayLine(int startX, int startY) {
+  // Lay out this DocLine's visible lines into frame, returns the height used
+  int displayLine(TxtFrame& frame, int startX, int startY, ulong firstIndex) {
+    DisplayList& out = frame.list;
     ulong offsetLineScroll = 0;
     if (lineScroll <= SCROLL_LINE_OFFSET) {
       offsetLineScroll = 0;
@@ -334,7 +532,7 @@ struct DocLine {
     int cursorY = startY;
 
     // Entire block is offscreen, do not render.
-    if (!lines.empty() && lines.back().index < offsetLineScroll) {
+    if (!lines.empty() && firstIndex + lines.size() - 1 < offsetLineScroll) {
       return 0;
     }
 
@@ -342,12 +540,14 @@ struct DocLine {
 
     // Horizontal Rules just print a line
     if (style == 'H') {
-      display.drawFastHLine(0, cursorY + 3, display.width(), GxEPD_BLACK);
-      display.drawFastHLine(0, cursorY + 4, display.width(), GxEPD_BLACK);
+      out.drawFastHLine(0, cursorY + 3, display.width(), GxEPD_BLACK);
+      out.drawFastHLine(0, cursorY + 4, display.width(), GxEPD_BLACK);
+      frame.addRow(cursorY, 8, firstIndex, rowSignature(0, -1));
       return 8;
     }
     // Blank lines just take up space
     else if (style == 'B') {
+      frame.addRow(cursorY, 12, firstIndex, rowSignature(0, -1));
       return 12;
     }
 
@@ -366,22 +566,18 @@ struct DocLine {
     
     // ---------- Render Text ---------- //
 
-    for (auto& ln : lines) {
-      if (ln.index < offsetLineScroll)
+    for (size_t i = 0; i < lines.size(); i++) {
+      if (firstIndex + i < offsetLineScroll)
         continue;  // skip lines above scroll
+      const LineSpan& ln = lines[i];
 
       int cursorX = startX;
 
       // 1. Find max height for this line
       uint16_t max_hpx = 0;
-      for (auto& w : ln.words) {
-        const GFXfont* font = pickFont(style, w.bold, w.italic);
-        display.setFont(font);
-        int16_t x1, y1;
-        uint16_t wpx, hpx;
-        display.getTextBounds(w.text.c_str(), cursorX, cursorY, &x1, &y1, &wpx, &hpx);
-        if (hpx > max_hpx)
-          max_hpx = hpx;
+      for (uint16_t k = 0; k < ln.wordCount; k++) {
+        if (words[ln.firstWord + k].height > max_hpx)
+          max_hpx = words[ln.firstWord + k].height;
       }
 
       // Add space for headings
@@ -389,32 +585,34 @@ struct DocLine {
         max_hpx += 4;
 
       // 2. Draw all words at the same baseline
-      for (auto& w : ln.words) {
-        const GFXfont* font = pickFont(style, w.bold, w.italic);
-        display.setFont(font);
-
-        int16_t x1, y1;
-        uint16_t wpx, hpx;
-        display.getTextBounds(w.text.c_str(), cursorX, cursorY, &x1, &y1, &wpx, &hpx);
+      for (uint16_t k = 0; k < ln.wordCount; k++) {
+        const WordSpan& w = words[ln.firstWord + k];
+        out.setFont(pickMetrics(style, w.bold(), w.italic()).font());
 
         // Draw word at the baseline
-        display.setCursor(cursorX, cursorY + max_hpx);
-        display.print(w.text);
+        out.setCursor(cursorX, cursorY + max_hpx);
+        for (uint16_t c = 0; c < w.len; c++) out.write(text.at(w.start + c));
 
         // Advance cursor (word width + space)
-        int16_t sx1, sy1;
-        uint16_t sw, sh;
-        display.getTextBounds(SPACEWIDTH_SYMBOL, cursorX, cursorY, &sx1, &sy1, &sw, &sh);
-
-        cursorX += wpx + sw;
+        cursorX += w.px + pickSpaceWidth(style, w.bold(), w.italic());
       }
 
+      // Inline editing caret
+      bool caretHere = (currentEditMode == edit_inline && firstIndex + i == caretLine);
+      uint16_t caretHeight = max(max_hpx, (uint16_t)12);
+      if (caretHere)
+        out.fillRect(startX + caretX, cursorY, 2, caretHeight, GxEPD_BLACK);
+
       // Move down for next line
       uint8_t padding = 0;
       if (style == '1' || style == '2' || style == '3')
         padding = HEADING_LINE_PADDING;
       else
         padding = NORMAL_LINE_PADDING;
+      uint16_t rowHeight = max_hpx + padding;
+      if (caretHere)
+        rowHeight = max(rowHeight, caretHeight);
+      frame.addRow(cursorY, rowHeight, firstIndex + i, rowSignature(i, caretHere ? caretX : -1));
       cursorY += max_hpx + padding;
     }
 
@@ -422,47 +620,45 @@ struct DocLine {
 
     // Blockquotes get a vertical line on the left
     if (style == '>') {
-      display.drawFastVLine(SPECIAL_PADDING / 2, startY, (cursorY - startY), GxEPD_BLACK);
-      display.drawFastVLine((SPECIAL_PADDING / 2) + 1, startY, (cursorY - startY), GxEPD_BLACK);
+      out.drawFastVLine(SPECIAL_PADDING / 2, startY, (cursorY - startY), GxEPD_BLACK);
+      out.drawFastVLine((SPECIAL_PADDING / 2) + 1, startY, (cursorY - startY), GxEPD_BLACK);
     }
 
     // Code Blocks get a vertical line on each side
     else if (style == 'C') {
-      display.drawFastVLine(SPECIAL_PADDING / 4, startY, (cursorY - startY), GxEPD_BLACK);
-      display.drawFastVLine(display.width() - (SPECIAL_PADDING / 4), startY, (cursorY - startY),
+      out.drawFastVLine(SPECIAL_PADDING / 4, startY, (cursorY - startY), GxEPD_BLACK);
+      out.drawFastVLine(display.width() - (SPECIAL_PADDING / 4), startY, (cursorY - startY),
                             GxEPD_BLACK);
-      display.drawFastVLine((SPECIAL_PADDING / 4) + 1, startY, (cursorY - startY), GxEPD_BLACK);
-      display.drawFastVLine(display.width() - (SPECIAL_PADDING / 4) - 1, startY, (cursorY - startY),
+      out.drawFastVLine((SPECIAL_PADDING / 4) + 1, startY, (cursorY - startY), GxEPD_BLACK);
+      out.drawFastVLine(display.width() - (SPECIAL_PADDING / 4) - 1, startY, (cursorY - startY),
                             GxEPD_BLACK);
     }
 
     // Headings get a horizontal line below them
     else if ((style == '1' || style == '2' || style == '3')) {
-      display.drawFastHLine(0, cursorY - 2, display.width(), GxEPD_BLACK);
-      display.drawFastHLine(0, cursorY - 3, display.width(), GxEPD_BLACK);
+      out.drawFastHLine(0, cursorY - 2, display.width(), GxEPD_BLACK);
+      out.drawFastHLine(0, cursorY - 3, display.width(), GxEPD_BLACK);
     }
 
     // Unordered Lists get a '●'
     else if (style == '-') {
-      display.fillCircle(startX - 8, startY + 8, 3, GxEPD_BLACK);
+      out.fillCircle(startX - 8, startY + 8, 3, GxEPD_BLACK);
     }
     // Ordered Lists get their #
     else if (style == 'L') {
       String number = String(orderedListNumber) + ". ";
-      const GFXfont* font = pickFont('T', false, false);
-      display.setFont(font);
-      int16_t x1, y1;
-      uint16_t wpx, hpx;
-      display.getTextBounds(number.c_str(), 0, 0, &x1, &y1, &wpx, &hpx);
-
-      display.setCursor(startX - wpx - 5, startY + hpx);
-      display.print(number.c_str());
+      const FontMetrics& fm = pickMetrics('T', false, false);
+      out.setFont(fm.font());
+      TextBounds b = fm.bounds(number.c_str(), number.length());
+
+      out.setCursor(startX - b.w - 5, startY + b.h);
+      out.print(number.c_str());
     }
 
     return cursorY - startY;
   }
 
-  int displayLinePreview(int startX, int startY) {
+  int displayLinePreview(int startX, int startY, ulong firstIndex) {
     // 74px on OLED horizontally
     u8g2.setDrawColor(1);
 
@@ -471,7 +667,7 @@ struct DocLine {
     int cursorY = startY;
 
     // Entire block is offscreen, do not render.
-    if (!lines.empty() && lines.back().index < lineScroll) {
+    if (!lines.empty() && firstIndex + lines.size() - 1 < lineScroll) {
       return 0;
     }
 
@@ -491,9 +687,10 @@ struct DocLine {
     else if (style == 'C')
       startX += (specialPadding / 2);
 
-    for (auto& ln : lines) {
-      if (ln.index < lineScroll)
+    for (size_t i = 0; i < lines.size(); i++) {
+      if (firstIndex + i < lineScroll)
         continue;  // skip lines above scroll
+      const LineSpan& ln = lines[i];
 
       int cursorX = startX;
 
@@ -532,21 +729,11 @@ struct DocLine {
           break;
       }
 
-      // 2. Draw all words at the same baseline
-      for (auto& w : ln.words) {
-        const GFXfont* font = pickFont(style, w.bold, w.italic);
-        display.setFont(font);
-
-        int16_t x1, y1;
-        uint16_t wpx, hpx;
-        display.getTextBounds(w.text.c_str(), cursorX, cursorY, &x1, &y1, &wpx, &hpx);
-
+      // 2. Measure all words on this line
+      for (uint16_t k = 0; k < ln.wordCount; k++) {
         // Advance cursor (word width + space)
-        int16_t sx1, sy1;
-        uint16_t sw, sh;
-        display.getTextBounds(SPACEWIDTH_SYMBOL, cursorX, cursorY, &sx1, &sy1, &sw, &sh);
-
-        cursorX += wpx + sw;
+        const WordSpan& w = words[ln.firstWord + k];
+        cursorX += w.px + pickSpaceWidth(style, w.bold(), w.italic());
       }
       uint16_t boxWidth = map(cursorX, 0, display.width(), 0, 76);
 
@@ -584,45 +771,45 @@ struct DocLine {
 
     return cursorY - startY;
   }
-
- private:
-  // Helper: split a string segment into words and push them into words vector
-  void splitIntoWords(const String& segment, bool bold, bool italic) {
-    int start = 0;
-    while (start < segment.length()) {
-      int nextSpace = segment.indexOf(' ', start);
-      if (nextSpace == -1)
-        nextSpace = segment.length();
-      String word = segment.substring(start, nextSpace);
-      if (word.length() > 0) {
-        words.push_back({word, bold, italic});
-      }
-      start = nextSpace + 1;
-    }
-  }
 };
 
 ulong editingLine_index = 0;
+uint16_t cursorPos = 0;  // character offset in docLines[editingLine_index]
+uint8_t typingAttr = 0;  // bold/italic for typed characters
 std::vector<DocLine> docLines;
+LineIndex lineIndex;  // line count of each DocLine, gives global line indexes
+
+// Keep lineIndex in step after a DocLine gained or lost lines
+void updateLineCount(size_t docIndex) {
+  lineIndex.set(docIndex, docLines[docIndex].lines.size());
+}
 
 // ------------------ Rendering ------------------
 
 // Count number of display lines
 int getTotalDisplayLines() {
-  int total = 0;
-  for (const auto& doc : docLines) {
-    total += doc.lines.size();
-  }
-  return total;
+  return lineIndex.total();
+}
+
+// First DocLine that can be on screen when scrolled to line
+size_t firstVisibleDocLine(ulong line) {
+  if (docLines.empty())
+    return 0;
+  size_t first = lineIndex.blockAt(line);
+  return (first < docLines.size()) ? first : docLines.size() - 1;
 }
 
-// Display the entire document
-int displayDocument(int startX = 0, int startY = 0) {
+// Lay out the visible part of the document into frame
+int displayDocument(TxtFrame& frame, int startX = 0, int startY = 0) {
   int cursorY = startY;
 
-  for (auto& doc : docLines) {
+  ulong offsetLineScroll = 0;
+  if (lineScroll > SCROLL_LINE_OFFSET)
+    offsetLineScroll = lineScroll - SCROLL_LINE_OFFSET;
+
+  for (size_t i = firstVisibleDocLine(offsetLineScroll); i < docLines.size(); i++) {
     // Display this DocLine, offset by current cursorY
-    int heightUsed = doc.displayLine(startX, cursorY);
+    int heightUsed = docLines[i].displayLine(frame, startX, cursorY, lineIndex.firstLine(i));
 
     // If the line is off the bottom of the screen, stop drawing
     if (cursorY > display.height())
@@ -638,9 +825,9 @@ int displayDocument(int startX = 0, int startY = 0) {
 int displayDocumentPreview(int startX = 0, int startY = 0) {
   int cursorY = startY;
 
-  for (auto& doc : docLines) {
+  for (size_t i = firstVisibleDocLine(lineScroll); i < docLines.size(); i++) {
     // Display this DocLine, offset by current cursorY
-    int heightUsed = doc.displayLinePreview(startX, cursorY);
+    int heightUsed = docLines[i].displayLinePreview(startX, cursorY, lineIndex.firstLine(i));
 
     // If the line is off the bottom of the screen, stop drawing
     if (cursorY > u8g2.getDisplayHeight())
@@ -653,21 +840,15 @@ int displayDocumentPreview(int startX = 0, int startY = 0) {
   return cursorY - startY;
 }
 
-bool lineHasText(const LineObject& lineObj) {
-  // Check if line has any words
-  if (lineObj.words.empty())
-    return false;
+bool lineHasText(const LineSpan& line) {
+  return line.wordCount > 0;
+}
 
-  // Check if any word has non-empty text
-  for (const auto& w : lineObj.words) {
-    if (w.text.length() > 0)
-      return true;
-  }
+void toolBar(uint8_t attr) {
+  bool bold = attr & ATTR_BOLD;
+  bool italic = attr & ATTR_ITALIC;
 
-  return false;
-}
 
-void toolBar(wordObject& wordObj) {
   // FN/SHIFT indicator centered
   u8g2.setFont(u8g2_font_5x7_tf);
 
@@ -738,13 +919,13 @@ void toolBar(wordObject& wordObj) {
   }
 
   // Bold and italic indicator
-  if (wordObj.bold == true && wordObj.italic == true) {
+  if (bold == true && italic == true) {
     u8g2.drawStr(u8g2.getDisplayWidth() - u8g2.getStrWidth("BOLD+ITALIC"), u8g2.getDisplayHeight(),
                  "BOLD+ITALIC");
-  } else if (wordObj.bold == true && wordObj.italic == false) {
+  } else if (bold == true && italic == false) {
     u8g2.drawStr(u8g2.getDisplayWidth() - u8g2.getStrWidth("BOLD"), u8g2.getDisplayHeight(),
                  "BOLD");
-  } else if (wordObj.bold == false && wordObj.italic == true) {
+  } else if (bold == false && italic == true) {
     u8g2.drawStr(u8g2.getDisplayWidth() - u8g2.getStrWidth("ITALIC"), u8g2.getDisplayHeight(),
                  "ITALIC");
   } else {
@@ -765,199 +946,153 @@ void setFontOLED(bool bold, bool italic) {
   return;
 }
 
-LineObject* getLineObjectByIndex(ulong targetIndex) {
-  for (auto& doc : docLines) {
-    for (auto& line : doc.lines) {
-      if (line.index == targetIndex) {
-        return &line;
-      }
-    }
-  }
-  return nullptr;  // not found
-}
+// Find the DocLine and the line inside it for a global line index
+bool locateLine(ulong targetIndex, size_t& docIndex, size_t& lineInDoc) {
+  if (targetIndex >= lineIndex.total())
+    return false;  // not found
 
-char getStyleFromScrollLine(ulong scrollLineIndex) {
-  for (auto& doc : docLines) {
-    for (auto& line : doc.lines) {
-      if (line.index == scrollLineIndex) {
-        return doc.style;  // <-- Return the DocLine style
-      }
-    }
-  }
-  return 'T';  // fallback if not found
+  docIndex = lineIndex.blockAt(targetIndex);
+  lineInDoc = targetIndex - lineIndex.firstLine(docIndex);
+  return docIndex < docLines.size() && lineInDoc < docLines[docIndex].lines.size();
 }
 
-// Returns the pixel width of a LineObject on the OLED (vector of wordObjects)
-int getLineWidthOLED(const LineObject& lineObj) {
-  int lineWidth = 0;
-  for (const auto& w : lineObj.words) {
-    setFontOLED(w.bold, w.italic);
-
-    uint16_t wpx = u8g2.getStrWidth(w.text.c_str());
+char getStyleFromScrollLine(ulong scrollLineIndex) {
+  if (scrollLineIndex >= lineIndex.total())
+    return 'T';  // fallback if not found
 
-    int spaceWidth = u8g2.getStrWidth(" " /*SPACEWIDTH_SYMBOL*/);
+  size_t docIndex = lineIndex.blockAt(scrollLineIndex);
+  return (docIndex < docLines.size()) ? docLines[docIndex].style : 'T';
+}
 
-    // Add word width + space width (except after last word)
-    lineWidth += wpx;
-    if (&w != &lineObj.words.back()) {
-      lineWidth += spaceWidth;
+// Draw line li of doc on the OLED starting at x (or only measure it).
+// Returns the x position of character pos, pos past the line gives its end
+int drawLineOLED(const DocLine& doc, size_t li, int x, size_t pos, bool draw) {
+  const LineSpan& ln = doc.lines[li];
+  char word[64];
+  int caret = -1;
+  size_t lineEnd = ln.start;
+
+  for (uint16_t k = 0; k < ln.wordCount; k++) {
+    const WordSpan& w = doc.words[ln.firstWord + k];
+    setFontOLED(w.bold(), w.italic());
+
+    // Space between words (none where only the format changes)
+    if (k > 0 && w.start > lineEnd)
+      x += u8g2.getStrWidth(" ");
+    if (caret < 0 && pos <= w.start)
+      caret = x;
+
+    size_t n = doc.text.copy(word, w.start, min((size_t)w.len, sizeof(word) - 1));
+    word[n] = '\0';
+
+    // Caret inside this word
+    if (caret < 0 && pos <= w.start + n) {
+      char hidden = word[pos - w.start];
+      word[pos - w.start] = '\0';
+      caret = x + u8g2.getStrWidth(word);
+      word[pos - w.start] = hidden;
     }
+
+    uint16_t wpx = u8g2.getStrWidth(word);
+    if (draw && x >= 0)
+      u8g2.drawStr(x, 20, word);
+    x += wpx;
+    lineEnd = w.start + w.len;
   }
-  return lineWidth;
+
+  // Caret after trailing spaces
+  if (caret < 0)
+    caret = (pos > lineEnd && ln.wordCount > 0) ? x + u8g2.getStrWidth(" ") : x;
+  return caret;
 }
 
 void scrollPreview() {
-  u8g2.clearBuffer();
-
   uint16_t xInit = u8g2.getDisplayWidth() / 3;
 
-  LineObject* scrollLinePtr = getLineObjectByIndex(lineScroll);
-  if (!scrollLinePtr) {
-    // Pointer invalid, nothing to display
+  size_t docIndex = 0, lineInDoc = 0;
+  if (!locateLine(lineScroll, docIndex, lineInDoc)) {
+    // Line invalid, nothing to display
     return;
   }
+  OLED().beginFrame();
 
-  LineObject scrollLine = *getLineObjectByIndex(lineScroll);
-
-  if (&scrollLine) {
-    // Display Line
-
-    uint16_t xpos = xInit;
-
-    // Iterate through line and display from left to right
-    for (size_t i = 0; i < scrollLine.words.size(); ++i) {
-      const auto& w = scrollLine.words[i];
-      setFontOLED(w.bold, w.italic);
-      u8g2.drawStr(xpos, 20, w.text.c_str());
-
-      uint16_t wpx = u8g2.getStrWidth(w.text.c_str());
+  // Display Line
+  const DocLine& scrollDoc = docLines[docIndex];
+  drawLineOLED(scrollDoc, lineInDoc, xInit, scrollDoc.text.size(), true);
 
-      // Only add space if not the last word
-      if (i < scrollLine.words.size() - 1) {
-        uint8_t spaceWidth = u8g2.getStrWidth(" ");
-        xpos += wpx + spaceWidth;
-      } else {
-        xpos += wpx;  // just the word width
-      }
-    }
-
-    // Draw line number and type
-    char style = getStyleFromScrollLine(lineScroll);
-    String lineTypeLabel = "";
-
-    switch (style) {
-      case 'T':
-        lineTypeLabel = "BODY";
-        break;
-      case '1':
-        lineTypeLabel = "HEAD 1";
-        break;
-      case '2':
-        lineTypeLabel = "HEAD 2";
-        break;
-      case '3':
-        lineTypeLabel = "HEAD 3";
-        break;
-      case 'C':
-        lineTypeLabel = "CODE BLK";
-        break;
-      case '>':
-        lineTypeLabel = "QUOTE BLK";
-        break;
-      case '-':
-        lineTypeLabel = "UNORD LIST";
-        break;
-      case 'L':
-        lineTypeLabel = "ORDER LIST";
-        break;
-      case 'H':
-        lineTypeLabel = "HORIZ RULE";
-        break;
-      case 'B':
-        lineTypeLabel = "BLANK LINE";
-        break;
-      default:
-        lineTypeLabel = "?";
-        break;
-    }
+  // Draw line number and type
+  char style = getStyleFromScrollLine(lineScroll);
+  String lineTypeLabel = "";
 
-    String lineInfoStr = "L:" + String(lineScroll) + "-" + lineTypeLabel;
+  switch (style) {
+    case 'T':
+      lineTypeLabel = "BODY";
+      break;
+    case '1':
+      lineTypeLabel = "HEAD 1";
+      break;
+    case '2':
+      lineTypeLabel = "HEAD 2";
+      break;
+    case '3':
+      lineTypeLabel = "HEAD 3";
+      break;
+    case 'C':
+      lineTypeLabel = "CODE BLK";
+      break;
+    case '>':
+      lineTypeLabel = "QUOTE BLK";
+      break;
+    case '-':
+      lineTypeLabel = "UNORD LIST";
+      break;
+    case 'L':
+      lineTypeLabel = "ORDER LIST";
+      break;
+    case 'H':
+      lineTypeLabel = "HORIZ RULE";
+      break;
+    case 'B':
+      lineTypeLabel = "BLANK LINE";
+      break;
+    default:
+      lineTypeLabel = "?";
+      break;
+  }
 
-    u8g2.setFont(u8g2_font_5x7_tf);
-    u8g2.drawStr(xInit, u8g2.getDisplayHeight(), lineInfoStr.c_str());
+  String lineInfoStr = "L:" + String(lineScroll) + "-" + lineTypeLabel;
 
-    // Draw tooltip
-    u8g2.drawStr(u8g2.getDisplayWidth() - u8g2.getStrWidth("Tab:Edit Inline"),
-                 u8g2.getDisplayHeight(), "Tab:Edit Inline");
+  u8g2.setFont(u8g2_font_5x7_tf);
+  u8g2.drawStr(xInit, u8g2.getDisplayHeight(), lineInfoStr.c_str());
 
-    // Draw Seperator
-    u8g2.drawVLine(80, 0, u8g2.getDisplayHeight());
+  // Draw tooltip
+  u8g2.drawStr(u8g2.getDisplayWidth() - u8g2.getStrWidth("Tab:Edit Inline"),
+               u8g2.getDisplayHeight(), "Tab:Edit Inline");
 
-    // Draw Preview
-    int totalUsed = displayDocumentPreview(0, 0);
+  // Draw Seperator
+  u8g2.drawVLine(80, 0, u8g2.getDisplayHeight());
 
-  } else {
-    return;
-  }
-  u8g2.sendBuffer();
+  // Draw Preview
+  int totalUsed = displayDocumentPreview(0, 0);
+  OLED().commit();
 }
 
-void oledEditorDisplay(LineObject& lineObj, wordObject& currentWord, int pixelsUsed,
+void oledEditorDisplay(const DocLine& doc, size_t li, size_t pos, uint8_t attr, int pixelsUsed,
                        bool currentlyTyping) {
-  u8g2.clearBuffer();
-
-  // Draw line text
-  if (getLineWidthOLED(lineObj) < (u8g2.getDisplayWidth() - 5)) {
-    uint16_t xpos = 0;
-
-    // Iterate through line and display from left to right
-    for (size_t i = 0; i < lineObj.words.size(); ++i) {
-      const auto& w = lineObj.words[i];
-      setFontOLED(w.bold, w.italic);
-      u8g2.drawStr(xpos, 20, w.text.c_str());
-
-      uint16_t wpx = u8g2.getStrWidth(w.text.c_str());
-
-      // Only add space if not the last word
-      if (i < lineObj.words.size() - 1) {
-        uint8_t spaceWidth = u8g2.getStrWidth(" ");
-        xpos += wpx + spaceWidth;
-      } else {
-        xpos += wpx;  // just the word width
-      }
-    }
+  OLED().beginFrame();
 
-    if (lineHasText(lineObj))
-      u8g2.drawVLine(xpos + 2, 1, 22);
-  } else {
-    // Line is too long to fit, display from right to left
-    uint16_t xpos = u8g2.getDisplayWidth() - 8;
-
-    for (size_t i = 0; i < lineObj.words.size(); ++i) {
-      const auto& w = lineObj.words[lineObj.words.size() - 1 - i];
-      setFontOLED(w.bold, w.italic);
-
-      uint16_t wpx = u8g2.getStrWidth(w.text.c_str());
-
-      // Subtract spacing *only if not the rightmost word*
-      if (i == 0) {
-        xpos -= wpx;  // rightmost word
-      } else {
-        uint8_t spaceWidth = u8g2.getStrWidth(" ");
-        xpos -= (wpx + spaceWidth);
-      }
-
-      // Draw word if it's on the screen
-      if ((xpos + wpx) > 0) {
-        u8g2.drawStr(xpos, 20, w.text.c_str());
-      }
-    }
+  // Draw line text, shifted left when the caret would run off the right edge
+  int caretX = drawLineOLED(doc, li, 0, pos, false);
+  int shift = 0;
+  if (caretX > u8g2.getDisplayWidth() - 8)
+    shift = caretX - (u8g2.getDisplayWidth() - 8);
+  caretX = drawLineOLED(doc, li, -shift, pos, true);
 
-    u8g2.drawVLine(u8g2.getDisplayWidth() - 6, 1, 22);
-  }
+  if (lineHasText(doc.lines[li]) || currentEditMode == edit_inline)
+    u8g2.drawVLine(caretX + 2, 1, 22);
 
   // PROGRESS BAR
-  if (lineHasText(lineObj) == true && pixelsUsed > 0) {
+  if (lineHasText(doc.lines[li]) == true && pixelsUsed > 0) {
     if (pixelsUsed > display.width() - DISPLAY_WIDTH_BUFFER)
       pixelsUsed = display.width() - DISPLAY_WIDTH_BUFFER;
     // uint8_t progress = map(pixelsUsed, 0, display.width() - DISPLAY_WIDTH_BUFFER, 0,
@@ -974,6 +1109,7 @@ void oledEditorDisplay(LineObject& lineObj, wordObject& currentWord, int pixelsU
 
     // LINE END WARNING INDICATOR
     if (progress > (u8g2.getDisplayWidth() * 0.8)) {
+      KB().wakeAt((millis() / 400 + 1) * 400);  // redraw at the next blink
       if ((millis() / 400) % 2 == 0) {  // ON for 200ms, OFF for 200ms
         u8g2.drawVLine(u8g2.getDisplayWidth() - 1, 8, 32 - 16);
         u8g2.drawLine(u8g2.getDisplayWidth() - 1, 15, u8g2.getDisplayWidth() - 4, 12);
@@ -983,6 +1119,7 @@ void oledEditorDisplay(LineObject& lineObj, wordObject& currentWord, int pixelsU
     // New line on space animation
     if (pixelsUsed >= display.width() - DISPLAY_WIDTH_BUFFER) {
       // Sawtooth animation
+      KB().wakeIn(INPUT_POLL_MS);
       uint period = 8000;
       uint x1 = map(millis() % period, 0, period, 0, u8g2.getDisplayWidth());
       uint x2 = map((millis() + period / 4) % period, 0, period, 0, u8g2.getDisplayWidth());
@@ -1001,21 +1138,19 @@ void oledEditorDisplay(LineObject& lineObj, wordObject& currentWord, int pixelsU
 
   if (currentlyTyping) {
     // Show toolbar
-    toolBar(currentWord);
+    toolBar(attr);
   } else {
     // Show infobar
     OLED().infoBar();
   }
 
-  u8g2.sendBuffer();
+  OLED().commit();
 }
 
 // ------------------ Document ------------------
 
 // Parse and split all DocLines into rendered lines
 void populateLines(std::vector<DocLine>& docLines) {
-  indexCounter = 0;
-
   for (auto& doc : docLines) {
     doc.parseWords();
     doc.splitToLines();
@@ -1038,208 +1173,1416 @@ void refreshOrderedListIndexes() {
   }
 }
 
-void refreshAllLineIndexes() {
-  // Refresh line indexes
-  indexCounter = 0;                     // reset counter if you want indexes to start from 0
-  for (auto& docLine : docLines) {      // iterate through all DocLines
-    for (auto& line : docLine.lines) {  // iterate through each LineObject
-      line.index = indexCounter++;
+// Renumber only the ordered list runs touched by DocLines [first, last]
+void refreshOrderedListIndexes(size_t first, size_t last) {
+  if (docLines.empty())
+    return;
+  if (last >= docLines.size())
+    last = docLines.size() - 1;
+
+  // Back up to the start of the run first belongs to
+  size_t start = first;
+  while (start > 0 && docLines[start - 1].style == 'L')
+    start--;
+
+  ulong currentNumber = 0;
+  for (size_t i = start; i < docLines.size(); i++) {
+    DocLine& dl = docLines[i];
+    if (dl.style == 'L') {
+      dl.orderedListNumber = ++currentNumber;
+    } else {
+      dl.orderedListNumber = -1;
+      currentNumber = 0;
+      // Past the edit, later runs keep their numbers
+      if (i > last)
+        break;
     }
   }
+}
+
+// Rebuild line indexes and list numbers for the whole document (after loading)
+void refreshAllLineIndexes() {
+  lineIndex.rebuild(docLines.size(), [](size_t i) { return (uint16_t)docLines[i].lines.size(); });
 
   // Update list indexes
   refreshOrderedListIndexes();
 }
 
-// Load File
-void loadMarkdownFile(const String& path) {
-  // Invalid file
-  if (path == "" || path == " " || path == "-") {
-    OLED().oledWord("No file saved! Creating blank file.");
-    delay(2000);
-
-    // Create an empty new docLines object
-    docLines.push_back({'T', "", {}});
-    editingLine_index = 0;
+// Re-split every DocLine, e.g. after the font family changed
+void reflowDocument() {
+  fullRefreshRequests++;
+  for (auto& doc : docLines) doc.splitToLines();
+  refreshAllLineIndexes();
 
-    // Populate and update as usual so UI doesn’t crash
-    populateLines(docLines);
-    refreshAllLineIndexes();
+  int total = getTotalDisplayLines();
+  if (total == 0)
+    lineScroll = 0;
+  else if (lineScroll >= (ulong)total)
+    lineScroll = total - 1;
+}
 
-    if (SAVE_POWER)
-      pocketmage::setCpuSpeed(80);
-    SDActive = false;
-    return;
-  }
+void resetCursor();
 
-  if (SD().getNoSD()) {
-    OLED().oledWord("LOAD FAILED - No SD!");
-    delay(5000);
-    return;
-  }
+// Parse one markdown line onto the end of out
+void parseMarkdownLine(const char* line, size_t len, std::vector<DocLine>& out) {
+  MdBlock block = classifyMarkdownLine(line, len);
+  out.emplace_back(block.style);
+  out.back().setMarkdown(line + block.start, block.len);
+}
 
-  SDActive = true;
-  pocketmage::setCpuSpeed(240);
-  delay(50);
+typedef BufferedWriter<File> SaveWriter;
 
-  docLines.clear();
-  File file = SD_MMC.open(path.c_str(), FILE_READ);
-  if (!file) {
-    ESP_LOGE("SD", "File does not exist: %s", path.c_str());  // FIXME: - Come up with better error handling
-                                                              //        - Should this be Error or Warning?
-    OLED().oledWord("LOAD FAILED - FILE MISSING");
-    delay(2000);
+// Append one DocLine as a markdown line, without the line ending
+void appendMarkdownLine(String& out, const DocLine& dl) {
+  switch (dl.style) {
+    case '1': out += "# "; break;
+    case '2': out += "## "; break;
+    case '3': out += "### "; break;
+    case '>': out += "> "; break;
+    case '-': out += "- "; break;
+    case 'L': out += "1. "; break; //String(dl.orderedListNumber) + ". "; break;
+    case 'C': out += "```"; break;
+    default:  break;
+  }
 
-    // Create an empty new docLines object
-    docLines.push_back({'T', "", {}});
-    editingLine_index = 0;
+  if (dl.style == 'H')
+    out += "---";
+  else if (dl.style != 'B')
+    dl.appendMarkdown(out);
 
-    // Populate and update as usual so UI doesn’t crash
-    populateLines(docLines);
-    refreshAllLineIndexes();
+  if (dl.style == 'C')
+    out += "```";
+}
 
-    if (SAVE_POWER)
-      pocketmage::setCpuSpeed(80);
-    SDActive = false;
-    return;
-  }
+// Write one DocLine as a markdown line, returns the bytes written
+size_t writeMarkdownLine(SaveWriter& file, DocLine& dl) {
+  String out;
+  appendMarkdownLine(out, dl);
+  out += "\r\n";
 
-  while (file.available()) {
-    String line = file.readStringUntil('\n');
-    line.trim();
-    char style = 'T';
-    String content = line;  // default is full line
-
-    if (line.length() == 0) {
-      style = 'B'; // Blank line
-      content = "";
-    } else if (line.startsWith("### ")) {
-      style = '3'; // Heading 3
-      content = line.substring(4);  // remove "### "
-    } else if (line.startsWith("## ")) {
-      style = '2'; // Heading 2
-      content = line.substring(3);  // remove "## "
-    } else if (line.startsWith("# ")) {
-      style = '1'; // Heading 1
-      content = line.substring(2);  // remove "# "
-    } else if (line.startsWith("> ")) {
-      style = '>'; // Quote Block
-      content = line.substring(2);  // remove "> "
-    } else if (line.startsWith("- ")) {
-      style = '-'; // Unordered List
-      content = line.substring(2); // remove "- "
-    } else if (line == "---") {
-      style = 'H'; // Horizontal Rule
-      content = "---";  // horizontal line has no content
-    } else if ((line.startsWith("```")) || (line.startsWith("`") && line.endsWith("`")) || (line.startsWith("```") && line.endsWith("```"))) {
-      if (line.startsWith("```"))
-        content = line.substring(3);
-      else if (line.startsWith("```") && line.endsWith("```"))
-        content = line.substring(3, line.length() - 3);
-      else if (line.startsWith("`") && line.endsWith("`"))
-        content = line.substring(1, line.length() - 1);
-
-      style = 'C'; // Code Block
-    } else if (line.length() > 2 && isDigit(line.charAt(0)) && line.charAt(1) == '.' &&
-               line.charAt(2) == ' ') {
-      style = 'L'; // Ordered List
-      content = line.substring(3); // remove "1. ", "2. ", etc.
-    }
+  return file.write(out.c_str(), out.length());
+}
 
-    docLines.push_back({style, content, {}});
-  }
+// ------------------ Paging ------------------
+// Long files are never parsed in one go. Loading makes one pass that records where each
+// markdown line starts (kept in /sys and reused while the file is unchanged), then only a
+// window of DocLines is parsed. Scrolling near either end of the window pages more in
+// from the file and drops DocLines at the far end, so RAM use doesn't grow with the file.
+// Edited DocLines that are dropped are appended to an overlay file, the rest of the
+// document stays where it is until it's saved (docSpans).
+#define TXT_INDEX_FILE "/sys/TXT_INDEX.bin"
+#define TXT_INDEX_TEMP "/sys/TXT_INDEX.tmp"
+#define TXT_OVERLAY_FILE "/sys/TXT_OVERLAY.txt"  // edited lines paged out before they were saved
+#define TXT_TEMP_SUFFIX ".tmp"           // new file while it's written, then renamed over the old
+#define TXT_SUMS_FILE "/sys/TXT_SUMS.txt"  // size, time and CRC of each saved note
+#define TXT_SUMS_TEMP "/sys/TXT_SUMS.tmp"
+#define TXT_SUMS_END "end"                 // last line of a complete sums file
+#define TXT_INDEX_MAGIC 0x49544D50         // "PMTI"
+#define TXT_WINDOW_DOCLINES 192            // most DocLines kept parsed
+#define TXT_PAGE_DOCLINES 64               // DocLines parsed per page
+#define TXT_PAGE_MARGIN 24                 // lines left past the view before paging
+#define TXT_COPY_CHUNK 512                 // bytes
+#define TXT_SAVE_BUFFER 16384              // bytes, saves write whole SD sectors in blocks this big
+
+// Index file layout: header, then count + 1 byte offsets (the last one is the file size)
+struct DocIndexHeader {
+  uint32_t magic;
+  uint32_t fileSize;
+  uint32_t lastWrite;
+  uint32_t count;  // markdown lines
+  char path[96];
+};
 
-  file.close();
+String docPath = "";           // file the index points into
+size_t docCount = 0;           // markdown lines in docPath
+DocSpans docSpans;             // where the document lines outside the window are
+size_t windowStart = 0;        // document line parsed into docLines[0]
+bool editingPagedOut = false;  // editing DocLine was dropped, page it back in on the next key
+size_t editingDocPathLine = 0; // its document line
+
+// Held while docPath, the index or the overlay is written, the log task reads them to
+// write a checkpoint (created with the task, nothing to guard before)
+SemaphoreHandle_t docFilesMutex = NULL;
+uint32_t docFilesVersion = 0;  // changes when they're replaced, under docFilesMutex
+
+void lockDocFiles() {
+  if (docFilesMutex)
+    xSemaphoreTake(docFilesMutex, portMAX_DELAY);
+}
+void unlockDocFiles() {
+  if (docFilesMutex)
+    xSemaphoreGive(docFilesMutex);
+}
 
-  if (docLines.empty()) {
-    docLines.push_back({'T', "", {}});
-    editingLine_index = 0;
-  } else {
-    editingLine_index = docLines.size() - 1;
-  }
+bool windowCoversDocument() {
+  return docSpans.empty();
+}
 
-  // Populate all the lines
-  populateLines(docLines);
+// Markdown lines in the document, loaded or not
+size_t documentLines() {
+  return windowStart + docLines.size() + docSpans.after();
+}
 
-  // Update indexes
-  refreshAllLineIndexes();
+// Forget the index, docLines become the whole document
+void resetWindow(const String& path) {
+  docPath = path;
+  docCount = 0;
+  docSpans.reset(0);
+  windowStart = 0;
+  editingPagedOut = false;
+}
 
-  if (SAVE_POWER)
-    pocketmage::setCpuSpeed(80);
-  SDActive = false;
+bool readIndexHeader(File& idx, DocIndexHeader& h) {
+  idx.seek(0);
+  return idx.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == TXT_INDEX_MAGIC;
+}
 
-  OLED().oledWord("FILE LOADED");
-  delay(500);
-  fileLoaded = true;
+// Byte offset of markdown line n of docPath (the file size for n == docCount)
+uint32_t indexOffset(File& idx, size_t n) {
+  uint32_t offset = 0;
+  idx.seek(sizeof(DocIndexHeader) + n * sizeof(uint32_t));
+  idx.read((uint8_t*)&offset, sizeof(offset));
+  return offset;
 }
 
-void saveMarkdownFile(const String& path) {
-  if (SD().getNoSD()) {
-    OLED().oledWord("SAVE FAILED - No SD!");
-    delay(3000);
-    return;
-  }
-  ESP_LOGE(TAG, "In save markdown file, setting cpu speed");
-  SDActive = true;
-  pocketmage::setCpuSpeed(240);
-  delay(50);
+void fillIndexHeader(DocIndexHeader& h, const String& path, File& file, size_t count) {
+  memset(&h, 0, sizeof(h));
+  h.magic = TXT_INDEX_MAGIC;
+  h.fileSize = file.size();
+  h.lastWrite = (uint32_t)file.getLastWrite();
+  h.count = count;
+  strncpy(h.path, path.c_str(), sizeof(h.path) - 1);
+}
 
-  // Determine save path
-  String savePath = path;
-  if (savePath == "" || savePath == "-")
-    savePath = "/temp.txt";
-  if (!savePath.startsWith("/"))
-    savePath = "/" + savePath;
+// What a save wrote, kept in TXT_SUMS_FILE so a damaged or half written file shows up
+struct SaveSum {
+  uint32_t size = 0;
+  uint32_t lastWrite = 0;
+  uint32_t crc = 0;
+};
 
-  File file = SD_MMC.open(savePath.c_str(), FILE_WRITE);
-  if (!file) {
-    OLED().oledWord("SAVE FAILED - OPEN ERR");
-    delay(2000);
-    ESP_LOGE("SD", "Failed to open file for writing: %s", savePath.c_str());
-    SDActive = false;
+// An update of TXT_SUMS_FILE cut short by power loss. The temp file replaces it once
+// it's complete (it ends in TXT_SUMS_END), a partial one is dropped and the old one kept
+void recoverSaveSums() {
+  if (!SD_MMC.exists(TXT_SUMS_TEMP))
     return;
+
+  const size_t endLen = strlen(TXT_SUMS_END) + 1;
+  char tail[8] = {};
+  File t = SD_MMC.open(TXT_SUMS_TEMP, FILE_READ);
+  if (t && t.size() >= endLen) {
+    t.seek(t.size() - endLen);
+    t.read((uint8_t*)tail, endLen);
   }
+  if (t)
+    t.close();
 
-  // Write each DocLine as Markdown
-  for (auto &dl : docLines) {
-    dl.compileToText();
+  if (strncmp(tail, TXT_SUMS_END "\n", endLen) == 0) {
+    SD_MMC.remove(TXT_SUMS_FILE);
+    SD_MMC.rename(TXT_SUMS_TEMP, TXT_SUMS_FILE);
+  } else {
+    SD_MMC.remove(TXT_SUMS_TEMP);
+  }
+}
 
-    String out;
+// Checksum recorded by the last save of path
+bool readSaveSum(const String& path, SaveSum& sum) {
+  recoverSaveSums();
+  File f = SD_MMC.open(TXT_SUMS_FILE, FILE_READ);
+  if (!f)
+    return false;
 
-    switch (dl.style) {
-      case '1': out = "# " + dl.line; break;
-      case '2': out = "## " + dl.line; break;
-      case '3': out = "### " + dl.line; break;
-      case '>': out = "> " + dl.line; break;
-      case '-': out = "- " + dl.line; break;
-      case 'L': out = "1. " + dl.line; break; //String(dl.orderedListNumber) + ". " + dl.line; break;
-      case 'H': out = "---"; break;
-      case 'C': out = "```" + dl.line + "```"; break;
-      case 'B': out = ""; break;
-      default:  out = dl.line; break;
+  bool found = false;
+  while (f.available() && !found) {
+    String line = f.readStringUntil('\n');
+    unsigned long size, lastWrite, crc;
+    int n = 0;
+    if (sscanf(line.c_str(), "%lu|%lu|%lx|%n", &size, &lastWrite, &crc, &n) == 3 &&
+        path == line.c_str() + n) {
+      sum.size = size;
+      sum.lastWrite = lastWrite;
+      sum.crc = crc;
+      found = true;
     }
-
-    file.println(out);
   }
+  f.close();
+  return found;
+}
 
-  file.close();
+// Replace the checksum of path, other entries are copied over as they are. The new
+// file is only complete with its end line, recoverSaveSums() finishes a cut short swap
+bool writeSaveSum(const String& path, const SaveSum& sum) {
+  recoverSaveSums();
+  File out = SD_MMC.open(TXT_SUMS_TEMP, FILE_WRITE);
+  if (!out)
+    return false;
+
+  File in = SD_MMC.open(TXT_SUMS_FILE, FILE_READ);
+  if (in) {
+    while (in.available()) {
+      String line = in.readStringUntil('\n');
+      const char* bar = strrchr(line.c_str(), '|');
+      if (line.length() > 0 && line != TXT_SUMS_END && !(bar && path == bar + 1))
+        out.print(line + "\n");
+    }
+    in.close();
+  }
+
+  char entry[32];
+  snprintf(entry, sizeof(entry), "%lu|%lu|%08lx|", (unsigned long)sum.size,
+           (unsigned long)sum.lastWrite, (unsigned long)sum.crc);
+  out.print(String(entry) + path + "\n");
+  out.print(TXT_SUMS_END "\n");
+  out.flush();
+  out.close();
+
+  SD_MMC.remove(TXT_SUMS_FILE);
+  return SD_MMC.rename(TXT_SUMS_TEMP, TXT_SUMS_FILE);
+}
+
+uint32_t fileCrc(File& file) {
+  uint8_t buf[TXT_COPY_CHUNK];
+  uint32_t crc = 0;
+  file.seek(0);
+  while (true) {
+    int n = file.read(buf, sizeof(buf));
+    if (n <= 0)
+      break;
+    crc = crc32Update(crc, buf, n);
+  }
+  return crc;
+}
+
+// A save that lost power before its temp file replaced path. Finish it when the temp
+// file is complete, otherwise drop it (path is still the previous save then).
+void recoverInterruptedSave(const String& path) {
+  String temp = path + TXT_TEMP_SUFFIX;
+  if (!SD_MMC.exists(temp.c_str()))
+    return;
+
+  SaveSum sum;
+  File t = SD_MMC.open(temp.c_str(), FILE_READ);
+  bool complete = t && readSaveSum(path, sum) && sum.size == t.size() && sum.crc == fileCrc(t);
+  if (t)
+    t.close();
+
+  if (complete || !SD_MMC.exists(path.c_str())) {
+    ESP_LOGW(TAG, "Finishing interrupted save of %s (%s)", path.c_str(),
+             complete ? "complete" : "partial");
+    SD_MMC.remove(path.c_str());
+    SD_MMC.rename(temp.c_str(), path.c_str());
+  } else {
+    ESP_LOGW(TAG, "Dropping partial save of %s", path.c_str());
+    SD_MMC.remove(temp.c_str());
+  }
+}
+
+// Record where each markdown line of src starts. Reuses the index when it already
+// describes this file, returns false if it can't be written (SD full). intact is
+// cleared when the scan finds a file we saved that no longer matches its checksum.
+bool indexMarkdownFile(File& src, const String& path, bool& intact) {
+  DocIndexHeader h;
+  File idx = SD_MMC.open(TXT_INDEX_FILE, FILE_READ);
+  if (idx) {
+    bool valid = readIndexHeader(idx, h) && h.fileSize == src.size() &&
+                 h.lastWrite == (uint32_t)src.getLastWrite() && path == h.path;
+    idx.close();
+    if (valid) {
+      docCount = h.count;
+      return true;
+    }
+  }
+
+  idx = SD_MMC.open(TXT_INDEX_FILE, FILE_WRITE);
+  if (!idx)
+    return false;
+  memset(&h, 0, sizeof(h));
+  idx.write((uint8_t*)&h, sizeof(h));  // written for real once the count is known
+
+  // A line starts at 0 and after every '\n' that isn't the last byte (same as readStringUntil)
+  uint8_t buf[TXT_COPY_CHUNK];
+  uint32_t offsets[TXT_COPY_CHUNK / sizeof(uint32_t)];
+  size_t pending = 0, count = 0;
+  uint32_t pos = 0;
+  bool lineStart = true;
+  uint32_t crc = 0;
+  src.seek(0);
+  while (true) {
+    int n = src.read(buf, sizeof(buf));
+    if (n <= 0)
+      break;
+    crc = crc32Update(crc, buf, n);
+    for (int i = 0; i < n; i++, pos++) {
+      if (lineStart) {
+        if (pending == sizeof(offsets) / sizeof(offsets[0])) {
+          idx.write((uint8_t*)offsets, sizeof(offsets));
+          pending = 0;
+        }
+        offsets[pending++] = pos;
+        count++;
+      }
+      lineStart = (buf[i] == '\n');
+    }
+  }
+  if (pending == sizeof(offsets) / sizeof(offsets[0])) {
+    idx.write((uint8_t*)offsets, sizeof(offsets));
+    pending = 0;
+  }
+  offsets[pending++] = pos;
+  idx.write((uint8_t*)offsets, pending * sizeof(uint32_t));
+
+  fillIndexHeader(h, path, src, count);
+  idx.seek(0);
+  idx.write((uint8_t*)&h, sizeof(h));
+  idx.close();
+
+  // Only files nothing else wrote since our save are checked, edits on a PC are fine
+  SaveSum sum;
+  if (readSaveSum(path, sum) && sum.lastWrite == h.lastWrite)
+    intact = (sum.size == pos && sum.crc == crc);
+
+  docCount = count;
+  return true;
+}
+
+// Parse the lines of spans onto the end of out, false unless all of them were read
+bool readSpans(const std::vector<DocSpan>& spans, std::vector<DocLine>& out) {
+  File base, overlay;
+  bool ok = true;
+  for (const DocSpan& span : spans) {
+    File& src = span.file == DOC_BASE ? base : overlay;
+    if (!src)
+      src = SD_MMC.open(span.file == DOC_BASE ? docPath.c_str() : TXT_OVERLAY_FILE, FILE_READ);
+    if (!src) {
+      ok = false;
+      break;
+    }
+
+    // Line 0 of docPath is the start of the file, anything else needs the index
+    if (span.file == DOC_OVERLAY) {
+      src.seek(docSpans.overlayOffset(span.first));
+    } else if (span.first > 0) {
+      File idx = SD_MMC.open(TXT_INDEX_FILE, FILE_READ);
+      if (!idx) {
+        ok = false;
+        break;
+      }
+      src.seek(indexOffset(idx, span.first));
+      idx.close();
+    } else {
+      src.seek(0);
+    }
+
+    uint32_t i = 0;
+    for (; i < span.count && src.available(); i++) {
+      String line = src.readStringUntil('\n');
+      parseMarkdownLine(line.c_str(), line.length(), out);
+      out.back().splitToLines();
+    }
+    if (i < span.count) {
+      ok = false;
+      break;
+    }
+  }
+  if (base) base.close();
+  if (overlay) overlay.close();
+  return ok;
+}
+
+// Append the edited DocLines among [first, first + n) to the overlay, so the window can
+// drop them. Lines read from the card and left alone aren't written again
+bool pageOut(size_t first, size_t n) {
+  bool edited = false;
+  for (size_t i = first; i < first + n && !edited; i++) edited = docSpans.edited(i);
+  if (!edited)
+    return true;
+
+  lockDocFiles();
+  File f = SD_MMC.open(TXT_OVERLAY_FILE, FILE_APPEND);
+  if (!f) {
+    unlockDocFiles();
+    return false;
+  }
+  uint32_t start = f.size();
+  uint8_t buf[TXT_COPY_CHUNK];
+  SaveWriter out(f, buf, sizeof(buf));
+  std::vector<uint32_t> ends;
+  for (size_t i = first; i < first + n; i++) {
+    if (!docSpans.edited(i))
+      continue;
+    writeMarkdownLine(out, docLines[i]);
+    ends.push_back(start + out.size());
+  }
+  bool ok = out.flush();
+  f.flush();
+  ok = ok && f.size() == start + out.size();  // short writes mean the card is full
+  f.close();
+  unlockDocFiles();
+  if (!ok)
+    return false;
+
+  for (uint32_t end : ends) {
+    docSpans.overlayLine(start, end);
+    start = end;
+  }
+  return true;
+}
+
+// Replace docLines with markdown lines [first, last) of the document
+bool loadWindow(size_t first, size_t last) {
+  if (!pageOut(0, docLines.size()))
+    return false;
+  docSpans.dropBack(docLines.size());
+  docLines.clear();
+
+  std::vector<DocSpan> spans;
+  docSpans.load(first, last, spans);
+  windowStart = docSpans.before();
+  bool ok = readSpans(spans, docLines);
+  // Whatever couldn't be read stays where it is
+  if (docLines.size() < docSpans.window())
+    docSpans.dropBack(docSpans.window() - docLines.size());
+  return ok;
+}
+
+// Copy index entries [first, last) from idx to out, adding shift to each offset
+void copyIndex(File& idx, File& out, size_t first, size_t last, uint32_t shift) {
+  uint32_t offsets[TXT_COPY_CHUNK / sizeof(uint32_t)];
+  idx.seek(sizeof(DocIndexHeader) + first * sizeof(uint32_t));
+  while (first < last) {
+    size_t n = min(last - first, sizeof(offsets) / sizeof(offsets[0]));
+    idx.read((uint8_t*)offsets, n * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++) offsets[i] += shift;
+    out.write((uint8_t*)offsets, n * sizeof(uint32_t));
+    first += n;
+  }
+}
+
+// Copy bytes [from, to) of src to dst, returns the bytes copied
+uint32_t copyBytes(File& src, SaveWriter& dst, uint32_t from, uint32_t to) {
+  uint8_t buf[TXT_COPY_CHUNK];
+  uint32_t copied = 0;
+  src.seek(from);
+  while (from + copied < to) {
+    int n = src.read(buf, min((uint32_t)sizeof(buf), to - from - copied));
+    if (n <= 0)
+      break;
+    copied += dst.write(buf, n);
+  }
+  return copied;
+}
+
+// The files a document's lines outside the window are in: docPath (baseCount lines,
+// seeked through the index) and the overlay
+struct DocFiles {
+  File base, idx, overlay;
+
+  bool open(const DocSpans& doc, const String& basePath) {
+    if (doc.empty())
+      return true;
+    base = SD_MMC.open(basePath.c_str(), FILE_READ);
+    idx = SD_MMC.open(TXT_INDEX_FILE, FILE_READ);
+    if (doc.overlayLines() > 0)
+      overlay = SD_MMC.open(TXT_OVERLAY_FILE, FILE_READ);
+    return base && idx && (doc.overlayLines() == 0 || overlay);
+  }
+  void close() {
+    if (base) base.close();
+    if (idx) idx.close();
+    if (overlay) overlay.close();
+  }
+};
+
+// Copy the lines of spans to dst as they are and their offsets to idxOut (if open).
+// written is where dst is, more says lines follow
+void copySpans(const DocSpans& doc, const std::vector<DocSpan>& spans, size_t baseCount,
+               DocFiles& files, SaveWriter& dst, File& idxOut, uint32_t& written, bool more) {
+  for (size_t k = 0; k < spans.size(); k++) {
+    const DocSpan& span = spans[k];
+    if (span.file == DOC_OVERLAY) {
+      uint32_t from = doc.overlayOffset(span.first);
+      for (uint32_t i = 0; i < span.count && idxOut; i++) {
+        uint32_t offset = doc.overlayOffset(span.first + i) - from + written;
+        idxOut.write((uint8_t*)&offset, sizeof(offset));
+      }
+      written += copyBytes(files.overlay, dst, from, doc.overlayOffset(span.first + span.count));
+      continue;
+    }
+
+    uint32_t from = indexOffset(files.idx, span.first);
+    uint32_t to = indexOffset(files.idx, span.first + span.count);
+    if (idxOut)
+      copyIndex(files.idx, idxOut, span.first, span.first + span.count, written - from);
+    written += copyBytes(files.base, dst, from, to);
+
+    // The last line of docPath may not end in a newline, the next line can't follow it
+    if (span.first + span.count == baseCount && to > from && (more || k + 1 < spans.size())) {
+      uint8_t last = 0;
+      files.base.seek(to - 1);
+      files.base.read(&last, 1);
+      if (last != '\n')
+        written += dst.write((const uint8_t*)"\r\n", 2);
+    }
+  }
+}
+
+// Stream a document to dst: lines outside the window are copied from basePath and the
+// overlay as they are, writeWindow(written) writes the window and adds what it wrote.
+// The matching index goes to idxOut (if open).
+template <typename WindowFn>
+bool streamDocument(const DocSpans& doc, const String& basePath, size_t baseCount,
+                    SaveWriter& dst, File& idxOut, WindowFn writeWindow) {
+  DocFiles files;
+  if (!files.open(doc, basePath)) {
+    files.close();
+    return false;
+  }
+
+  DocIndexHeader h = {};
+  if (idxOut)
+    idxOut.write((uint8_t*)&h, sizeof(h));
+  uint32_t written = 0;
+
+  copySpans(doc, doc.beforeSpans(), baseCount, files, dst, idxOut, written, true);
+  writeWindow(written);
+  copySpans(doc, doc.afterSpans(), baseCount, files, dst, idxOut, written, false);
+
+  if (idxOut)
+    idxOut.write((uint8_t*)&written, sizeof(written));
+  files.close();
+  return true;
+}
+
+// Stream the whole document to dst, the window from docLines. The matching index goes
+// to idxOut (needed unless docLines are all of it), count gets the number of markdown
+// lines written.
+bool writeDocument(SaveWriter& dst, File& idxOut, size_t& count) {
+  if (!windowCoversDocument() && !idxOut)
+    return false;
+
+  bool ok = streamDocument(docSpans, docPath, docCount, dst, idxOut, [&](uint32_t& written) {
+    for (auto& dl : docLines) {
+      if (idxOut)
+        idxOut.write((uint8_t*)&written, sizeof(written));
+      written += writeMarkdownLine(dst, dl);
+    }
+  });
+  count = documentLines();
+  return ok;
+}
+
+// Write the document to path and point the index at it. The new file goes to
+// <path>.tmp in big blocks and only replaces path once it's complete and synced,
+// so losing power mid-save leaves the previous save (or a finished temp file) behind.
+bool writeWholeDocument(const String& path) {
+  String temp = path + TXT_TEMP_SUFFIX;
+  lockDocFiles();
+  File dst = SD_MMC.open(temp.c_str(), FILE_WRITE);
+  if (!dst) {
+    unlockDocFiles();
+    return false;
+  }
+  File idxOut = SD_MMC.open(TXT_INDEX_TEMP, FILE_WRITE);
+  bool indexed = idxOut;
+
+  // Fall back to a small buffer when the heap can't spare the big one
+  uint8_t small[TXT_COPY_CHUNK];
+  uint8_t* buf = (uint8_t*)malloc(TXT_SAVE_BUFFER);
+  SaveWriter out(dst, buf ? buf : small, buf ? TXT_SAVE_BUFFER : sizeof(small));
+
+  size_t count = 0;
+  bool ok = writeDocument(out, idxOut, count) && out.flush();
+  free(buf);
+  dst.flush();
+  ok = ok && dst.size() == out.size();  // short writes mean the card is full
+  dst.close();
+
+  if (!ok) {
+    if (idxOut) idxOut.close();
+    SD_MMC.remove(TXT_INDEX_TEMP);
+    SD_MMC.remove(temp.c_str());
+    unlockDocFiles();
+    return false;
+  }
+
+  // Recorded before the swap so a save interrupted halfway can be finished at load
+  SaveSum sum;
+  File written = SD_MMC.open(temp.c_str(), FILE_READ);
+  sum.size = out.size();
+  sum.lastWrite = (uint32_t)written.getLastWrite();
+  sum.crc = out.crc();
+  written.close();
+  if (!writeSaveSum(path, sum))
+    ESP_LOGW(TAG, "Couldn't record checksum of %s", path.c_str());
+
+  SD_MMC.remove(path.c_str());
+  if (!SD_MMC.rename(temp.c_str(), path.c_str())) {
+    ESP_LOGE(TAG, "Couldn't replace %s, new version left in %s", path.c_str(), temp.c_str());
+    if (idxOut) idxOut.close();
+    SD_MMC.remove(TXT_INDEX_TEMP);
+    unlockDocFiles();
+    return false;
+  }
+
+  // Stamp the new index with the file it describes so loading it again skips the scan
+  if (indexed) {
+    DocIndexHeader h;
+    File written = SD_MMC.open(path.c_str(), FILE_READ);
+    fillIndexHeader(h, path, written, count);
+    written.close();
+    idxOut.seek(0);
+    idxOut.write((uint8_t*)&h, sizeof(h));
+    idxOut.close();
+    SD_MMC.remove(TXT_INDEX_FILE);
+    SD_MMC.rename(TXT_INDEX_TEMP, TXT_INDEX_FILE);
+  }
+
+  // The whole document is in path now, the overlay isn't needed any more
+  docPath = path;
+  docCount = count;
+  docSpans.reset(indexed ? count : 0);
+  if (indexed) {
+    std::vector<DocSpan> spans;
+    docSpans.load(windowStart, windowStart + docLines.size(), spans);
+  } else {
+    // No index to page from, the window was all of it and stays edited
+    for (size_t i = 0; i < docLines.size(); i++) docSpans.inserted(i);
+  }
+  SD_MMC.remove(TXT_OVERLAY_FILE);
+  docFilesVersion++;
+  unlockDocFiles();
+  return true;
+}
+
+// ------------------ Edit log ------------------
+// Instead of rewriting the note, edits go to a log in /sys every few seconds, written by
+// a background task. Saving or loading starts a new log, sleeping only has to flush the
+// last batch and the next boot applies the log to the note (recoverEditLog()).
+// Once the log gets long the task writes the document as it is to a checkpoint file and
+// swaps in a new log that starts from it, so the loop never waits for that write.
+#define TXT_EDIT_LOG "/sys/TXT_EDIT.log"
+#define TXT_EDIT_TEMP "/sys/TXT_EDIT.tmp"  // next log while it's written, then renamed over
+#define TXT_EDIT_BAD "/sys/TXT_EDIT.bad"   // a log that didn't fit its note, kept to look at
+// Two so the one the log starts from stays whole until the next log is in place
+const char* const editLogCheckpoints[2] = {"/sys/TXT_CHECKPOINT0.txt", "/sys/TXT_CHECKPOINT1.txt"};
+
+// The document between two batches, for the log task to write a checkpoint of
+struct EditLogSnapshot {
+  DocSpans spans;      // where the lines outside the window are
+  uint32_t version;    // docFilesVersion they point into
+  String basePath;     // docPath
+  size_t baseCount;    // docCount
+  String window;       // docLines as markdown
+  String note;         // "<size> <lastWrite> <path>" of the note the log is for
+};
+
+EditLog editLog;                     // edits not handed to the log task yet
+String editLogPath = "";             // note the log applies to, "" when not logging
+String editLogNote = "";             // its stamp as the log header has it
+uint32_t editLogSeq = 0;             // batches handed over
+unsigned long editLogSince = 0;      // millis() of the oldest edit in editLog
+bool editLogRecovering = false;      // replaying at boot, the log is read not restarted
+
+// Shared with the log task
+SemaphoreHandle_t editLogMutex = NULL;       // guards the four below
+SemaphoreHandle_t editLogWriteMutex = NULL;  // held while the log file is written
+TaskHandle_t editLogTaskHandle = NULL;
+String editLogOutbox = "";           // text for the log task to append
+bool editLogRestarting = false;      // editLogOutbox starts a new log
+EditLogSnapshot* editLogSnapshot = NULL;  // checkpoint to write, the task frees it
+size_t editLogSnapshotAt = 0;        // editLogOutbox before this is in the snapshot
+volatile uint32_t editLogBytes = 0;  // size of the log on the card
+volatile uint32_t editLogCompactAt = EDIT_LOG_MAX_BYTES;  // checkpoint past this size
+volatile bool editLogCompacting = false;  // a snapshot is waiting or being written
+int editLogBase = -1;                // editLogCheckpoints[] the log starts from, log task only
+
+// Append text to the log file
+void editLogAppend(const String& text) {
+  if (text.length() == 0)
+    return;
+  File log = SD_MMC.open(TXT_EDIT_LOG, FILE_APPEND);
+  if (!log) {
+    ESP_LOGW(TAG, "Couldn't append to %s", TXT_EDIT_LOG);
+    return;
+  }
+  log.write((const uint8_t*)text.c_str(), text.length());
+  log.flush();  // synced before the next batch is taken
+  editLogBytes = log.size();
+  log.close();
+}
+
+// Write the document of snap to path, like a save but without an index or checksum
+bool writeCheckpoint(const EditLogSnapshot& snap, const char* path) {
+  File dst = SD_MMC.open(path, FILE_WRITE);
+  if (!dst)
+    return false;
+
+  uint8_t small[TXT_COPY_CHUNK];
+  uint8_t* buf = (uint8_t*)malloc(TXT_SAVE_BUFFER);
+  SaveWriter out(dst, buf ? buf : small, buf ? TXT_SAVE_BUFFER : sizeof(small));
+  File noIndex;
+
+  // The loop may not rewrite the files the spans point into while they're read, and
+  // a save or load since the snapshot was taken already replaced them
+  lockDocFiles();
+  bool ok = docFilesVersion == snap.version &&
+            streamDocument(snap.spans, snap.basePath, snap.baseCount, out, noIndex,
+                           [&](uint32_t& written) {
+                             written += out.write((const uint8_t*)snap.window.c_str(),
+                                                  snap.window.length());
+                           });
+  unlockDocFiles();
+  ok = ok && out.flush();
+  free(buf);
+  dst.flush();
+  ok = ok && dst.size() == out.size();  // short writes mean the card is full
+  dst.close();
+  if (!ok)
+    SD_MMC.remove(path);
+  return ok;
+}
+
+// Write a checkpoint of snap and start a new log from it holding rest (the batches
+// handed over after the snapshot). The old log and the checkpoint it starts from stay
+// until the new ones are complete, so losing power leaves one of the two logs whole.
+bool editLogCompact(const EditLogSnapshot& snap, const String& rest) {
+  int next = editLogBase == 0 ? 1 : 0;
+  const char* path = editLogCheckpoints[next];
+  if (!writeCheckpoint(snap, path))
+    return false;
+
+  File base = SD_MMC.open(path, FILE_READ);
+  if (!base) {
+    SD_MMC.remove(path);
+    return false;
+  }
+  char stamp[32];
+  snprintf(stamp, sizeof(stamp), "W %lu %lu ", (unsigned long)base.size(),
+           (unsigned long)base.getLastWrite());
+  base.close();
+  String header = String(stamp) + path + "\nT " + snap.note + "\n";
+
+  File log = SD_MMC.open(TXT_EDIT_TEMP, FILE_WRITE);
+  bool ok = log;
+  if (log) {
+    log.write((const uint8_t*)header.c_str(), header.length());
+    log.write((const uint8_t*)rest.c_str(), rest.length());
+    log.flush();
+    ok = log.size() == header.length() + rest.length();
+    log.close();
+  }
+  if (!ok) {
+    SD_MMC.remove(TXT_EDIT_TEMP);
+    SD_MMC.remove(path);
+    return false;
+  }
+
+  SD_MMC.remove(TXT_EDIT_LOG);
+  if (!SD_MMC.rename(TXT_EDIT_TEMP, TXT_EDIT_LOG))
+    ESP_LOGE(TAG, "Couldn't replace %s, new log left in %s", TXT_EDIT_LOG, TXT_EDIT_TEMP);
+  if (editLogBase >= 0)
+    SD_MMC.remove(editLogCheckpoints[editLogBase]);
+  editLogBase = next;
+  editLogBytes = header.length() + rest.length();
+  return true;
+}
+
+// Append whatever was handed over to the log file, and swap logs if a snapshot came with it
+void editLogDrain() {
+  xSemaphoreTake(editLogWriteMutex, portMAX_DELAY);
+  xSemaphoreTake(editLogMutex, portMAX_DELAY);
+  String batch = editLogOutbox;
+  bool restart = editLogRestarting;
+  EditLogSnapshot* snap = editLogSnapshot;
+  size_t snapAt = editLogSnapshotAt;
+  editLogOutbox = "";
+  editLogRestarting = false;
+  editLogSnapshot = NULL;
+  xSemaphoreGive(editLogMutex);
+
+  if (restart) {
+    SD_MMC.remove(TXT_EDIT_LOG);
+    for (const char* path : editLogCheckpoints) SD_MMC.remove(path);
+    editLogBase = -1;
+    editLogBytes = 0;
+    editLogCompactAt = EDIT_LOG_MAX_BYTES;
+  }
+  if (snap) {
+    // What came before the snapshot is in it, the old log has to hold it until the swap
+    editLogAppend(batch.substring(0, snapAt));
+    String rest = batch.substring(snapAt);
+    if (editLogCompact(*snap, rest)) {
+      ESP_LOGI(TAG, "Edit log folded into %s", editLogCheckpoints[editLogBase]);
+    } else {
+      ESP_LOGW(TAG, "Couldn't write an edit log checkpoint, keeping the log");
+      editLogAppend(rest);
+      editLogCompactAt = editLogBytes + EDIT_LOG_MAX_BYTES;  // not on every batch
+    }
+    delete snap;
+    editLogCompacting = false;
+  } else {
+    editLogAppend(batch);
+  }
+  xSemaphoreGive(editLogWriteMutex);
+}
+
+void editLogTask(void* parameter) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    editLogDrain();
+  }
+}
+
+void editLogHandOver(const String& text, bool restart) {
+  if (!editLogTaskHandle) {
+    editLogMutex = xSemaphoreCreateMutex();
+    editLogWriteMutex = xSemaphoreCreateMutex();
+    docFilesMutex = xSemaphoreCreateMutex();
+    xTaskCreate(editLogTask, "editLogTask", 8192, NULL, tskIDLE_PRIORITY + 1, &editLogTaskHandle);
+  }
+
+  xSemaphoreTake(editLogMutex, portMAX_DELAY);
+  if (restart) {
+    editLogOutbox = text;
+    editLogRestarting = true;
+    // A snapshot not taken yet belongs to the old log
+    if (editLogSnapshot) {
+      delete editLogSnapshot;
+      editLogSnapshot = NULL;
+      editLogCompacting = false;
+    }
+  } else {
+    editLogOutbox += text;
+  }
+  xSemaphoreGive(editLogMutex);
+  xTaskNotifyGive(editLogTaskHandle);
+}
+
+// Hand the log task the document as it is after the batches handed over so far
+void editLogHandSnapshot() {
+  EditLogSnapshot* snap = new EditLogSnapshot();
+  snap->spans = docSpans;
+  snap->version = docFilesVersion;
+  snap->basePath = docPath;
+  snap->baseCount = docCount;
+  snap->note = editLogNote;
+  for (auto& dl : docLines) {
+    appendMarkdownLine(snap->window, dl);
+    snap->window += "\r\n";
+  }
+
+  xSemaphoreTake(editLogMutex, portMAX_DELAY);
+  editLogSnapshot = snap;
+  editLogSnapshotAt = editLogOutbox.length();
+  editLogCompacting = true;
+  xSemaphoreGive(editLogMutex);
+  xTaskNotifyGive(editLogTaskHandle);
+}
+
+// Start a new log for path, which holds every edit so far (it was just loaded or saved).
+// An empty path stops logging.
+void editLogRestart(String path) {
+  if (editLogRecovering)
+    return;
+  editLog.clear();
+  editLogPath = "";
+
+  String header = "";
+  File base;
+  if (path != "" && path != "-") {
+    if (!path.startsWith("/"))
+      path = "/" + path;
+    base = SD_MMC.open(path.c_str(), FILE_READ);
+  }
+  if (base) {
+    // The log only applies to the note exactly as it is now
+    char stamp[32];
+    snprintf(stamp, sizeof(stamp), "W %lu %lu ", (unsigned long)base.size(),
+             (unsigned long)base.getLastWrite());
+    editLogNote = String(stamp + 2) + path;
+    header = String(stamp) + path + "\n";
+    base.close();
+    editLogPath = path;
+  }
+  editLogHandOver(header, true);
+}
+
+// Note an edit for the next batch
+void logLineChanged(size_t docIndex) {
+  if (editLog.empty())
+    editLogSince = millis();
+  editLog.changed(windowStart + docIndex);
+  docSpans.changed(docIndex);
+}
+void logLineInserted(size_t docIndex) {
+  if (editLog.empty())
+    editLogSince = millis();
+  editLog.inserted(windowStart + docIndex);
+  docSpans.inserted(docIndex);
+}
+void logLineErased(size_t docIndex) {
+  if (editLog.empty())
+    editLogSince = millis();
+  editLog.erased(windowStart + docIndex);
+  docSpans.erased(docIndex);
+}
+
+// Hand the collected edits to the log task once they're EDIT_LOG_INTERVAL_MS old (or
+// now when forced, e.g. before the DocLines they name are paged out)
+void editLogFlush(bool force) {
+  if (editLog.empty())
+    return;
+  if (editLogPath == "") {
+    editLog.clear();
+    return;
+  }
+  if (!force && millis() - editLogSince < EDIT_LOG_INTERVAL_MS)
+    return;
+
+  String batch = "";
+  editLog.pack(batch, ++editLogSeq, [&](String& out, uint32_t line) {
+    if (line >= windowStart && line - windowStart < docLines.size())
+      appendMarkdownLine(out, docLines[line - windowStart]);
+    else
+      ESP_LOGE(TAG, "Edited line %lu isn't loaded", (unsigned long)line);
+  });
+  editLogHandOver(batch, false);
+
+  // Replaying a long log at boot gets slow, the log task starts it over from a checkpoint
+  if (editLogBytes > editLogCompactAt && !editLogCompacting)
+    editLogHandSnapshot();
+}
+
+// Get every edit to path into the log on the card, false if path isn't being logged
+bool syncEditLog(String path) {
+  if (!path.startsWith("/"))
+    path = "/" + path;
+  if (editLogPath == "" || editLogPath != path)
+    return false;
+  editLogFlush(true);
+  editLogDrain();
+  return true;
+}
+
+// Drop DocLines past TXT_WINDOW_DOCLINES from the end of the window away from the view
+void evictDocLines(bool fromFront) {
+  if (docLines.size() <= TXT_WINDOW_DOCLINES)
+    return;
+
+  // Logged edits name DocLines by their text, get them out while it's still here
+  editLogFlush(true);
+
+  // Only the edited ones are written, the others are read back from where they came from
+  size_t n = docLines.size() - TXT_WINDOW_DOCLINES;
+  if (!pageOut(fromFront ? 0 : TXT_WINDOW_DOCLINES, n)) {
+    ESP_LOGW(TAG, "Couldn't write %s, keeping all DocLines", TXT_OVERLAY_FILE);
+    return;
+  }
+
+  if (fromFront) {
+    ulong removed = lineIndex.firstLine(n);
+    if (editingLine_index < n) {
+      if (!editingPagedOut)
+        editingDocPathLine = windowStart + editingLine_index;
+      editingPagedOut = true;
+      editingLine_index = n;
+    }
+    docSpans.dropFront(n);
+    docLines.erase(docLines.begin(), docLines.begin() + n);
+    windowStart += n;
+    editingLine_index -= n;
+    lineScroll = lineScroll > removed ? lineScroll - removed : 0;
+    caretLine = caretLine > removed ? caretLine - removed : 0;
+  } else {
+    if (editingLine_index >= TXT_WINDOW_DOCLINES) {
+      if (!editingPagedOut)
+        editingDocPathLine = windowStart + editingLine_index;
+      editingPagedOut = true;
+      editingLine_index = TXT_WINDOW_DOCLINES - 1;
+    }
+    docSpans.dropBack(n);
+    docLines.erase(docLines.begin() + TXT_WINDOW_DOCLINES, docLines.end());
+  }
+  refreshAllLineIndexes();
+}
+
+// Page DocLines in when the view gets within TXT_PAGE_MARGIN lines of a window edge
+void pageWindow() {
+  if (windowCoversDocument())
+    return;
+
+  std::vector<DocLine> page;
+  std::vector<DocSpan> spans;
+  if (windowStart > 0 && lineScroll < TXT_PAGE_MARGIN) {
+    // Parse the lines above the window
+    size_t n = min(windowStart, (size_t)TXT_PAGE_DOCLINES);
+    docSpans.above(n, spans);
+    if (!readSpans(spans, page))
+      return;
+    docSpans.takeAbove(n);
+
+    ulong added = 0;
+    for (auto& dl : page) added += dl.lines.size();
+    docLines.insert(docLines.begin(), std::make_move_iterator(page.begin()),
+                    std::make_move_iterator(page.end()));
+    editingLine_index += page.size();
+    windowStart -= n;
+    lineScroll += added;
+    caretLine += added;
+    refreshAllLineIndexes();
+    evictDocLines(false);
+    updateScreen = true;
+  } else if (docSpans.after() > 0 && lineScroll + TXT_PAGE_MARGIN >= lineIndex.total()) {
+    // Parse the lines below the window
+    size_t n = min((size_t)docSpans.after(), (size_t)TXT_PAGE_DOCLINES);
+    docSpans.below(n, spans);
+    if (!readSpans(spans, page))
+      return;
+    docSpans.takeBelow(n);
+
+    docLines.insert(docLines.end(), std::make_move_iterator(page.begin()),
+                    std::make_move_iterator(page.end()));
+    refreshAllLineIndexes();
+    evictDocLines(true);
+    updateScreen = true;
+  }
+
+  // Scrolled back to the editing DocLine (the window has no edits while it's paged out)
+  if (editingPagedOut && editingDocPathLine >= windowStart &&
+      editingDocPathLine < windowStart + docLines.size()) {
+    editingLine_index = editingDocPathLine - windowStart;
+    editingPagedOut = false;
+  }
+}
+
+// Bring the editing DocLine back after scrolling paged it out
+void pageInEditingLine() {
+  editLogFlush(true);
+  editingPagedOut = false;
+  size_t line = editingDocPathLine;
+  size_t first = line > TXT_WINDOW_DOCLINES / 2 ? line - TXT_WINDOW_DOCLINES / 2 : 0;
+  size_t last = min(first + TXT_WINDOW_DOCLINES, documentLines());
+
+  loadWindow(first, last);
+  if (docLines.empty()) {
+    docLines.emplace_back('T');
+    populateLines(docLines);
+    docSpans.inserted(0);
+  }
+  editingLine_index = min(line - first, docLines.size() - 1);
+  refreshAllLineIndexes();
+  resetCursor();
+  lineScroll = caretLine;
+  updateScreen = true;
+}
+
+// Drop the open document and everything it allocated
+void releaseDocument() {
+  docLines.clear();
+  editLog.clear();
+  ESP_LOGI(TAG, "Document memory: %u B peak, %u B reserved, %u B leaked", (unsigned)docArena.peak(),
+           (unsigned)docArena.reserved(), (unsigned)docArena.used());
+  docArena.reset();
+}
+
+// Load File
+void loadMarkdownFile(const String& path) {
+  fullRefreshRequests++;
+
+  // Invalid file
+  if (path == "" || path == " " || path == "-") {
+    OLED().toast("No file saved! Creating blank file.", 2000);
+
+    releaseDocument();
+    resetWindow("");
+    editLogRestart("");
+    // Create an empty new docLines object
+    docLines.emplace_back('T');
+    docSpans.inserted(0);
+    editingLine_index = 0;
+
+    // Populate and update as usual so UI doesn’t crash
+    populateLines(docLines);
+    refreshAllLineIndexes();
+    resetCursor();
+
+    if (SAVE_POWER)
+      pocketmage::setCpuSpeed(80);
+    SDActive = false;
+    return;
+  }
+
+  if (SD().getNoSD()) {
+    OLED().toast("LOAD FAILED - No SD!", 5000);
+    return;
+  }
+
+  SDActive = true;
+  pocketmage::setCpuSpeed(240);
+  delay(50);
+
+  releaseDocument();
+  recoverInterruptedSave(path);
+  File file = SD_MMC.open(path.c_str(), FILE_READ);
+  if (!file) {
+    ESP_LOGE("SD", "File does not exist: %s", path.c_str());  // FIXME: - Come up with better error handling
+                                                              //        - Should this be Error or Warning?
+    OLED().toast("LOAD FAILED - FILE MISSING", 2000);
+
+    resetWindow(path);
+    editLogRestart("");
+    // Create an empty new docLines object
+    docLines.emplace_back('T');
+    docSpans.inserted(0);
+    editingLine_index = 0;
+
+    // Populate and update as usual so UI doesn’t crash
+    populateLines(docLines);
+    refreshAllLineIndexes();
+    resetCursor();
+
+    if (SAVE_POWER)
+      pocketmage::setCpuSpeed(80);
+    SDActive = false;
+    return;
+  }
+
+  // One pass to index the file, then parse only the end of it (where typing carries on)
+  resetWindow(path);
+  bool intact = true;
+  lockDocFiles();
+  SD_MMC.remove(TXT_OVERLAY_FILE);  // left over from a session that wasn't saved
+  docFilesVersion++;
+  bool indexed = indexMarkdownFile(file, path, intact);
+  unlockDocFiles();
+  if (indexed) {
+    file.close();
+    docSpans.reset(docCount);
+    loadWindow(docCount > TXT_WINDOW_DOCLINES ? docCount - TXT_WINDOW_DOCLINES : 0, docCount);
+  } else {
+    // Without an index nothing can be read back, the window is all of it and stays edited
+    ESP_LOGW(TAG, "Couldn't index %s, loading all of it", path.c_str());
+    file.close();
+    std::vector<DocSpan> all = {{DOC_BASE, 0, UINT32_MAX}};
+    readSpans(all, docLines);
+    docSpans.reset(0);
+    for (size_t i = 0; i < docLines.size(); i++) docSpans.inserted(i);
+    docCount = docLines.size();
+  }
+
+  if (docLines.empty()) {
+    docLines.emplace_back('T');
+    populateLines(docLines);
+    docSpans.inserted(0);
+    editingLine_index = 0;
+  } else {
+    editingLine_index = docLines.size() - 1;
+  }
+
+  // Update indexes
+  refreshAllLineIndexes();
+  resetCursor();
+
+  if (SAVE_POWER)
+    pocketmage::setCpuSpeed(80);
+  SDActive = false;
+
+  if (intact) {
+    OLED().toast("FILE LOADED", 500);
+  } else {
+    ESP_LOGW(TAG, "%s doesn't match the checksum from its last save", path.c_str());
+    OLED().toast("FILE MAY BE INCOMPLETE", 2000);
+  }
+  editLogRestart(path);
+  fileLoaded = true;
+}
+
+void saveMarkdownFile(const String& path) {
+  if (SD().getNoSD()) {
+    OLED().toast("SAVE FAILED - No SD!", 3000);
+    return;
+  }
+  ESP_LOGE(TAG, "In save markdown file, setting cpu speed");
+  SDActive = true;
+  pocketmage::setCpuSpeed(240);
+  delay(50);
+
+  // Determine save path
+  String savePath = path;
+  if (savePath == "" || savePath == "-")
+    savePath = "/temp.txt";
+  if (!savePath.startsWith("/"))
+    savePath = "/" + savePath;
+
+  // Write each DocLine as Markdown, lines that aren't loaded come from the file they were in
+  if (!writeWholeDocument(savePath)) {
+    OLED().toast("SAVE FAILED - WRITE ERR", 2000);
+    ESP_LOGE("SD", "Failed to write file: %s", savePath.c_str());
+    SDActive = false;
+    return;
+  }
+
+  editLogRestart(savePath);
+
+  // Save metadata
+  SD().writeMetadata(savePath);
+  SD().setEditingFile(savePath);
+
+  OLED().toast("Saved: " + savePath, 1000);
+
+  if (SAVE_POWER)
+    pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
+  SDActive = false;
+}
+
+// Bring the line op names into the window while replaying, false if the document doesn't
+// have it. Replayed edits are paged out like typed ones, only the edited lines are written
+bool focusLogLine(const EditLogOp& op) {
+  EditLogOp inWindow = op;
+  inWindow.n = op.n - windowStart;
+  if (op.n >= windowStart && editLogOpFits(inWindow, docLines.size()))
+    return true;
+
+  size_t first = op.n > TXT_PAGE_DOCLINES ? op.n - TXT_PAGE_DOCLINES : 0;
+  if (!loadWindow(first, first + TXT_WINDOW_DOCLINES) || op.n < windowStart)
+    return false;
+  inWindow.n = op.n - windowStart;
+  return editLogOpFits(inWindow, docLines.size());
+}
+
+// Whether path is still the file a log header stamped
+bool editLogStampMatches(const String& path, unsigned long size, unsigned long lastWrite) {
+  File f;
+  if (path != "")
+    f = SD_MMC.open(path.c_str(), FILE_READ);
+  bool matches = f && f.size() == size && (uint32_t)f.getLastWrite() == lastWrite;
+  if (f)
+    f.close();
+  return matches;
+}
+
+void initFonts();
+
+// Apply the edit log of a session that ended without saving (sleep, power loss) to its
+// note. Runs at boot before an app opens a file.
+void recoverEditLog() {
+  // A log swap cut short: the new log is complete, the old one goes first
+  if (SD_MMC.exists(TXT_EDIT_TEMP)) {
+    File old = SD_MMC.open(TXT_EDIT_LOG, FILE_READ);
+    bool oldValid = old && old.readStringUntil('\n').startsWith("W ");
+    if (old)
+      old.close();
+    if (!oldValid) {
+      SD_MMC.remove(TXT_EDIT_LOG);
+      SD_MMC.rename(TXT_EDIT_TEMP, TXT_EDIT_LOG);
+    } else {
+      SD_MMC.remove(TXT_EDIT_TEMP);
+    }
+  }
+
+  File log = SD_MMC.open(TXT_EDIT_LOG, FILE_READ);
+  if (!log)
+    return;
+
+  // The log applies to path, either the note or a checkpoint of it
+  String header = log.readStringUntil('\n');
+  unsigned long size = 0, lastWrite = 0;
+  int n = 0;
+  String path = "";
+  if (sscanf(header.c_str(), "W %lu %lu %n", &size, &lastWrite, &n) == 2)
+    path = header.c_str() + n;
+
+  // A log started from a checkpoint names the note next
+  uint32_t start = log.position();
+  String note = path;
+  bool matches = editLogStampMatches(path, size, lastWrite);
+  String second = log.readStringUntil('\n');
+  if (sscanf(second.c_str(), "T %lu %lu %n", &size, &lastWrite, &n) == 2) {
+    note = second.c_str() + n;
+    matches = matches && editLogStampMatches(note, size, lastWrite);
+    start = log.position();
+  } else {
+    log.seek(start);
+  }
+
+  // A batch cut short by power loss is left out, down to a half written "C" line
+  uint32_t end = start;
+  while (log.available()) {
+    uint32_t lineStart = log.position();
+    String line = log.readStringUntil('\n');
+    EditLogOp op;
+    parseEditLogLine(line.c_str(), op);
+    if (op.kind == 'C' && log.position() == lineStart + line.length() + 1)
+      end = log.position();
+  }
+
+  if (!matches || end == start) {
+    if (end != start)
+      ESP_LOGW(TAG, "%s changed since its edit log was started, dropping the log", note.c_str());
+    log.close();
+    SD_MMC.remove(TXT_EDIT_LOG);
+    return;
+  }
+
+  OLED().oledWord("Recovering edits");
+  ESP_LOGI(TAG, "Replaying %lu B of edits onto %s", (unsigned long)(end - start), path.c_str());
+  editLogRecovering = true;
+  initFonts();
+  loadMarkdownFile(path);
+
+  // An op naming a line the document doesn't have means the log isn't for this
+  // document (or is damaged), none of it is applied then
+  bool fits = true;
+  log.seek(start);
+  while (fits && log.position() < end) {
+    String line = log.readStringUntil('\n');
+    EditLogOp op;
+    const char* text = parseEditLogLine(line.c_str(), op);
+    if (op.kind != 'I' && op.kind != 'D' && op.kind != 'S')
+      continue;
+    if (!focusLogLine(op)) {
+      ESP_LOGE(TAG, "Edit log names line %lu (%c) past the end of %s", (unsigned long)op.n,
+               op.kind, path.c_str());
+      fits = false;
+      break;
+    }
 
-  // Save metadata
-  SD().writeMetadata(savePath);
-  SD().setEditingFile(savePath);
+    size_t i = op.n - windowStart;
+    if (op.kind == 'I') {
+      docLines.insert(docLines.begin() + i, DocLine('B'));
+      docSpans.inserted(i);
+    } else if (op.kind == 'D') {
+      docLines.erase(docLines.begin() + i);
+      docSpans.erased(i);
+    } else {
+      std::vector<DocLine> parsed;
+      parseMarkdownLine(text, strlen(text), parsed);
+      docLines[i] = std::move(parsed.back());
+      docSpans.changed(i);
+    }
+  }
+  log.close();
 
-  OLED().oledWord("Saved: " + savePath);
-  delay(1000);
+  if (!fits) {
+    SD_MMC.remove(TXT_EDIT_BAD);
+    SD_MMC.rename(TXT_EDIT_LOG, TXT_EDIT_BAD);
+    OLED().toast("EDITS NOT RECOVERED", 2000);
+  } else if (writeWholeDocument(note)) {
+    SD_MMC.remove(TXT_EDIT_LOG);
+    for (const char* checkpoint : editLogCheckpoints) SD_MMC.remove(checkpoint);
+    SD().writeMetadata(note);
+  } else {
+    ESP_LOGE(TAG, "Couldn't write recovered edits to %s", note.c_str());
+  }
 
-  if (SAVE_POWER)
-    pocketmage::setCpuSpeed(POWER_SAVE_FREQ);
-  SDActive = false;
+  editLogRecovering = false;
+  releaseDocument();
+  resetWindow("");
 }
 
 void newMarkdownFile(const String& path) {
   if (SD().getNoSD()) {
-    OLED().oledWord("SAVE FAILED - No SD!");
-    delay(3000);
+    OLED().toast("SAVE FAILED - No SD!", 3000);
     return;
   }
 
@@ -1256,8 +2599,7 @@ void newMarkdownFile(const String& path) {
 
   File file = SD_MMC.open(savePath.c_str(), FILE_WRITE);
   if (!file) {
-    OLED().oledWord("SAVE FAILED - OPEN ERR");
-    delay(2000);
+    OLED().toast("SAVE FAILED - OPEN ERR", 2000);
     ESP_LOGE("SD", "Failed to open file for writing: %s", savePath.c_str());
     SDActive = false;
     return;
@@ -1271,8 +2613,7 @@ void newMarkdownFile(const String& path) {
   SD().writeMetadata(savePath);
   SD().setEditingFile(savePath);
 
-  OLED().oledWord("Created: " + savePath);
-  delay(1000);
+  OLED().toast("Created: " + savePath, 1000);
 
   loadMarkdownFile(savePath);
   updateScreen = true;
@@ -1283,55 +2624,374 @@ void newMarkdownFile(const String& path) {
 }
 
 
-// Returns the pixel width of a LineObject (vector of wordObjects)
-int getLineWidth(const LineObject& lineObj, char style) {
+// Returns the pixel width of display line li of doc
+int getLineWidth(const DocLine& doc, size_t li) {
   int lineWidth = 0;
-  for (const auto& w : lineObj.words) {
-    const GFXfont* font = pickFont(style, w.bold, w.italic);
-    display.setFont(font);
-
-    int16_t x1, y1;
-    uint16_t wpx, hpx;
-    display.getTextBounds(w.text.c_str(), 0, 0, &x1, &y1, &wpx, &hpx);
-
-    uint16_t spaceWidth;
-    display.getTextBounds(SPACEWIDTH_SYMBOL, 0, 0, &x1, &y1, &spaceWidth, &hpx);
+  const LineSpan& ln = doc.lines[li];
+  for (uint16_t k = 0; k < ln.wordCount; k++) {
+    const WordSpan& w = doc.words[ln.firstWord + k];
 
     // Add word width + space width (except after last word)
-    lineWidth += (wpx + WORDWIDTH_BUFFER);
-    if (&w != &lineObj.words.back()) {
-      lineWidth += spaceWidth;
+    lineWidth += (w.px + WORDWIDTH_BUFFER);
+    if (k + 1 < ln.wordCount) {
+      lineWidth += pickSpaceWidth(doc.style, w.bold(), w.italic());
     }
   }
   return lineWidth;
 }
 
-void editAppend(char inchar) {
-  static ulong lastTypeMillis = 0;
-  ulong currentMillis = millis();
+// ------------------ Cursor ------------------
+
+// Re-split one DocLine after an edit, keeping the line index in step
+void relayoutDocLine(size_t docIndex) {
+  DocLine& doc = docLines[docIndex];
+  size_t before = doc.lines.size();
+  logLineChanged(docIndex);
+  doc.parseWords();
+  doc.splitToLines();
+  if (doc.lines.size() != before) {
+    updateLineCount(docIndex);
+    updateScreen = true;
+  }
+}
+
+// Pixel offset of character pos from the start of line li, spaced like displayLine()
+int16_t caretOffset(DocLine& doc, size_t li, size_t pos) {
+  const LineSpan& ln = doc.lines[li];
+  int16_t x = 0;
+  for (uint16_t k = 0; k < ln.wordCount; k++) {
+    const WordSpan& w = doc.words[ln.firstWord + k];
+    if (pos <= w.start)
+      break;
+    if (pos < w.start + w.len) {
+      const FontMetrics& fm = pickMetrics(doc.style, w.bold(), w.italic());
+      return x + fm.advance(doc.text.contiguous(w.start, pos - w.start), pos - w.start);
+    }
+    if (pos == w.start + w.len)
+      return x + w.px;
+    x += w.px + pickSpaceWidth(doc.style, w.bold(), w.italic());
+  }
+  return x;
+}
+
+// Character of line li closest to pixel offset target
+size_t posAtOffset(DocLine& doc, size_t li, int16_t target) {
+  const LineSpan& ln = doc.lines[li];
+  int16_t x = 0;
+  for (uint16_t k = 0; k < ln.wordCount; k++) {
+    const WordSpan& w = doc.words[ln.firstWord + k];
+    if (target < x + w.px) {
+      const FontMetrics& fm = pickMetrics(doc.style, w.bold(), w.italic());
+      const char* s = doc.text.contiguous(w.start, w.len);
+      for (uint16_t c = 0; c < w.len; c++) {
+        uint8_t adv = fm.charAdvance(s[c]);
+        if (target < x + adv / 2)
+          return w.start + c;
+        x += adv;
+      }
+      return w.start + w.len;
+    }
+    x += w.px + pickSpaceWidth(doc.style, w.bold(), w.italic());
+  }
+
+  // Past the last word: end of this line, before the break into the next one
+  if (li + 1 < doc.lines.size())
+    return doc.lines[li + 1].start - 1;
+  return doc.text.size();
+}
+
+// New characters take the format of the one before the cursor
+void syncTypingAttr() {
+  const GapBuffer& text = docLines[editingLine_index].text;
+  if (cursorPos > 0 && text.at(cursorPos - 1) != ' ')
+    typingAttr = text.attrAt(cursorPos - 1);
+  else
+    typingAttr = 0;
+}
+
+// Recompute the caret, the view follows it when it changes line
+void updateCaret() {
+  DocLine& doc = docLines[editingLine_index];
+  if (cursorPos > doc.text.size())
+    cursorPos = doc.text.size();
+
+  size_t li = doc.lineOf(cursorPos);
+  ulong line = lineIndex.firstLine(editingLine_index) + li;
+  caretX = caretOffset(doc, li, cursorPos);
+
+  if (line != caretLine) {
+    caretLine = line;
+    if (currentEditMode == edit_inline)
+      updateScreen = true;
+
+    // Only scroll once the caret leaves the screen, a new line is then a partial update
+    if (caretLine + SCROLL_LINE_OFFSET < lineScroll || caretLine > lastVisibleLine) {
+      lineScroll = caretLine;
+      updateScreen = true;
+    }
+  }
+}
+
+// Put the cursor at the end of the editing DocLine without moving the view
+void resetCursor() {
+  DocLine& doc = docLines[editingLine_index];
+  cursorPos = doc.text.size();
+  size_t li = doc.lineOf(cursorPos);
+  caretLine = lineIndex.firstLine(editingLine_index) + li;
+  caretX = caretOffset(doc, li, cursorPos);
+  syncTypingAttr();
+}
+
+void cursorInsert(char c) {
+  DocLine& doc = docLines[editingLine_index];
+  if (!doc.text.insert(cursorPos, c, typingAttr))
+    return;  // DocLine is full
+  cursorPos++;
+
+  // A new word starts out as normal text
+  if (c == ' ')
+    typingAttr = 0;
+  if (doc.style == 'B')
+    doc.style = 'T';
+
+  relayoutDocLine(editingLine_index);
+}
+
+// BKSP: delete the character before the cursor or join with the DocLine above
+void cursorDeleteBack() {
+  DocLine& doc = docLines[editingLine_index];
+  if (cursorPos > 0) {
+    doc.text.erase(cursorPos - 1, 1);
+    cursorPos--;
+    relayoutDocLine(editingLine_index);
+    syncTypingAttr();
+    return;
+  }
+
+  // At very start of document, nothing to do
+  if (editingLine_index == 0)
+    return;
+
+  size_t above = editingLine_index - 1;
+  DocLine& prev = docLines[above];
+  if (prev.text.empty() || prev.style == 'B' || prev.style == 'H') {
+    // Blank lines and rules above are simply removed
+    logLineErased(above);
+    docLines.erase(docLines.begin() + above);
+    lineIndex.erase(above);
+    editingLine_index = above;
+  } else {
+    // Join this DocLine onto the end of the one above
+    size_t join = prev.text.size();
+    for (size_t i = 0; i < doc.text.size(); i++) {
+      if (!prev.text.insert(prev.text.size(), doc.text.at(i), doc.text.attrAt(i))) {
+        prev.text.erase(join, prev.text.size() - join);
+        return;  // Too long to join
+      }
+    }
+    logLineErased(editingLine_index);
+    docLines.erase(docLines.begin() + editingLine_index);
+    lineIndex.erase(editingLine_index);
+    editingLine_index = above;
+    cursorPos = join;
+    relayoutDocLine(above);
+  }
+
+  refreshOrderedListIndexes(editingLine_index, editingLine_index);
+  syncTypingAttr();
+  updateScreen = true;
+}
+
+// ENTER: split the DocLine at the cursor
+void cursorSplit() {
+  DocLine& doc = docLines[editingLine_index];
+
+  // Horizontal Rule
+  if (doc.style == 'H') {
+    doc.text.clear();
+    doc.text.insert(0, "---", 3, 0);
+    cursorPos = 3;
+  }
+
+  // Text after the cursor moves to the new DocLine
+  DocLine next('T');
+  for (size_t i = cursorPos; i < doc.text.size(); i++) {
+    next.text.insert(next.text.size(), doc.text.at(i), doc.text.attrAt(i));
+  }
+  doc.text.erase(cursorPos, doc.text.size() - cursorPos);
+  doc.parseWords();
+
+  // Check if false blank line, or a real one
+  if (doc.hasText() && doc.style == 'B')
+    doc.style = 'T';
+  if (!doc.hasText() && doc.style != 'H')
+    doc.style = 'B';
+
+  // Retain style on next line for certain styles
+  char nextLineStyle = doc.style;
+  if (nextLineStyle == 'C' || nextLineStyle == '>' || nextLineStyle == '-' || nextLineStyle == 'L') {
+      // keep same style
+  } else {
+      nextLineStyle = 'T'; // fallback to body text
+  }
+  next.style = nextLineStyle;
+
+  relayoutDocLine(editingLine_index);
+  next.parseWords();
+  next.splitToLines();
+
+  // Insert new DocLine immediately after the current one
+  size_t nextLines = next.lines.size();
+  editingLine_index++;
+  docLines.insert(docLines.begin() + editingLine_index, std::move(next));
+  lineIndex.insert(editingLine_index, nextLines);
+  logLineInserted(editingLine_index);
+  refreshOrderedListIndexes(editingLine_index - 1, editingLine_index);
+
+  cursorPos = 0;
+  typingAttr = 0;
+  updateScreen = true;
+}
+
+void cursorMoveChar(int dir) {
+  if (dir < 0) {
+    if (cursorPos > 0) {
+      cursorPos--;
+    } else if (editingLine_index > 0) {
+      editingLine_index--;
+      cursorPos = docLines[editingLine_index].text.size();
+    }
+  } else {
+    if (cursorPos < docLines[editingLine_index].text.size()) {
+      cursorPos++;
+    } else if (editingLine_index + 1 < docLines.size()) {
+      editingLine_index++;
+      cursorPos = 0;
+    }
+  }
+  syncTypingAttr();
+}
+
+// Move to the start of the previous / next word
+void cursorMoveWord(int dir) {
+  const GapBuffer& text = docLines[editingLine_index].text;
+  if (dir < 0) {
+    if (cursorPos == 0) {
+      cursorMoveChar(-1);
+      return;
+    }
+    size_t pos = cursorPos;
+    while (pos > 0 && text.at(pos - 1) == ' ') pos--;
+    while (pos > 0 && text.at(pos - 1) != ' ') pos--;
+    cursorPos = pos;
+  } else {
+    if (cursorPos >= text.size()) {
+      cursorMoveChar(1);
+      return;
+    }
+    size_t pos = cursorPos;
+    while (pos < text.size() && text.at(pos) != ' ') pos++;
+    while (pos < text.size() && text.at(pos) == ' ') pos++;
+    cursorPos = pos;
+  }
+  syncTypingAttr();
+}
+
+// Move to a display line, keeping the caret's horizontal position
+void cursorToLine(ulong line) {
+  ulong total = lineIndex.total();
+  if (total == 0)
+    return;
+  if (line >= total)
+    line = total - 1;
+
+  size_t docIndex = 0, lineInDoc = 0;
+  if (!locateLine(line, docIndex, lineInDoc))
+    return;
+  editingLine_index = docIndex;
+  editingPagedOut = false;
+  cursorPos = posAtOffset(docLines[docIndex], lineInDoc, caretX);
+  syncTypingAttr();
+}
+
+// Cycle normal -> bold -> italic -> bold+italic for the word at the cursor
+void cursorCycleFormat() {
+  static const uint8_t formatCycle[] = {0, ATTR_BOLD, ATTR_ITALIC, ATTR_BOLD | ATTR_ITALIC};
+
+  int currentIndex = 0;
+  for (int i = 0; i < 4; i++) {
+    if (formatCycle[i] == typingAttr) {
+      currentIndex = i;
+      break;
+    }
+  }
+  typingAttr = formatCycle[(currentIndex + 1) % 4];
 
-  bool moveView = false;
+  GapBuffer& text = docLines[editingLine_index].text;
+  size_t start = cursorPos, end = cursorPos;
+  while (start > 0 && text.at(start - 1) != ' ') start--;
+  while (end < text.size() && text.at(end) != ' ') end++;
+  if (end > start) {
+    text.setAttr(start, end - start, typingAttr);
+    relayoutDocLine(editingLine_index);
+  }
+}
 
-  // Lower baseline clock speed here?
+// Cycle the markdown style of the editing DocLine
+void cursorCycleStyle() {
+  // Define the cycle order
+  static const char styleCycle[] = {'T', '1', '2', '3', '>', 'L', '-', 'C', 'H'};
+  static const int numStyles = sizeof(styleCycle) / sizeof(styleCycle[0]);
 
-  // Direct access to DocLine, LineObject, and wordObject
-  DocLine& editingDocLine = docLines[editingLine_index];
-  LineObject* lastLine;
-  wordObject* lastWord;
+  DocLine& doc = docLines[editingLine_index];
 
-  // Ensure we have at least one line
-  if (editingDocLine.lines.empty()) {
-    LineObject blankLine;
-    blankLine.index = indexCounter++;
-    editingDocLine.lines.push_back(blankLine);
+  // Find current style index
+  int currentIndex = 0;
+  for (int i = 0; i < numStyles; i++) {
+    if (doc.style == styleCycle[i]) {
+      currentIndex = i;
+      break;
+    }
   }
-  lastLine = &editingDocLine.lines.back();
 
-  // Ensure we have at least one word
-  if (lastLine->words.empty()) {
-    lastLine->words.push_back({"", false, false});
+  // Move to next style in cycle
+  currentIndex = (currentIndex + 1) % numStyles;
+  doc.style = styleCycle[currentIndex];
+  relayoutDocLine(editingLine_index);
+  refreshOrderedListIndexes(editingLine_index, editingLine_index);
+}
+
+// TAB: switch between typing at the end of a DocLine and editing anywhere
+void toggleEditMode() {
+  if (currentEditMode == edit_append) {
+    // If scrolling, edit inline at the scrolled-to line
+    if (TOUCH().getLastTouch() != -1) {
+      caretX = 0;
+      cursorToLine(lineScroll);
+    } else if (editingPagedOut) {
+      pageInEditingLine();
+    }
+    currentEditMode = edit_inline;
+  } else {
+    currentEditMode = edit_append;
+    cursorPos = docLines[editingLine_index].text.size();
+    syncTypingAttr();
   }
-  lastWord = &lastLine->words.back();
+  updateScreen = true;
+}
+
+void editDocument(char inchar) {
+  static ulong lastTypeMillis = 0;
+
+  bool inlineMode = (currentEditMode == edit_inline);
+
+  // Scrolled far enough that the editing DocLine was paged out (TAB places the cursor itself)
+  if (inchar != 0 && inchar != 9 && editingPagedOut)
+    pageInEditingLine();
+
+  // Append mode always types at the end of the DocLine
+  if (!inlineMode)
+    cursorPos = docLines[editingLine_index].text.size();
 
   if (inchar != 0) {
     // Increase clock speed here for faster processing?
@@ -1345,17 +3005,18 @@ void editAppend(char inchar) {
   // Return home
   else if (inchar == 12 && CurrentTXTState_NEW != JOURNAL_MODE) {
     HOME_INIT();
+    retireFrames();
+    fontCache.clear();
   }
   // Return to journal app if in journal mode
   else if (inchar == 12 && CurrentTXTState_NEW == JOURNAL_MODE) {
     JOURNAL_INIT();
+    retireFrames();
+    fontCache.clear();
   }
   // TAB Recieved
   else if (inchar == 9) {
-    // If scrolling, edit inline
-    if (TOUCH().getLastTouch() != -1) {
-    }
-
+    toggleEditMode();
   }
   // SHIFT Recieved
   else if (inchar == 17) {
@@ -1373,204 +3034,44 @@ void editAppend(char inchar) {
   }
   // Space Recieved
   else if (inchar == 32) {
-    if (getLineWidth(*lastLine, editingDocLine.style) > display.width() - DISPLAY_WIDTH_BUFFER) {
-      // Word does not fit -> wrap to new line
-      // Remove the word from the old line
-      wordObject movedWord = std::move(*lastWord);
-      lastLine->words.pop_back();
-
-      // Create new line, move the word into it
-      LineObject newLine;
-      newLine.words.push_back(std::move(movedWord));
-      editingDocLine.lines.push_back(std::move(newLine));
-
-      // Update lastLine and lastWord
-      lastLine = &editingDocLine.lines.back();
-      lastWord = &lastLine->words.back();
-
-      // Update line indexes
-      refreshAllLineIndexes();
-
-      // Mark screen for update
-      updateScreen = true;
-      moveView = true;
-    }
-
-    // Start a new empty word for the next input
-    wordObject newWord;
-    newWord.text = "";
-    newWord.bold = false;
-    newWord.italic = false;
-    lastLine->words.push_back(std::move(newWord));
-    lastWord = &lastLine->words.back();
+    cursorInsert(' ');
   }
   // ENTER Received
   else if (inchar == 13) {
-    // Check if false blank line
-    bool hasAnyText = false;
-    for (auto& ln : editingDocLine.lines) {
-      if (lineHasText(ln)) {
-        hasAnyText = true;
-        break;
-      }
-    }
-    if (hasAnyText && editingDocLine.style == 'B') {
-      editingDocLine.style = 'T';
-    }
-
-    // Line types
-    // Horizontal Rule
-    if (editingDocLine.style == 'H') {
-      editingDocLine.line = "---";
-      editingDocLine.words.clear();
-      editingDocLine.parseWords();
-      editingDocLine.splitToLines();
-    }
-    // Blank Line
-    bool currentLineEmpty = true;
-    for (auto& ln : editingDocLine.lines) {
-      if (lineHasText(ln)) {
-        currentLineEmpty = false;
-        break;
-      }
-    }
-    if (currentLineEmpty) {
-      editingDocLine.style = 'B';
-    }
-
-    // Retain style on next line for certain styles
-    char nextLineStyle = editingDocLine.style;
-    if (nextLineStyle == 'C' || nextLineStyle == '>' || nextLineStyle == '-' || nextLineStyle == 'L') {
-        // keep same style
-    } else {
-        nextLineStyle = 'T'; // fallback to body text
-    }
-
-    // Wrap current word if it doesn't fit
-    if (getLineWidth(*lastLine, editingDocLine.style) > display.width() - DISPLAY_WIDTH_BUFFER) {
-      wordObject movedWord = std::move(*lastWord);
-      lastLine->words.pop_back();
-
-      LineObject newLine;
-      newLine.words.push_back(std::move(movedWord));
-      editingDocLine.lines.push_back(std::move(newLine));
-
-      lastLine = &editingDocLine.lines.back();
-      lastWord = &lastLine->words.back();
-    }
-
-    // Finish current DocLine and create a new one
-    DocLine newDocLine;
-    newDocLine.style = nextLineStyle;
-
-    // Add one line and one empty word
-    LineObject newLine;
-    newLine.index = indexCounter++;
-    newLine.words.push_back({"", false, false});
-    newDocLine.lines.push_back(std::move(newLine));
-
-    // Insert new DocLine immediately after the current one
-    editingLine_index++;
-    docLines.insert(docLines.begin() + editingLine_index, std::move(newDocLine));
-
-    // Update lastLine/lastWord to point to new line
-    lastLine = &docLines[editingLine_index].lines.back();
-    lastWord = &lastLine->words.back();
-
-    // Refresh all line indexes
-    refreshAllLineIndexes();
-
-    // Mark screen for update
-    updateScreen = true;
-    moveView = true;
+    cursorSplit();
   }
-  // ESC / CLEAR Recieved
+  // ESC / CLEAR Recieved (Word type select when inline)
   else if (inchar == 20) {
+    if (inlineMode)
+      cursorCycleFormat();
   }
   // LEFT
   else if (inchar == 19) {
+    if (inlineMode)
+      cursorMoveChar(-1);
   }
   // RIGHT
   else if (inchar == 21) {
+    if (inlineMode)
+      cursorMoveChar(1);
   }
-  // SHFT + LEFT (Text type select)
+  // SHFT + LEFT (Text type select, previous word when inline)
   else if (inchar == 28) {
-    // Define the cycle order
-    static const char styleCycle[] = {'T', '1', '2', '3', '>', 'L', '-', 'C', 'H'};
-    static const int numStyles = sizeof(styleCycle) / sizeof(styleCycle[0]);
-
-    // Find current style index
-    int currentIndex = 0;
-    for (int i = 0; i < numStyles; i++) {
-      if (editingDocLine.style == styleCycle[i]) {
-        currentIndex = i;
-        break;
-      }
-    }
-
-    // Move to next style in cycle
-    currentIndex = (currentIndex + 1) % numStyles;
-    editingDocLine.style = styleCycle[currentIndex];
+    if (inlineMode)
+      cursorMoveWord(-1);
+    else
+      cursorCycleStyle();
   }
-  // SHFT + RIGHT (Word type select)
+  // SHFT + RIGHT (Word type select, next word when inline)
   else if (inchar == 30) {
-    if (lastWord->bold == false && lastWord->italic == false) {
-      // If regular text switch to bold
-      lastWord->bold = true;
-      lastWord->italic = false;
-    } else if (lastWord->bold == true && lastWord->italic == false) {
-      // If bold switch to italic
-      lastWord->bold = false;
-      lastWord->italic = true;
-    } else if (lastWord->bold == false && lastWord->italic == true) {
-      // If italic switch to bold+italic
-      lastWord->bold = true;
-      lastWord->italic = true;
-    } else if (lastWord->bold == true && lastWord->italic == true) {
-      // If bold+italic switch to regular text
-      lastWord->bold = false;
-      lastWord->italic = false;
-    }
+    if (inlineMode)
+      cursorMoveWord(1);
+    else
+      cursorCycleFormat();
   }
   // BKSP Received
   else if (inchar == 8) {
-    if (lastWord->text.length() > 0) {
-      // Remove the last character of the current word
-      lastWord->text.remove(lastWord->text.length() - 1);
-    } else {
-      // Current word is empty, move to previous word or line
-      LineObject* linePtr = lastLine;
-      wordObject* wordPtr = lastWord;
-
-      if (linePtr->words.size() > 1) {
-        // Pop the empty word and go to the previous word in the same line
-        linePtr->words.pop_back();
-        wordPtr = &linePtr->words.back();
-      } else {
-        // First word in the line
-        DocLine& docLineRef = docLines[editingLine_index];
-
-        if (docLineRef.lines.size() > 1) {
-          // Move to previous LineObject in the same DocLine
-          docLineRef.lines.pop_back();
-          linePtr = &docLineRef.lines.back();
-          wordPtr = &linePtr->words.back();
-        } else if (editingLine_index > 0) {
-          // Move to previous DocLine
-          editingLine_index--;
-          DocLine& prevDocLine = docLines[editingLine_index];
-          linePtr = &prevDocLine.lines.back();
-          wordPtr = &linePtr->words.back();
-        } else {
-          // At very start of document, nothing to do
-          return;
-        }
-      }
-
-      // Update lastLine / lastWord references
-      lastLine = linePtr;
-      lastWord = wordPtr;
-    }
+    cursorDeleteBack();
   }
   // SAVE Recieved
   else if (inchar == 6 && CurrentTXTState_NEW != JOURNAL_MODE) {
@@ -1611,12 +3112,13 @@ void editAppend(char inchar) {
 
   // Font Switcher
   else if (inchar == 14) {
+    PrevTXTState_NEW = CurrentTXTState_NEW;
     CurrentTXTState_NEW = FONT;
     KB().setKeyboardState(FUNC);
     updateScreen = true;
   } else {
-    // Add char to current word
-    lastWord->text += inchar;
+    // Add char at the cursor
+    cursorInsert(inchar);
 
     if (inchar >= 48 && inchar <= 57) {
     }  // Only leave FN on if typing numbers
@@ -1628,36 +3130,28 @@ void editAppend(char inchar) {
   if (inchar != 0) {
     // Typing is happening
     lastTypeMillis = millis();
+    updateCaret();
+    pageWindow();
   }
 
-  currentMillis = millis();
-  // Make sure oled only updates at 60fps
-  if (currentMillis - OLEDFPSMillis >= (1000 / 60)) {
-    OLEDFPSMillis = currentMillis;
-    // Show line on OLED when not actively scrolling
-    if (TOUCH().getLastTouch() == -1) {
-      bool currentlyTyping = (millis() - lastTypeMillis < TYPE_INTERFACE_TIMEOUT);
-
-      // Flush KB IC if not in use
-      if (!currentlyTyping)
-        keypad.flush();
+  // Show line on OLED when not actively scrolling
+  if (TOUCH().getLastTouch() == -1) {
+    bool currentlyTyping = (millis() - lastTypeMillis < TYPE_INTERFACE_TIMEOUT);
 
-      int lineWidth = getLineWidth(*lastLine, editingDocLine.style);
+    // Flush KB IC if not in use, or come back when typing times out to switch to the info bar
+    if (!currentlyTyping)
+      keypad.flush();
+    else
+      KB().wakeAt(lastTypeMillis + TYPE_INTERFACE_TIMEOUT);
 
-      oledEditorDisplay(*lastLine, *lastWord, lineWidth, currentlyTyping);
-    } else {
-      // Scrolling display function here
-      scrollPreview();
-    }
-  }
+    const DocLine& doc = docLines[editingLine_index];
+    size_t li = doc.lineOf(cursorPos);
+    int lineWidth = getLineWidth(doc, li);
 
-  // Center scroll on typed line if a line update has been registered
-  if (moveView) {
-    // Update scroll to currently edited line
-    if (editingDocLine.lines.empty())
-      lineScroll = 0;
-    else
-      lineScroll = editingDocLine.lines.back().index;
+    oledEditorDisplay(doc, li, cursorPos, typingAttr, lineWidth, currentlyTyping);
+  } else {
+    // Scrolling display function here
+    scrollPreview();
   }
 
   if (SAVE_POWER) setCpuFrequencyMhz(POWER_SAVE_FREQ);
@@ -1665,124 +3159,134 @@ void editAppend(char inchar) {
 
 // INIT
 void initFonts() {
+  // Packs copied to the card since last time are picked up
+  retireFrames();
+  fontCache.clear();
+
+  // Space widths are measured lazily by pickSpaceWidth()
+  for (auto& fm : fonts) {
+    for (auto& w : fm.spaceWidth) w = -1;
+  }
+
   // Mono
-  fonts[mono].normal = &FreeMono9pt8b;
-  fonts[mono].normal_B = &FreeMonoBold9pt8b;
-  fonts[mono].normal_I = &FreeMonoOblique9pt8b;
-  fonts[mono].normal_BI = &FreeMonoBoldOblique9pt8b;
-
-  fonts[mono].h1 = &FreeMonoBold24pt8b;
-  fonts[mono].h1_B = &FreeMonoBold24pt8b;  // Already bold
-  fonts[mono].h1_I = &FreeMonoBoldOblique24pt8b;
-  fonts[mono].h1_BI = &FreeMonoBoldOblique24pt8b;
-
-  fonts[mono].h2 = &FreeMonoBold18pt8b;
-  fonts[mono].h2_B = &FreeMonoBold18pt8b;
-  fonts[mono].h2_I = &FreeMonoBoldOblique18pt8b;
-  fonts[mono].h2_BI = &FreeMonoBoldOblique18pt8b;
-
-  fonts[mono].h3 = &FreeMonoBold12pt8b;
-  fonts[mono].h3_B = &FreeMonoBold12pt8b;
-  fonts[mono].h3_I = &FreeMonoBoldOblique12pt8b;
-  fonts[mono].h3_BI = &FreeMonoBoldOblique12pt8b;
-
-  fonts[mono].code = &FreeMono9pt8b;
-  fonts[mono].code_B = &FreeMono9pt8b;
-  fonts[mono].code_I = &FreeMono9pt8b;
-  fonts[mono].code_BI = &FreeMono9pt8b;
-
-  fonts[mono].quote = &FreeMono9pt8b;
-  fonts[mono].quote_B = &FreeMonoBold9pt8b;
-  fonts[mono].quote_I = &FreeMonoOblique9pt8b;
-  fonts[mono].quote_BI = &FreeMonoBoldOblique9pt8b;
-
-  fonts[mono].list = &FreeMono9pt8b;
-  fonts[mono].list_B = &FreeMonoBold9pt8b;
-  fonts[mono].list_I = &FreeMonoOblique9pt8b;
-  fonts[mono].list_BI = &FreeMonoBoldOblique9pt8b;
+  fonts[mono].normal = TXT_FONT(FreeMono9pt);
+  fonts[mono].normal_B = TXT_FONT(FreeMonoBold9pt);
+  fonts[mono].normal_I = TXT_FONT(FreeMonoOblique9pt);
+  fonts[mono].normal_BI = TXT_FONT(FreeMonoBoldOblique9pt);
+
+  fonts[mono].h1 = TXT_FONT(FreeMonoBold24pt);
+  fonts[mono].h1_B = TXT_FONT(FreeMonoBold24pt);  // Already bold
+  fonts[mono].h1_I = TXT_FONT(FreeMonoBoldOblique24pt);
+  fonts[mono].h1_BI = TXT_FONT(FreeMonoBoldOblique24pt);
+
+  fonts[mono].h2 = TXT_FONT(FreeMonoBold18pt);
+  fonts[mono].h2_B = TXT_FONT(FreeMonoBold18pt);
+  fonts[mono].h2_I = TXT_FONT(FreeMonoBoldOblique18pt);
+  fonts[mono].h2_BI = TXT_FONT(FreeMonoBoldOblique18pt);
+
+  fonts[mono].h3 = TXT_FONT(FreeMonoBold12pt);
+  fonts[mono].h3_B = TXT_FONT(FreeMonoBold12pt);
+  fonts[mono].h3_I = TXT_FONT(FreeMonoBoldOblique12pt);
+  fonts[mono].h3_BI = TXT_FONT(FreeMonoBoldOblique12pt);
+
+  fonts[mono].code = TXT_FONT(FreeMono9pt);
+  fonts[mono].code_B = TXT_FONT(FreeMono9pt);
+  fonts[mono].code_I = TXT_FONT(FreeMono9pt);
+  fonts[mono].code_BI = TXT_FONT(FreeMono9pt);
+
+  fonts[mono].quote = TXT_FONT(FreeMono9pt);
+  fonts[mono].quote_B = TXT_FONT(FreeMonoBold9pt);
+  fonts[mono].quote_I = TXT_FONT(FreeMonoOblique9pt);
+  fonts[mono].quote_BI = TXT_FONT(FreeMonoBoldOblique9pt);
+
+  fonts[mono].list = TXT_FONT(FreeMono9pt);
+  fonts[mono].list_B = TXT_FONT(FreeMonoBold9pt);
+  fonts[mono].list_I = TXT_FONT(FreeMonoOblique9pt);
+  fonts[mono].list_BI = TXT_FONT(FreeMonoBoldOblique9pt);
 
   // Serif
-  fonts[serif].normal = &FreeSerif9pt8b;
-  fonts[serif].normal_B = &FreeSerifBold9pt8b;
-  fonts[serif].normal_I = &FreeSerifItalic9pt8b;
-  fonts[serif].normal_BI = &FreeSerifBoldItalic9pt8b;
-
-  fonts[serif].h1 = &FreeSerifBold24pt8b;
-  fonts[serif].h1_B = &FreeSerifBold24pt8b;
-  fonts[serif].h1_I = &FreeSerifBoldItalic24pt8b;
-  fonts[serif].h1_BI = &FreeSerifBoldItalic24pt8b;
-
-  fonts[serif].h2 = &FreeSerifBold18pt8b;
-  fonts[serif].h2_B = &FreeSerifBold18pt8b;
-  fonts[serif].h2_I = &FreeSerifBoldItalic18pt8b;
-  fonts[serif].h2_BI = &FreeSerifBoldItalic18pt8b;
-
-  fonts[serif].h3 = &FreeSerifBold12pt8b;
-  fonts[serif].h3_B = &FreeSerifBold12pt8b;
-  fonts[serif].h3_I = &FreeSerifBoldItalic12pt8b;
-  fonts[serif].h3_BI = &FreeSerifBoldItalic12pt8b;
-
-  fonts[serif].code = &FreeMono9pt8b;
-  fonts[serif].code_B = &FreeMono9pt8b;
-  fonts[serif].code_I = &FreeMono9pt8b;
-  fonts[serif].code_BI = &FreeMono9pt8b;
-
-  fonts[serif].quote = &FreeSerif9pt8b;
-  fonts[serif].quote_B = &FreeSerifBold9pt8b;
-  fonts[serif].quote_I = &FreeSerifItalic9pt8b;
-  fonts[serif].quote_BI = &FreeSerifBoldItalic9pt8b;
-
-  fonts[serif].list = &FreeSerif9pt8b;
-  fonts[serif].list_B = &FreeSerifBold9pt8b;
-  fonts[serif].list_I = &FreeSerifItalic9pt8b;
-  fonts[serif].list_BI = &FreeSerifBoldItalic9pt8b;
+  fonts[serif].normal = TXT_FONT(FreeSerif9pt);
+  fonts[serif].normal_B = TXT_FONT(FreeSerifBold9pt);
+  fonts[serif].normal_I = TXT_FONT(FreeSerifItalic9pt);
+  fonts[serif].normal_BI = TXT_FONT(FreeSerifBoldItalic9pt);
+
+  fonts[serif].h1 = TXT_FONT(FreeSerifBold24pt);
+  fonts[serif].h1_B = TXT_FONT(FreeSerifBold24pt);
+  fonts[serif].h1_I = TXT_FONT(FreeSerifBoldItalic24pt);
+  fonts[serif].h1_BI = TXT_FONT(FreeSerifBoldItalic24pt);
+
+  fonts[serif].h2 = TXT_FONT(FreeSerifBold18pt);
+  fonts[serif].h2_B = TXT_FONT(FreeSerifBold18pt);
+  fonts[serif].h2_I = TXT_FONT(FreeSerifBoldItalic18pt);
+  fonts[serif].h2_BI = TXT_FONT(FreeSerifBoldItalic18pt);
+
+  fonts[serif].h3 = TXT_FONT(FreeSerifBold12pt);
+  fonts[serif].h3_B = TXT_FONT(FreeSerifBold12pt);
+  fonts[serif].h3_I = TXT_FONT(FreeSerifBoldItalic12pt);
+  fonts[serif].h3_BI = TXT_FONT(FreeSerifBoldItalic12pt);
+
+  fonts[serif].code = TXT_FONT(FreeMono9pt);
+  fonts[serif].code_B = TXT_FONT(FreeMono9pt);
+  fonts[serif].code_I = TXT_FONT(FreeMono9pt);
+  fonts[serif].code_BI = TXT_FONT(FreeMono9pt);
+
+  fonts[serif].quote = TXT_FONT(FreeSerif9pt);
+  fonts[serif].quote_B = TXT_FONT(FreeSerifBold9pt);
+  fonts[serif].quote_I = TXT_FONT(FreeSerifItalic9pt);
+  fonts[serif].quote_BI = TXT_FONT(FreeSerifBoldItalic9pt);
+
+  fonts[serif].list = TXT_FONT(FreeSerif9pt);
+  fonts[serif].list_B = TXT_FONT(FreeSerifBold9pt);
+  fonts[serif].list_I = TXT_FONT(FreeSerifItalic9pt);
+  fonts[serif].list_BI = TXT_FONT(FreeSerifBoldItalic9pt);
 
   // Sans
-  fonts[sans].normal = &FreeSans9pt8b;
-  fonts[sans].normal_B = &FreeSansBold9pt8b;
-  fonts[sans].normal_I = &FreeSansOblique9pt8b;
-  fonts[sans].normal_BI = &FreeSansBoldOblique9pt8b;
-
-  fonts[sans].h1 = &FreeSansBold24pt8b;
-  fonts[sans].h1_B = &FreeSansBold24pt8b;
-  fonts[sans].h1_I = &FreeSansBoldOblique24pt8b;
-  fonts[sans].h1_BI = &FreeSansBoldOblique24pt8b;
-
-  fonts[sans].h2 = &FreeSansBold18pt8b;
-  fonts[sans].h2_B = &FreeSansBold18pt8b;
-  fonts[sans].h2_I = &FreeSansBoldOblique18pt8b;
-  fonts[sans].h2_BI = &FreeSansBoldOblique18pt8b;
-
-  fonts[sans].h3 = &FreeSansBold12pt8b;
-  fonts[sans].h3_B = &FreeSansBold12pt8b;
-  fonts[sans].h3_I = &FreeSansBoldOblique12pt8b;
-  fonts[sans].h3_BI = &FreeSansBoldOblique12pt8b;
-
-  fonts[sans].code = &FreeMono9pt8b;
-  fonts[sans].code_B = &FreeMono9pt8b;
-  fonts[sans].code_I = &FreeMono9pt8b;
-  fonts[sans].code_BI = &FreeMono9pt8b;
-
-  fonts[sans].quote = &FreeSans9pt8b;
-  fonts[sans].quote_B = &FreeSansBold9pt8b;
-  fonts[sans].quote_I = &FreeSansOblique9pt8b;
-  fonts[sans].quote_BI = &FreeSansBoldOblique9pt8b;
-
-  fonts[sans].list = &FreeSans9pt8b;
-  fonts[sans].list_B = &FreeSansBold9pt8b;
-  fonts[sans].list_I = &FreeSansOblique9pt8b;
-  fonts[sans].list_BI = &FreeSansBoldOblique9pt8b;
+  fonts[sans].normal = TXT_FONT(FreeSans9pt);
+  fonts[sans].normal_B = TXT_FONT(FreeSansBold9pt);
+  fonts[sans].normal_I = TXT_FONT(FreeSansOblique9pt);
+  fonts[sans].normal_BI = TXT_FONT(FreeSansBoldOblique9pt);
+
+  fonts[sans].h1 = TXT_FONT(FreeSansBold24pt);
+  fonts[sans].h1_B = TXT_FONT(FreeSansBold24pt);
+  fonts[sans].h1_I = TXT_FONT(FreeSansBoldOblique24pt);
+  fonts[sans].h1_BI = TXT_FONT(FreeSansBoldOblique24pt);
+
+  fonts[sans].h2 = TXT_FONT(FreeSansBold18pt);
+  fonts[sans].h2_B = TXT_FONT(FreeSansBold18pt);
+  fonts[sans].h2_I = TXT_FONT(FreeSansBoldOblique18pt);
+  fonts[sans].h2_BI = TXT_FONT(FreeSansBoldOblique18pt);
+
+  fonts[sans].h3 = TXT_FONT(FreeSansBold12pt);
+  fonts[sans].h3_B = TXT_FONT(FreeSansBold12pt);
+  fonts[sans].h3_I = TXT_FONT(FreeSansBoldOblique12pt);
+  fonts[sans].h3_BI = TXT_FONT(FreeSansBoldOblique12pt);
+
+  fonts[sans].code = TXT_FONT(FreeMono9pt);
+  fonts[sans].code_B = TXT_FONT(FreeMono9pt);
+  fonts[sans].code_I = TXT_FONT(FreeMono9pt);
+  fonts[sans].code_BI = TXT_FONT(FreeMono9pt);
+
+  fonts[sans].quote = TXT_FONT(FreeSans9pt);
+  fonts[sans].quote_B = TXT_FONT(FreeSansBold9pt);
+  fonts[sans].quote_I = TXT_FONT(FreeSansOblique9pt);
+  fonts[sans].quote_BI = TXT_FONT(FreeSansBoldOblique9pt);
+
+  fonts[sans].list = TXT_FONT(FreeSans9pt);
+  fonts[sans].list_B = TXT_FONT(FreeSansBold9pt);
+  fonts[sans].list_I = TXT_FONT(FreeSansOblique9pt);
+  fonts[sans].list_BI = TXT_FONT(FreeSansBoldOblique9pt);
 }
 
 void TXT_INIT() {
   initFonts();
 
-  loadMarkdownFile(SD().getEditingFile());
-
+  // the widths are measured while loading, in the style they'll be drawn in
   setFontStyle(serif);
+  loadMarkdownFile(SD().getEditingFile());
 
   lineScroll = 0;
   updateScreen = true;
+  fullRefreshRequests++;
   CurrentAppState = TXT;
   CurrentTXTState_NEW = TXT_;
 }
@@ -1792,25 +3296,136 @@ void TXT_INIT_JournalMode() {
 
   String outPath = getCurrentJournal();
   if (!outPath.startsWith("/")) outPath = "/" + outPath;
-  loadMarkdownFile(outPath);
-
+  // the widths are measured while loading, in the style they'll be drawn in
   setFontStyle(serif);
+  loadMarkdownFile(outPath);
 
   lineScroll = 0;
   updateScreen = true;
+  fullRefreshRequests++;
   CurrentAppState = TXT;
   CurrentTXTState_NEW = JOURNAL_MODE;
 }
 
-void einkHandler_TXT_NEW() {
-  if (updateScreen) {
-    updateScreen = false;
-    display.setFullWindow();
-    display.fillScreen(GxEPD_WHITE);
-    displayDocument();
+// ------------------ E-ink ------------------
+String statusBarText() {
+  String file = (CurrentTXTState_NEW == JOURNAL_MODE) ? getCurrentJournal() : SD().getEditingFile();
+  size_t paragraphs = documentLines();
+  return "P:" + String(windowStart + editingLine_index + 1) + "/" + String(paragraphs) + " " + file;
+}
+
+// Lay out the page and hand it to the e-ink task. Returns false while the e-ink task
+// still draws from the buffer we'd write, updateScreen stays set and we retry next loop.
+bool publishFrame() {
+  TxtFrame* frame = txtFrames.beginWrite();
+  if (!frame)
+    return false;
+
+  frame->list.clear();
+  frame->rows.clear();
+  displayDocument(*frame);
+  frame->status = statusBarText();
+  frame->scroll = lineScroll;
+  frame->fullRefresh = fullRefreshRequests;
+  frame->retired = false;
+
+  // Last line that fits, counting the room left below the end of the document
+  const int docBottom = display.height() - STATUS_BAR_HEIGHT;
+  int tallest = 12, used = 0;
+  for (auto& row : frame->rows) {
+    tallest = max(tallest, (int)row.h);
+    if (row.y + row.h <= docBottom) {
+      lastVisibleLine = row.line;
+      used = row.y + row.h;
+    }
+  }
+  if (frame->rows.empty() || frame->rows.back().y + frame->rows.back().h <= docBottom)
+    lastVisibleLine += (docBottom - used) / tallest;
+
+  txtFrames.publish();
+  fontCache.nextFrame();
+
+  // First use of a font reads its pack, report how often that happens and what it costs
+  static uint32_t reportedMisses = 0;
+  const FontCacheStats& fs = fontCache.stats();
+  if (fs.misses != reportedMisses) {
+    reportedMisses = fs.misses;
+    ESP_LOGI(TAG, "Fonts: %u%% hits, %u loads (%u failed), first use %u us avg %u us max, "
+             "%u/%u B, %u evicted", (unsigned)fs.hitPercent(), (unsigned)fs.misses,
+             (unsigned)fs.failures, (unsigned)fs.loadUsAvg(), (unsigned)fs.loadUsMax,
+             (unsigned)fontCache.used(), (unsigned)fontCache.budget(), (unsigned)fs.evictions);
+  }
+  return true;
+}
+
+// What's on the panel, only touched by the e-ink task
+std::vector<ScreenRow> shownRows;
+String shownStatus = "";
+ulong shownScroll = 0;
+uint32_t shownFullRefresh = 0;
+uint32_t shownVersion = 0;
+
+// Send the frame in the display buffer, as partial updates of the rows that changed when the
+// view didn't scroll and the panel hasn't ghosted too much
+void refreshChangedRows(const TxtFrame& frame) {
+  const int docBottom = display.height() - STATUS_BAR_HEIGHT;
+
+  if (frame.fullRefresh != shownFullRefresh || frame.scroll != shownScroll ||
+      !EINK().partialRefreshAllowed()) {
     EINK().refresh();
-    refreshAllLineIndexes();
+    return;
+  }
+
+  // Union of the rows that changed or moved
+  int top = docBottom, bottom = 0;
+  size_t rows = max(frame.rows.size(), shownRows.size());
+  for (size_t i = 0; i < rows; i++) {
+    const ScreenRow* now = (i < frame.rows.size()) ? &frame.rows[i] : nullptr;
+    const ScreenRow* was = (i < shownRows.size()) ? &shownRows[i] : nullptr;
+    if (now && was && now->y == was->y && now->h == was->h && now->sig == was->sig)
+      continue;
+    for (const ScreenRow* row : {now, was}) {
+      if (!row)
+        continue;
+      top = min(top, (int)row->y);
+      bottom = max(bottom, row->y + row->h + ROW_OVERDRAW);
+    }
+  }
+  bottom = min(bottom, docBottom);
+
+  // Most of the page changed, a full refresh looks cleaner for the same time
+  if (bottom - top > docBottom / 2) {
+    EINK().refresh();
+    return;
+  }
+
+  if (top < bottom)
+    EINK().refreshWindow(0, top, display.width(), bottom - top);
+  if (frame.status != shownStatus)
+    EINK().refreshWindow(0, docBottom, display.width(), STATUS_BAR_HEIGHT);
+}
+
+// Draws only from the published frame, typing never waits on the panel
+void einkHandler_TXT_NEW() {
+  if (txtFrames.version() == shownVersion)
+    return;
+
+  const TxtFrame& frame = txtFrames.acquire(&shownVersion);
+  if (frame.retired) {
+    txtFrames.release();
+    return;
   }
+  display.setFullWindow();
+  display.fillScreen(GxEPD_WHITE);
+  frame.list.replay(display);
+  EINK().drawStatusBar(frame.status);
+
+  refreshChangedRows(frame);
+  shownRows = frame.rows;
+  shownStatus = frame.status;
+  shownScroll = frame.scroll;
+  shownFullRefresh = frame.fullRefresh;
+  txtFrames.release();
 }
 
 void processKB_TXT_NEW() {
@@ -1819,170 +3434,177 @@ void processKB_TXT_NEW() {
   String outPath = "";
   char inchar;
 
-  unsigned long currentMillis = millis();
 
   switch (CurrentTXTState_NEW) {
     case TXT_:
       inchar = KB().updateKeypress();
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {
-        // update scroll
-        if (TOUCH().updateScroll(getTotalDisplayLines(), lineScroll)) {
-          updateScreen = true;
-        }
-        switch (currentEditMode) {
-          case edit_append:
-            editAppend(inchar);
-            break;
-          case edit_inline:
-
-            break;
+      // update scroll
+      if (TOUCH().updateScroll(getTotalDisplayLines(), lineScroll)) {
+        updateScreen = true;
+        pageWindow();
+        // Scrolling carries the inline cursor along
+        if (currentEditMode == edit_inline) {
+          cursorToLine(lineScroll);
+          updateCaret();
         }
       }
+      editDocument(inchar);
       break;
     case JOURNAL_MODE: // Stripped down version of TXT_ for journal
       inchar = KB().updateKeypress();
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {
-        // update scroll
-        if (TOUCH().updateScroll(getTotalDisplayLines(), lineScroll)) {
-          updateScreen = true;
-        }
-        switch (currentEditMode) {
-          case edit_append:
-            editAppend(inchar);
-            break;
-          case edit_inline:
-
-            break;
+      // update scroll
+      if (TOUCH().updateScroll(getTotalDisplayLines(), lineScroll)) {
+        updateScreen = true;
+        pageWindow();
+        // Scrolling carries the inline cursor along
+        if (currentEditMode == edit_inline) {
+          cursorToLine(lineScroll);
+          updateCaret();
         }
       }
+      editDocument(inchar);
       break;
     case SAVE_AS:
       inchar = KB().updateKeypress();
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          if (currentLine != "" && currentLine != "-") {
-            if (!currentLine.startsWith("/notes/")) currentLine = "/notes/" + currentLine;
-            if (!currentLine.endsWith(".txt")) currentLine = currentLine + ".txt";
-            saveMarkdownFile(currentLine);
-            CurrentTXTState_NEW = TXT_;
-          } else {
-            OLED().oledWord("Invalid Name");
-            delay(2000);
-          }
-          
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          // Spaces not allowed in filenames
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        if (currentLine != "" && currentLine != "-") {
+          if (!currentLine.startsWith("/notes/")) currentLine = "/notes/" + currentLine;
+          if (!currentLine.endsWith(".txt")) currentLine = currentLine + ".txt";
+          saveMarkdownFile(currentLine);
           CurrentTXTState_NEW = TXT_;
+        } else {
+          OLED().toast("Invalid Name", 2000);
         }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+        
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        // Spaces not allowed in filenames
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false, "Input Filename");
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        CurrentTXTState_NEW = TXT_;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
       }
+
+      OLED().oledLine(currentLine, false, "Input Filename");
       break;
     case NEW_FILE:
       inchar = KB().updateKeypress();
-      if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {
-        // HANDLE INPUTS
-        //No char recieved
-        if (inchar == 0);   
-        //CR Recieved
-        else if (inchar == 13) {                          
-          if (currentLine != "" && currentLine != "-") {
-            if (!currentLine.startsWith("/notes/")) currentLine = "/notes/" + currentLine;
-            if (!currentLine.endsWith(".txt")) currentLine = currentLine + ".txt";
-            newMarkdownFile(currentLine);
-            CurrentTXTState_NEW = TXT_;
-          } else {
-            OLED().oledWord("Invalid Name");
-            delay(2000);
-          }
-          
-          currentLine = "";
-        }                                      
-        //SHIFT Recieved
-        else if (inchar == 17) {                                  
-          if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(SHIFT);
-        }
-        //FN Recieved
-        else if (inchar == 18) {                                  
-          if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
-          else KB().setKeyboardState(FUNC);
-        }
-        //Space Recieved
-        else if (inchar == 32) {                                  
-          // Spaces not allowed in filenames
-        }
-        //ESC / CLEAR Recieved
-        else if (inchar == 20) {                                  
-          currentLine = "";
-        }
-        //BKSP Recieved
-        else if (inchar == 8) {                  
-          if (currentLine.length() > 0) {
-            currentLine.remove(currentLine.length() - 1);
-          }
-        }
-        // Home recieved
-        else if (inchar == 12) {
+      // HANDLE INPUTS
+      //No char recieved
+      if (inchar == 0);   
+      //CR Recieved
+      else if (inchar == 13) {                          
+        if (currentLine != "" && currentLine != "-") {
+          if (!currentLine.startsWith("/notes/")) currentLine = "/notes/" + currentLine;
+          if (!currentLine.endsWith(".txt")) currentLine = currentLine + ".txt";
+          newMarkdownFile(currentLine);
           CurrentTXTState_NEW = TXT_;
+        } else {
+          OLED().toast("Invalid Name", 2000);
+        }
+        
+        currentLine = "";
+      }                                      
+      //SHIFT Recieved
+      else if (inchar == 17) {                                  
+        if (KB().getKeyboardState() == SHIFT) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(SHIFT);
+      }
+      //FN Recieved
+      else if (inchar == 18) {                                  
+        if (KB().getKeyboardState() == FUNC) KB().setKeyboardState(NORMAL);
+        else KB().setKeyboardState(FUNC);
+      }
+      //Space Recieved
+      else if (inchar == 32) {                                  
+        // Spaces not allowed in filenames
+      }
+      //ESC / CLEAR Recieved
+      else if (inchar == 20) {                                  
+        currentLine = "";
+      }
+      //BKSP Recieved
+      else if (inchar == 8) {                  
+        if (currentLine.length() > 0) {
+          currentLine.remove(currentLine.length() - 1);
         }
-        else {
-          currentLine += inchar;
-          if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
-          else if (KB().getKeyboardState() != NORMAL) {
-            KB().setKeyboardState(NORMAL);
-          }
+      }
+      // Home recieved
+      else if (inchar == 12) {
+        CurrentTXTState_NEW = TXT_;
+      }
+      else {
+        currentLine += inchar;
+        if (inchar >= 48 && inchar <= 57) {}  //Only leave FN on if typing numbers
+        else if (KB().getKeyboardState() != NORMAL) {
+          KB().setKeyboardState(NORMAL);
         }
+      }
+
+      OLED().oledLine(currentLine, false, "Input Name for New File");
+      break;
+    case FONT:
+      inchar = KB().updateKeypress();
+      int newFamily;
+      if (inchar == '1')
+        newFamily = serif;
+      else if (inchar == '2')
+        newFamily = sans;
+      else if (inchar == '3')
+        newFamily = mono;
+      else
+        newFamily = -1;
 
-        currentMillis = millis();
-        //Make sure oled only updates at OLED_MAX_FPS
-        if (currentMillis - OLEDFPSMillis >= (1000/OLED_MAX_FPS)) {
-          OLEDFPSMillis = currentMillis;
-          OLED().oledLine(currentLine, false, "Input Name for New File");
+      // Pick family and reflow the document with it
+      if (newFamily >= 0) {
+        if (newFamily != fontStyle) {
+          setFontStyle((FontFamily)newFamily);
+          reflowDocument();
         }
+        KB().setKeyboardState(NORMAL);
+        CurrentTXTState_NEW = PrevTXTState_NEW;
+        updateScreen = true;
+      }
+      // Home / clear / backspace cancels
+      else if (inchar == 12 || inchar == 20 || inchar == 8) {
+        KB().setKeyboardState(NORMAL);
+        CurrentTXTState_NEW = PrevTXTState_NEW;
       }
+
+      OLED().oledLine("1:Serif 2:Sans 3:Mono", false, "Select Font");
       break;
     case LOAD_FILE:
       outPath = fileWizardMini(false, "/notes");
@@ -2001,12 +3623,16 @@ void processKB_TXT_NEW() {
           CurrentTXTState_NEW = TXT_;
           updateScreen = true;
         } else {
-          OLED().oledWord("Incompatible Filetype!");
-          delay(2000);
+          OLED().toast("Incompatible Filetype!", 2000);
           CurrentTXTState_NEW = TXT_;
         }
       }
       break;
   }
+
+  if (updateScreen && publishFrame())
+    updateScreen = false;
+
+  editLogFlush(false);
 }
 #endif
\ No newline at end of file
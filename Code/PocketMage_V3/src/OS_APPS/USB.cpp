@@ -53,7 +53,7 @@ void USBAppShutdown() {
     } else {
       OLED().oledWord("Insert SD Card and Reboot!");
       delay(5000);
-      u8g2.setPowerSave(1);
+      OLED().setPowerSave(true);
       BZ().playJingle(Jingles::Shutdown);
       esp_deep_sleep_start();
       return;
@@ -197,23 +197,16 @@ void USB_INIT() {
 }
 
 void processKB_USB() {
-  int currentMillis = millis();
-  //Make sure oled only updates at 10FPS
-  if (currentMillis - OLEDFPSMillis >= (1000/10 /*OLED_MAX_FPS*/)) {
-    OLEDFPSMillis = currentMillis;
-    OLED().oledLine(currentLine, false);
-  }
+  OLED().oledLine(currentLine, false);
   
-  if (currentMillis - KBBounceMillis >= KB_COOLDOWN) {  
-    char inchar = KB().updateKeypress();
-    // HANDLE INPUTS
-    //No char recieved
-    if (inchar == 0);   
-    // Home recieved
-    else if (inchar == 12 || inchar == 8 || inchar == 19 || inchar == 28|| inchar == 12) {
-      USBAppShutdown();
-      HOME_INIT();
-    }
+  char inchar = KB().updateKeypress();
+  // HANDLE INPUTS
+  //No char recieved
+  if (inchar == 0);   
+  // Home recieved
+  else if (inchar == 12 || inchar == 8 || inchar == 19 || inchar == 28|| inchar == 12) {
+    USBAppShutdown();
+    HOME_INIT();
   }
 }
 
@@ -72,10 +72,11 @@ void processKB() {
     static int x = 0;
     ESP_LOGD(TAG, "OTA APP MODE - PROGRESS: %d\n", x);
     // Draw a progress bar across the screen and then return to PocketMage OS
-    u8g2.clearBuffer();
+    OLED().beginFrame();
     u8g2.drawBox(0,0,x,u8g2.getDisplayHeight());
     
     x+=5;
+    KB().wakeIn(INPUT_POLL_MS);
     
     if (x > u8g2.getDisplayWidth()) {
       // Return to pocketMage OS
@@ -88,7 +89,7 @@ void processKB() {
       // pocketmage::deepSleep();
     }
 
-    u8g2.sendBuffer();
+    OLED().commit();
     delay(10);
     #if OTA_APP
     processKB_APP(); // OTA_APP: entry point
@@ -152,7 +153,9 @@ void setup() {
 
 // Keyboard / OLED Loop
 void loop() {
-  static int i = 0;
+  // Sleep until a key, touch or the power button, or until a pass is due (see inputEvents.h)
+  KB().waitInput();
+
   #if !OTA_APP // POCKETMAGE_OS
     if (!noTimeout)  checkTimeout();
     if (DEBUG_VERBOSE) printDebug();
@@ -162,9 +165,10 @@ void loop() {
 
   updateBattState();
   processKB();
+  // Apps flag a new e-ink screen from processKB(), the e-ink task draws it
+  EINK().wake();
 
   // Yield to watchdog
-  vTaskDelay(50 / portTICK_PERIOD_MS);
   yield();
 }
 
@@ -173,8 +177,10 @@ void einkHandler(void* parameter) {
   vTaskDelay(pdMS_TO_TICKS(250)); 
   for (;;) {
     applicationEinkHandler();
+    EINK().serviceRefresh();
 
-    vTaskDelay(pdMS_TO_TICKS(50));
+    // Sleep until the input loop, a refresh request or the refresh task has work for it
+    EINK().waitWork();
     yield();
   }
 }
\ No newline at end of file
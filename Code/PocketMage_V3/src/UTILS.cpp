@@ -37,8 +37,7 @@ void checkTimeout() {
             while ((j - i) <= 4000) {  // 4 sec
                 j = millis();
                 if (digitalRead(KB_IRQ) == 0) {
-                OLED().oledWord("Good Save!");
-                delay(500);
+                OLED().toast("Good Save!", 500);
                 CLOCK().setPrevTimeMillis(millis());
                 keypad.flush();
                 return;
@@ -217,6 +216,11 @@ void loadState(bool changeState) {
 
     u8g2.setContrast(OLED_BRIGHTNESS);
 
+    #if !OTA_APP // POCKETMAGE_OS
+    // Edits from before the last sleep go into their note before anything opens it
+    recoverEditLog();
+    #endif
+
     // OTA_APP: remove if statement
     // Update State (if needed)
     #if !OTA_APP // POCKETMAGE_OS
@@ -368,11 +372,13 @@ void updateBattState() {
 void saveEditingFile() {
 
     if (!OTA_APP){
-        OLED().oledWord("Saving Work");
         //pocketmage::file::saveFile();
         String savePath = SD().getEditingFile();
         if (savePath != "" && savePath != "-" && savePath != "/temp.txt" && fileLoaded) {
             if (!savePath.startsWith("/")) savePath = "/" + savePath;
+            // Edits are in the edit log already, the next boot writes them into the note
+            if (syncEditLog(savePath)) return;
+            OLED().oledWord("Saving Work");
             ESP_LOGE(TAG, "Saving MarkdownFile");
             saveMarkdownFile(SD().getEditingFile());
             ESP_LOGE(TAG, "Done saving MarkdownFile");
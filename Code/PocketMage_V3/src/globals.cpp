@@ -4,8 +4,6 @@
 
 // ===================== SYSTEM STATE =====================
 Preferences prefs;                       // NVS preferences // note add power button logic in app + prefs to immediate sleep 
-int OLEDFPSMillis = 0;                   // Last OLED FPS update time
-int KBBounceMillis = 0;                  // Last keyboard debounce time
 volatile bool newState = false;          // App state changed
 volatile bool disableTimeout = OTA_APP ? true: false;    // Disable timeout globally, OTA_APP: disable timeout by default
 bool fileLoaded = false;    
@@ -0,0 +1,4 @@
+#pragma once
+// GFXfont and friends, the drawing is in GxEPD2_BW.h, see Arduino.h
+#include <Arduino.h>
+#include <textMetrics.h>
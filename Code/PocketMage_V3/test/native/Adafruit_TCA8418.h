@@ -0,0 +1,17 @@
+#pragma once
+// Keypad controller with no keys pressed, see Arduino.h
+#include <Arduino.h>
+#include <Wire.h>
+
+class Adafruit_TCA8418 {
+public:
+  bool    begin(uint8_t = 0x34, TwoWire* = &Wire) { return true; }
+  bool    matrix(uint8_t, uint8_t) { return true; }
+  void    flush() {}
+  uint8_t available() { return 0; }
+  uint8_t getEvent() { return 0; }
+  void    enableInterrupts() {}
+  void    disableInterrupts() {}
+  void    enableDebounce() {}
+  void    disableDebounce() {}
+};
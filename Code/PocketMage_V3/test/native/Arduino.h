@@ -0,0 +1,115 @@
+#pragma once
+// ===================== NATIVE ARDUINO =====================
+/*
+Native shims:
+@Description
+  Stand-ins for the Arduino-ESP32 core and the libraries PocketMage uses, so the app
+  and library sources build on a PC for the [env:native] tests. Only what those sources
+  call is here, header-only so a suite just includes the sources it tests.
+
+  Drawing goes to a MonoCanvas (GxEPD2_BW.h), files to a folder on the PC (SD_MMC.h),
+  time is a clock the test moves (nativeAdvance()), FreeRTOS tasks are never started
+  and a semaphore that would block forever aborts instead.
+
+  Usage:
+    // platformio.ini [env:native] puts test/native first on the include path
+    #include "../../lib/PocketMage/src/pocketmage_eink.cpp"
+    nativeSdMount(testing::TempDir() + "sd");
+    EINK().drawStatusBar("hello");
+    display.writePBM("screen.pbm");
+*/
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <pgmspace.h>
+#include <esp32-hal-log.h>
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <WString.h>
+#include <Print.h>
+
+using std::max;
+using std::min;
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define IRAM_ATTR
+#define F(s) (s)
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+inline bool isDigit(int c) { return isdigit(c); }
+inline bool isAlpha(int c) { return isalpha(c); }
+inline bool isAlphaNumeric(int c) { return isalnum(c); }
+inline bool isSpace(int c) { return isspace(c); }
+inline bool isWhitespace(int c) { return c == ' ' || c == '\t'; }
+inline bool isUpperCase(int c) { return isupper(c); }
+inline bool isLowerCase(int c) { return islower(c); }
+inline bool isPunct(int c) { return ispunct(c); }
+inline bool isPrintable(int c) { return isprint(c); }
+
+// ---- time, nativeAdvance() is in freertos/FreeRTOS.h ----
+inline unsigned long millis() { return (unsigned long)(nativeClockUs / 1000); }
+inline unsigned long micros() { return (unsigned long)nativeClockUs; }
+inline void delay(unsigned long ms) { nativeAdvance(ms); }
+inline void delayMicroseconds(unsigned int us) { nativeClockUs += us; }
+
+// ---- pins, nothing is wired up ----
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int  digitalRead(uint8_t) { return LOW; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+inline int  digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void detachInterrupt(int) {}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+inline long random(long howBig) { return howBig > 0 ? rand() % howBig : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+inline uint32_t nativeCpuMhz = 240;
+inline bool     setCpuFrequencyMhz(uint32_t mhz) { nativeCpuMhz = mhz; return true; }
+inline uint32_t getCpuFrequencyMhz() { return nativeCpuMhz; }
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  int  available() { return 0; }
+  int  read() { return -1; }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* s, size_t n) override { return fwrite(s, 1, n, stdout); }
+  operator bool() const { return true; }
+};
+inline HardwareSerial Serial;
+
+class EspClass {
+public:
+  void     restart() { abort(); }
+  uint32_t getFreeHeap() { return 320 * 1024; }
+  uint32_t getHeapSize() { return 320 * 1024; }
+};
+inline EspClass ESP;
@@ -0,0 +1,156 @@
+#pragma once
+// Arduino-ESP32 file system on a folder of the PC, see Arduino.h
+#include <Arduino.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+inline std::string nativeSdRoot = ".";
+// SD card paths ("/sys/events.txt") are read from dir from now on
+inline void nativeSdMount(const std::string& dir) { nativeSdRoot = dir; }
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+  File() {}
+
+  operator bool() const { return impl_ && (impl_->fp || impl_->dir); }
+  const char* path() const { return impl_ ? impl_->path.c_str() : ""; }
+  const char* name() const {
+    const char* p = path();
+    const char* slash = strrchr(p, '/');
+    return slash ? slash + 1 : p;
+  }
+  bool isDirectory() const { return impl_ && impl_->dir; }
+  size_t size() const {
+    if (!impl_ || !impl_->fp) return 0;
+    fflush(impl_->fp);
+    struct stat st;
+    return fstat(fileno(impl_->fp), &st) == 0 ? (size_t)st.st_size : 0;
+  }
+  size_t position() const { return impl_ && impl_->fp ? (size_t)ftell(impl_->fp) : 0; }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+    static const int whence[] = {SEEK_SET, SEEK_CUR, SEEK_END};
+    return impl_ && impl_->fp && fseek(impl_->fp, (long)pos, whence[mode]) == 0;
+  }
+  time_t getLastWrite() {
+    struct stat st;
+    return impl_ && stat(impl_->host.c_str(), &st) == 0 ? st.st_mtime : 0;
+  }
+
+  int available() override {
+    return impl_ && impl_->fp ? (int)(size() - position()) : 0;
+  }
+  int read() override {
+    if (!impl_ || !impl_->fp) return -1;
+    const int c = fgetc(impl_->fp);
+    return c == EOF ? -1 : c;
+  }
+  size_t read(uint8_t* buf, size_t n) {
+    return impl_ && impl_->fp ? fread(buf, 1, n, impl_->fp) : 0;
+  }
+  int peek() override {
+    const int c = read();
+    if (c >= 0) ungetc(c, impl_->fp);
+    return c;
+  }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* s, size_t n) override {
+    return impl_ && impl_->fp ? fwrite(s, 1, n, impl_->fp) : 0;
+  }
+  using Print::write;
+  void flush() override { if (impl_ && impl_->fp) fflush(impl_->fp); }
+  void close() { impl_.reset(); }
+
+  File openNextFile(const char* mode = FILE_READ) {
+    if (!impl_ || !impl_->dir) return File();
+    while (impl_->next < impl_->entries.size()) {
+      const std::string& e = impl_->entries[impl_->next++];
+      File f = open(impl_->path == "/" ? "/" + e : impl_->path + "/" + e, mode);
+      if (f) return f;
+    }
+    return File();
+  }
+
+  // Host side, use FS::open()
+  static File open(const std::string& path, const char* mode) {
+    auto impl = std::make_shared<Impl>();
+    impl->path = path;
+    impl->host = nativeSdRoot + path;
+    struct stat st;
+    if (stat(impl->host.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+      DIR* d = opendir(impl->host.c_str());
+      if (!d) return File();
+      while (dirent* e = readdir(d))
+        if (strcmp(e->d_name, ".") && strcmp(e->d_name, "..")) impl->entries.push_back(e->d_name);
+      closedir(d);
+      std::sort(impl->entries.begin(), impl->entries.end());
+      impl->dir = true;
+    } else {
+      // "r" on the SD card still allows writes
+      impl->fp = fopen(impl->host.c_str(), strcmp(mode, FILE_READ) ? mode : "rb+");
+      if (!impl->fp && !strcmp(mode, FILE_READ)) impl->fp = fopen(impl->host.c_str(), "rb");
+      if (!impl->fp) return File();
+    }
+    File f;
+    f.impl_ = impl;
+    return f;
+  }
+
+private:
+  struct Impl {
+    FILE*                    fp = nullptr;
+    bool                     dir = false;
+    std::string              path, host;
+    std::vector<std::string> entries;
+    size_t                   next = 0;
+    ~Impl() { if (fp) fclose(fp); }
+  };
+  std::shared_ptr<Impl> impl_;
+};
+
+class FS {
+public:
+  virtual ~FS() {}
+  File open(const char* path, const char* mode = FILE_READ, bool = false) {
+    return File::open(path, mode);
+  }
+  File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char* path) {
+    struct stat st;
+    return stat(host(path).c_str(), &st) == 0;
+  }
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path) { return ::unlink(host(path).c_str()) == 0; }
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to) {
+    return ::rename(host(from).c_str(), host(to).c_str()) == 0;
+  }
+  bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char* path) { return ::mkdir(host(path).c_str(), 0755) == 0; }
+  bool mkdir(const String& path) { return mkdir(path.c_str()); }
+  bool rmdir(const char* path) { return ::rmdir(host(path).c_str()) == 0; }
+  bool rmdir(const String& path) { return rmdir(path.c_str()); }
+
+private:
+  static std::string host(const char* path) { return nativeSdRoot + path; }
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
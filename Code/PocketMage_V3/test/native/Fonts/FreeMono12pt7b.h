@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree and this face has no 8-bit copy, the bold one stands in
+#include <Adafruit_GFX.h>
+namespace native_FreeMono12pt7b {
+#include <Fonts/FreeMonoBold12pt8b.h>
+}
+static const GFXfont FreeMono12pt7b = {
+  native_FreeMono12pt7b::FreeMonoBold12pt8b.bitmap, native_FreeMono12pt7b::FreeMonoBold12pt8b.glyph, 0x20, 0x7E, native_FreeMono12pt7b::FreeMonoBold12pt8b.yAdvance};
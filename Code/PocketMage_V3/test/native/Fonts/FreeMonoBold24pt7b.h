@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeMonoBold24pt7b {
+#include <Fonts/FreeMonoBold24pt8b.h>
+}
+static const GFXfont FreeMonoBold24pt7b = {
+  native_FreeMonoBold24pt7b::FreeMonoBold24pt8b.bitmap, native_FreeMonoBold24pt7b::FreeMonoBold24pt8b.glyph, 0x20, 0x7E, native_FreeMonoBold24pt7b::FreeMonoBold24pt8b.yAdvance};
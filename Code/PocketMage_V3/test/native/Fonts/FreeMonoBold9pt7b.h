@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeMonoBold9pt7b {
+#include <Fonts/FreeMonoBold9pt8b.h>
+}
+static const GFXfont FreeMonoBold9pt7b = {
+  native_FreeMonoBold9pt7b::FreeMonoBold9pt8b.bitmap, native_FreeMonoBold9pt7b::FreeMonoBold9pt8b.glyph, 0x20, 0x7E, native_FreeMonoBold9pt7b::FreeMonoBold9pt8b.yAdvance};
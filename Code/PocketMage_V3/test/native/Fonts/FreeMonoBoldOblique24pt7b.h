@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeMonoBoldOblique24pt7b {
+#include <Fonts/FreeMonoBoldOblique24pt8b.h>
+}
+static const GFXfont FreeMonoBoldOblique24pt7b = {
+  native_FreeMonoBoldOblique24pt7b::FreeMonoBoldOblique24pt8b.bitmap, native_FreeMonoBoldOblique24pt7b::FreeMonoBoldOblique24pt8b.glyph, 0x20, 0x7E, native_FreeMonoBoldOblique24pt7b::FreeMonoBoldOblique24pt8b.yAdvance};
@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree and this face has no 8-bit copy, the bold one stands in
+#include <Adafruit_GFX.h>
+namespace native_FreeSans12pt7b {
+#include <Fonts/FreeSansBold12pt8b.h>
+}
+static const GFXfont FreeSans12pt7b = {
+  native_FreeSans12pt7b::FreeSansBold12pt8b.bitmap, native_FreeSans12pt7b::FreeSansBold12pt8b.glyph, 0x20, 0x7E, native_FreeSans12pt7b::FreeSansBold12pt8b.yAdvance};
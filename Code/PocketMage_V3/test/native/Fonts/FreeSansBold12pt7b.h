@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSansBold12pt7b {
+#include <Fonts/FreeSansBold12pt8b.h>
+}
+static const GFXfont FreeSansBold12pt7b = {
+  native_FreeSansBold12pt7b::FreeSansBold12pt8b.bitmap, native_FreeSansBold12pt7b::FreeSansBold12pt8b.glyph, 0x20, 0x7E, native_FreeSansBold12pt7b::FreeSansBold12pt8b.yAdvance};
@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSansBold18pt7b {
+#include <Fonts/FreeSansBold18pt8b.h>
+}
+static const GFXfont FreeSansBold18pt7b = {
+  native_FreeSansBold18pt7b::FreeSansBold18pt8b.bitmap, native_FreeSansBold18pt7b::FreeSansBold18pt8b.glyph, 0x20, 0x7E, native_FreeSansBold18pt7b::FreeSansBold18pt8b.yAdvance};
@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSansBoldOblique12pt7b {
+#include <Fonts/FreeSansBoldOblique12pt8b.h>
+}
+static const GFXfont FreeSansBoldOblique12pt7b = {
+  native_FreeSansBoldOblique12pt7b::FreeSansBoldOblique12pt8b.bitmap, native_FreeSansBoldOblique12pt7b::FreeSansBoldOblique12pt8b.glyph, 0x20, 0x7E, native_FreeSansBoldOblique12pt7b::FreeSansBoldOblique12pt8b.yAdvance};
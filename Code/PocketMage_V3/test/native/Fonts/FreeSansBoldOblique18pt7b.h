@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSansBoldOblique18pt7b {
+#include <Fonts/FreeSansBoldOblique18pt8b.h>
+}
+static const GFXfont FreeSansBoldOblique18pt7b = {
+  native_FreeSansBoldOblique18pt7b::FreeSansBoldOblique18pt8b.bitmap, native_FreeSansBoldOblique18pt7b::FreeSansBoldOblique18pt8b.glyph, 0x20, 0x7E, native_FreeSansBoldOblique18pt7b::FreeSansBoldOblique18pt8b.yAdvance};
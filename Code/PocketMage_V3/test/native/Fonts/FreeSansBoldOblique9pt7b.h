@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSansBoldOblique9pt7b {
+#include <Fonts/FreeSansBoldOblique9pt8b.h>
+}
+static const GFXfont FreeSansBoldOblique9pt7b = {
+  native_FreeSansBoldOblique9pt7b::FreeSansBoldOblique9pt8b.bitmap, native_FreeSansBoldOblique9pt7b::FreeSansBoldOblique9pt8b.glyph, 0x20, 0x7E, native_FreeSansBoldOblique9pt7b::FreeSansBoldOblique9pt8b.yAdvance};
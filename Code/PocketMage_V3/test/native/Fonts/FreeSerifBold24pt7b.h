@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSerifBold24pt7b {
+#include <Fonts/FreeSerifBold24pt8b.h>
+}
+static const GFXfont FreeSerifBold24pt7b = {
+  native_FreeSerifBold24pt7b::FreeSerifBold24pt8b.bitmap, native_FreeSerifBold24pt7b::FreeSerifBold24pt8b.glyph, 0x20, 0x7E, native_FreeSerifBold24pt7b::FreeSerifBold24pt8b.yAdvance};
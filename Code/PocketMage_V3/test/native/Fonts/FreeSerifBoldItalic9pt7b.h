@@ -0,0 +1,8 @@
+#pragma once
+// Adafruit GFX isn't in the tree, the first 95 glyphs of the 8-bit face stand in
+#include <Adafruit_GFX.h>
+namespace native_FreeSerifBoldItalic9pt7b {
+#include <Fonts/FreeSerifBoldItalic9pt8b.h>
+}
+static const GFXfont FreeSerifBoldItalic9pt7b = {
+  native_FreeSerifBoldItalic9pt7b::FreeSerifBoldItalic9pt8b.bitmap, native_FreeSerifBoldItalic9pt7b::FreeSerifBoldItalic9pt8b.glyph, 0x20, 0x7E, native_FreeSerifBoldItalic9pt7b::FreeSerifBoldItalic9pt8b.yAdvance};
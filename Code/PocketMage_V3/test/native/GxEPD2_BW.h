@@ -0,0 +1,124 @@
+#pragma once
+// GxEPD2 display drawing into a MonoCanvas, see Arduino.h
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+#include <monoCanvas.h>
+
+// The PocketMage panel. What is written to it lands in screen, a canvas in screen
+// coordinates that refresh() pushes, so screen holds what the panel shows and its
+// refreshes() what was sent. Only the landscape rotations (1, 3) fit the canvas
+class GxEPD2_310_GDEQ031T10 {
+public:
+  static const uint16_t WIDTH  = 240;
+  static const uint16_t HEIGHT = 320;
+  static const bool     hasFastPartialUpdate = true;
+  static volatile bool  useFastFullUpdate;
+
+  GxEPD2_310_GDEQ031T10(int16_t, int16_t, int16_t, int16_t) {}
+
+  void writeImage(const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                  bool invert = false, bool = false, bool = false) {
+    writeImagePart(bitmap, 0, 0, w, h, x, y, w, h, invert);
+  }
+  void writeImageForFullRefresh(const uint8_t* bitmap, int16_t x, int16_t y, int16_t w,
+                                int16_t h, bool invert = false, bool = false, bool = false) {
+    writeImage(bitmap, x, y, w, h, invert);
+  }
+  void writeImageAgain(const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                       bool invert = false, bool = false, bool = false) {
+    writeImage(bitmap, x, y, w, h, invert);
+  }
+  // Bitmap rows are (wBitmap + 7) / 8 bytes, 1 = white unless invert
+  void writeImagePart(const uint8_t* bitmap, int16_t xPart, int16_t yPart, int16_t wBitmap,
+                      int16_t, int16_t x, int16_t y, int16_t w, int16_t h,
+                      bool invert = false, bool = false, bool = false) {
+    const int16_t rowBytes = (wBitmap + 7) / 8;
+    for (int16_t j = 0; j < h; j++) {
+      for (int16_t i = 0; i < w; i++) {
+        const int16_t bx = xPart + i, by = yPart + j;
+        const bool set = bitmap[by * rowBytes + bx / 8] & (0x80 >> (bx & 7));
+        int16_t sx = x + i, sy = y + j, sw = 1, sh = 1;
+        toScreen(sx, sy, sw, sh);
+        screen.drawPixel(sx, sy, set == invert ? GxEPD_BLACK : GxEPD_WHITE);
+      }
+    }
+  }
+  void writeImagePartAgain(const uint8_t* bitmap, int16_t xPart, int16_t yPart,
+                           int16_t wBitmap, int16_t hBitmap, int16_t x, int16_t y, int16_t w,
+                           int16_t h, bool invert = false, bool = false, bool = false) {
+    writeImagePart(bitmap, xPart, yPart, wBitmap, hBitmap, x, y, w, h, invert);
+  }
+
+  void refresh(bool partialUpdateMode = false) { screen.display(partialUpdateMode); }
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    toScreen(x, y, w, h);
+    screen.displayWindow(x, y, w, h);
+  }
+  void powerOff() {}
+  void hibernate() {}
+  void setBusyCallback(void (*)(const void*), const void* = nullptr) {}
+
+  uint8_t    rotation = 3;  // follows the display's setRotation()
+  MonoCanvas screen;
+
+private:
+  void toScreen(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+    int16_t t;
+    if (rotation == 1) { t = y; y = WIDTH - x - w; x = t; }
+    else               { t = x; x = HEIGHT - y - h; y = t; }
+    t = w; w = h; h = t;
+  }
+};
+
+// Adafruit_GFX prints through Print, the canvas does the drawing
+template<typename PanelT, uint16_t PAGE_HEIGHT>
+class GxEPD2_BW : public MonoCanvas, public Print {
+public:
+  explicit GxEPD2_BW(PanelT panel) : epd2(panel) {}
+
+  void setRotation(uint8_t r) override {
+    MonoCanvas::setRotation(r);
+    epd2.rotation = getRotation();
+  }
+
+  size_t write(uint8_t c) override { return MonoCanvas::write(c); }
+  size_t write(const uint8_t* s, size_t n) override { return MonoCanvas::write(s, n); }
+  using Print::write;
+  using Print::print;
+  using Print::println;
+  using Print::printf;
+
+  // Sending the buffer goes to the panel too, the way GxEPD2_BW writes it through epd2
+  void display(bool partialUpdateMode = false) {
+    MonoCanvas::display(partialUpdateMode);
+    toPanel();
+  }
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    MonoCanvas::displayWindow(x, y, w, h);
+    toPanel();
+  }
+  bool nextPage() {
+    MonoCanvas::nextPage();
+    toPanel();
+    return false;
+  }
+
+  using MonoCanvas::getTextBounds;
+  void getTextBounds(const String& s, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+                     uint16_t* w, uint16_t* h) const {
+    MonoCanvas::getTextBounds(s.c_str(), x, y, x1, y1, w, h);
+  }
+
+  PanelT epd2;
+
+private:
+  void toPanel() {
+    const CanvasRefresh& r = refreshes().back();
+    for (int16_t y = r.y; y < r.y + r.h; y++)
+      for (int16_t x = r.x; x < r.x + r.w; x++)
+        epd2.screen.drawPixel(x, y, pixel(x, y) ? GxEPD_BLACK : GxEPD_WHITE);
+    if (r.full) epd2.screen.display(false);
+    else        epd2.screen.displayWindow(r.x, r.y, r.w, r.h);
+  }
+};
@@ -0,0 +1,29 @@
+#pragma once
+// NVS preferences kept in memory for the run, see Arduino.h
+#include <Arduino.h>
+#include <map>
+
+class Preferences {
+public:
+  bool   begin(const char* ns, bool = false) { ns_ = ns; return true; }
+  void   end() {}
+  bool   clear() { store_.erase(ns_); return true; }
+  bool   remove(const char* key) { return store_[ns_].erase(key) > 0; }
+  bool   isKey(const char* key) { return store_[ns_].count(key) > 0; }
+
+  size_t putInt(const char* key, int32_t v) { return put(key, std::to_string(v)); }
+  size_t putUInt(const char* key, uint32_t v) { return put(key, std::to_string(v)); }
+  size_t putBool(const char* key, bool v) { return put(key, v ? "1" : "0"); }
+  size_t putString(const char* key, const String& v) { return put(key, v.c_str()); }
+  int32_t  getInt(const char* key, int32_t def = 0) { return isKey(key) ? atol(get(key)) : def; }
+  uint32_t getUInt(const char* key, uint32_t def = 0) { return isKey(key) ? strtoul(get(key), 0, 10) : def; }
+  bool     getBool(const char* key, bool def = false) { return isKey(key) ? atoi(get(key)) : def; }
+  String   getString(const char* key, const String& def = String()) { return isKey(key) ? String(get(key)) : def; }
+
+private:
+  size_t put(const char* key, const std::string& v) { store_[ns_][key] = v; return v.size() + 1; }
+  const char* get(const char* key) { return store_[ns_][key].c_str(); }
+
+  std::string ns_;
+  std::map<std::string, std::map<std::string, std::string>> store_;
+};
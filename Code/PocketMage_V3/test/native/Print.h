@@ -0,0 +1,76 @@
+#pragma once
+// Arduino Print, see Arduino.h
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <WString.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* s, size_t n) {
+    size_t done = 0;
+    while (n--) done += write(*s++);
+    return done;
+  }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+
+  size_t println() { return write("\r\n"); }
+  template<class T> size_t println(const T& v) { return print(v) + println(); }
+  template<class T> size_t println(const T& v, int f) { return print(v, f) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+  }
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(uint8_t* buf, size_t n) {
+    size_t got = 0;
+    int c;
+    while (got < n && (c = read()) >= 0) buf[got++] = (uint8_t)c;
+    return got;
+  }
+  size_t readBytes(char* buf, size_t n) { return readBytes((uint8_t*)buf, n); }
+  String readStringUntil(char end) {
+    String s;
+    int c;
+    while ((c = read()) >= 0 && c != end) s += (char)c;
+    return s;
+  }
+  String readString() {
+    String s;
+    int c;
+    while ((c = read()) >= 0) s += (char)c;
+    return s;
+  }
+};
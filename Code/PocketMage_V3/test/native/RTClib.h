@@ -0,0 +1,99 @@
+#pragma once
+// RTClib dates and a PCF8563 that keeps the time it was set to, see Arduino.h
+#include <Arduino.h>
+
+class TimeSpan {
+public:
+  TimeSpan(int32_t seconds = 0) : s_(seconds) {}
+  TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
+      : s_((int32_t)days * 86400L + (int32_t)hours * 3600 + (int32_t)minutes * 60 + seconds) {}
+  int16_t days() const { return s_ / 86400L; }
+  int8_t  hours() const { return s_ / 3600 % 24; }
+  int8_t  minutes() const { return s_ / 60 % 60; }
+  int8_t  seconds() const { return s_ % 60; }
+  int32_t totalseconds() const { return s_; }
+  TimeSpan operator+(const TimeSpan& o) const { return TimeSpan(s_ + o.s_); }
+  TimeSpan operator-(const TimeSpan& o) const { return TimeSpan(s_ - o.s_); }
+
+private:
+  int32_t s_;
+};
+
+class DateTime {
+public:
+  DateTime(uint32_t t = 946684800UL) { set(t); }
+  DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0,
+           uint8_t sec = 0) {
+    set(daysFromCivil(year, month, day) * 86400L + hour * 3600L + min * 60L + sec);
+  }
+  // __DATE__ ("Oct 16 2026") and __TIME__ ("12:34:56")
+  DateTime(const char* date, const char* time) {
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    const int m = (int)(strstr(months, String(date).substring(0, 3).c_str()) - months) / 3 + 1;
+    set(daysFromCivil(atoi(date + 7), m, atoi(date + 4)) * 86400L + atoi(time) * 3600L +
+        atoi(time + 3) * 60L + atoi(time + 6));
+  }
+
+  uint16_t year() const { return y_; }
+  uint8_t  month() const { return m_; }
+  uint8_t  day() const { return d_; }
+  uint8_t  hour() const { return unix_ / 3600 % 24; }
+  uint8_t  minute() const { return unix_ / 60 % 60; }
+  uint8_t  second() const { return unix_ % 60; }
+  uint8_t  dayOfTheWeek() const { return (unix_ / 86400L + 4) % 7; }  // 0: Sunday
+  uint32_t unixtime() const { return unix_; }
+
+  DateTime operator+(const TimeSpan& s) const { return DateTime(unix_ + s.totalseconds()); }
+  DateTime operator-(const TimeSpan& s) const { return DateTime(unix_ - s.totalseconds()); }
+  TimeSpan operator-(const DateTime& o) const { return TimeSpan((int32_t)(unix_ - o.unix_)); }
+  bool operator<(const DateTime& o) const { return unix_ < o.unix_; }
+  bool operator>(const DateTime& o) const { return unix_ > o.unix_; }
+  bool operator==(const DateTime& o) const { return unix_ == o.unix_; }
+  bool operator!=(const DateTime& o) const { return unix_ != o.unix_; }
+
+private:
+  // Howard Hinnant's civil calendar conversions
+  static long daysFromCivil(long y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const long era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned)(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long)doe - 719468;
+  }
+  void set(uint32_t t) {
+    unix_ = t;
+    const long z = t / 86400L + 719468;
+    const long era = z / 146097;
+    const unsigned doe = (unsigned)(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d_ = doy - (153 * mp + 2) / 5 + 1;
+    m_ = mp < 10 ? mp + 3 : mp - 9;
+    y_ = yoe + era * 400 + (m_ <= 2);
+  }
+
+  uint32_t unix_;
+  uint16_t y_;
+  uint8_t  m_, d_;
+};
+
+// now() is the time adjust() set plus the native clock since then
+class RTC_PCF8563 {
+public:
+  bool begin(void* = nullptr) { return true; }
+  bool lostPower() { return false; }
+  bool isrunning() { return true; }
+  void start() {}
+  void stop() {}
+  void adjust(const DateTime& dt) {
+    set_ = dt;
+    setAtMs_ = millis();
+  }
+  DateTime now() { return set_ + TimeSpan((int32_t)((millis() - setAtMs_) / 1000)); }
+
+private:
+  DateTime      set_;
+  unsigned long setAtMs_ = 0;
+};
@@ -0,0 +1,19 @@
+#pragma once
+// The SD card is nativeSdRoot, see FS.h
+#include <FS.h>
+
+enum sdcard_type_t { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN };
+
+class SDMMCFS : public fs::FS {
+public:
+  bool setPins(int, int, int, int = -1, int = -1, int = -1) { return true; }
+  bool begin(const char* = "/sdcard", bool = false, bool = false, int = 0, uint8_t = 5) {
+    return true;
+  }
+  void end() {}
+  sdcard_type_t cardType() { return CARD_SDHC; }
+  uint64_t cardSize() { return 16ULL << 30; }
+  uint64_t totalBytes() { return 16ULL << 30; }
+  uint64_t usedBytes() { return 0; }
+};
+inline SDMMCFS SD_MMC;
@@ -0,0 +1,10 @@
+#pragma once
+// SPI bus with nothing on it, see Arduino.h
+#include <Arduino.h>
+
+class SPIClass {
+public:
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void end() {}
+};
+inline SPIClass SPI;
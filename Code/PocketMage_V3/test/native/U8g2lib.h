@@ -0,0 +1,69 @@
+#pragma once
+// U8g2 with a frame buffer nothing reads, see Arduino.h. Fonts are one byte, the
+// advance every glyph gets in getStrWidth()
+#include <Arduino.h>
+
+struct u8g2_cb_t {};
+inline const u8g2_cb_t U8G2_R0_, U8G2_R2_;
+#define U8G2_R0 (&U8G2_R0_)
+#define U8G2_R2 (&U8G2_R2_)
+
+inline const uint8_t u8g2_font_5x7_tf[]     = {5};
+inline const uint8_t u8g2_font_7x13B_tf[]   = {7};
+inline const uint8_t u8g2_font_luBIS18_tf[] = {14};
+inline const uint8_t u8g2_font_luBS18_tf[]  = {14};
+inline const uint8_t u8g2_font_luIS18_tf[]  = {13};
+inline const uint8_t u8g2_font_lubR18_tf[]  = {13};
+inline const uint8_t u8g2_font_ncenB08_tr[] = {6};
+inline const uint8_t u8g2_font_ncenB10_tr[] = {8};
+inline const uint8_t u8g2_font_ncenB12_tr[] = {9};
+inline const uint8_t u8g2_font_ncenB14_tr[] = {11};
+inline const uint8_t u8g2_font_ncenB18_tr[] = {14};
+inline const uint8_t u8g2_font_ncenB24_tr[] = {19};
+
+class U8G2 {
+public:
+  U8G2(uint16_t w = 256, uint16_t h = 32) : w_(w), h_(h), buffer_(w * h / 8, 0) {}
+
+  bool begin() { return true; }
+  void setBusClock(uint32_t) {}
+  void setPowerSave(uint8_t) {}
+  void setContrast(uint8_t) {}
+  void clearBuffer() { std::fill(buffer_.begin(), buffer_.end(), 0); }
+  void sendBuffer() {}
+  void updateDisplayArea(uint8_t, uint8_t, uint8_t, uint8_t) {}
+  uint8_t* getBufferPtr() { return buffer_.data(); }
+  uint8_t  getBufferTileWidth() const { return w_ / 8; }
+  uint8_t  getBufferTileHeight() const { return h_ / 8; }
+  uint16_t getDisplayWidth() const { return w_; }
+  uint16_t getDisplayHeight() const { return h_; }
+  uint16_t getWidth() const { return w_; }
+  uint16_t getHeight() const { return h_; }
+
+  void setFont(const uint8_t* font) { font_ = font; }
+  void setFontMode(uint8_t) {}
+  void setDrawColor(uint8_t) {}
+  void setBitmapMode(uint8_t) {}
+  uint16_t getStrWidth(const char* s) const { return font_ ? strlen(s) * font_[0] : 0; }
+  uint16_t getUTF8Width(const char* s) const { return getStrWidth(s); }
+  uint16_t drawStr(uint16_t, uint16_t, const char* s) { return getStrWidth(s); }
+  void drawPixel(uint16_t, uint16_t) {}
+  void drawHLine(uint16_t, uint16_t, uint16_t) {}
+  void drawVLine(uint16_t, uint16_t, uint16_t) {}
+  void drawLine(uint16_t, uint16_t, uint16_t, uint16_t) {}
+  void drawBox(uint16_t, uint16_t, uint16_t, uint16_t) {}
+  void drawFrame(uint16_t, uint16_t, uint16_t, uint16_t) {}
+  void drawRBox(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t) {}
+  void drawRFrame(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t) {}
+  void drawXBMP(uint16_t, uint16_t, uint16_t, uint16_t, const uint8_t*) {}
+
+private:
+  uint16_t             w_, h_;
+  std::vector<uint8_t> buffer_;
+  const uint8_t*       font_ = nullptr;
+};
+
+class U8G2_SSD1326_ER_256X32_F_4W_HW_SPI : public U8G2 {
+public:
+  U8G2_SSD1326_ER_256X32_F_4W_HW_SPI(const u8g2_cb_t*, uint8_t, uint8_t, uint8_t = 255) {}
+};
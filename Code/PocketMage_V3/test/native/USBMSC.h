@@ -0,0 +1,13 @@
+#pragma once
+// USB mass storage, never started natively, see Arduino.h
+#include <Arduino.h>
+
+class USBMSC {
+public:
+  bool begin(uint32_t, uint16_t) { return false; }
+  void end() {}
+  void vendorID(const char*) {}
+  void productID(const char*) {}
+  void productRevision(const char*) {}
+  void mediaPresent(bool) {}
+};
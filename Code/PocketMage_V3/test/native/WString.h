@@ -0,0 +1,158 @@
+#pragma once
+// Arduino String on top of std::string, see Arduino.h
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+class String {
+public:
+  String(const char* s = "") : s_(s ? s : "") {}
+  String(const char* s, unsigned int n) : s_(s ? std::string(s, n) : std::string()) {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(unsigned char v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(int v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(unsigned int v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(long v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(unsigned long v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(long long v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(unsigned long long v, unsigned char base = 10) : s_(number(v, base)) {}
+  explicit String(float v, unsigned int decimals = 2) : s_(fixed(v, decimals)) {}
+  explicit String(double v, unsigned int decimals = 2) : s_(fixed(v, decimals)) {}
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool         isEmpty() const { return s_.empty(); }
+  const char*  c_str() const { return s_.c_str(); }
+  bool         reserve(unsigned int n) { s_.reserve(n); return true; }
+  char*        begin() { return &s_[0]; }
+  char*        end() { return &s_[0] + s_.size(); }
+  const char*  begin() const { return s_.data(); }
+  const char*  end() const { return s_.data() + s_.size(); }
+
+  char  charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  void  setCharAt(unsigned int i, char c) { if (i < s_.size()) s_[i] = c; }
+  char  operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) {
+    static char dummy;
+    if (i >= s_.size()) { dummy = 0; return dummy; }
+    return s_[i];
+  }
+  void getBytes(unsigned char* buf, unsigned int n, unsigned int index = 0) const {
+    toCharArray((char*)buf, n, index);
+  }
+  void toCharArray(char* buf, unsigned int n, unsigned int index = 0) const {
+    if (!n || !buf) return;
+    size_t len = index < s_.size() ? s_.size() - index : 0;
+    if (len > n - 1) len = n - 1;
+    memcpy(buf, s_.data() + (index < s_.size() ? index : 0), len);
+    buf[len] = 0;
+  }
+
+  // ---- concatenation ----
+  bool concat(const String& o) { s_ += o.s_; return true; }
+  bool concat(const char* o) { if (o) s_ += o; return o != nullptr; }
+  bool concat(const char* o, unsigned int n) { if (o) s_.append(o, n); return o != nullptr; }
+  bool concat(char c) { s_ += c; return true; }
+  bool concat(unsigned char v) { s_ += number(v, 10); return true; }
+  bool concat(int v) { s_ += number(v, 10); return true; }
+  bool concat(unsigned int v) { s_ += number(v, 10); return true; }
+  bool concat(long v) { s_ += number(v, 10); return true; }
+  bool concat(unsigned long v) { s_ += number(v, 10); return true; }
+  bool concat(long long v) { s_ += number(v, 10); return true; }
+  bool concat(unsigned long long v) { s_ += number(v, 10); return true; }
+  bool concat(float v) { s_ += fixed(v, 2); return true; }
+  bool concat(double v) { s_ += fixed(v, 2); return true; }
+  template<class T> String& operator+=(const T& v) { concat(v); return *this; }
+
+  // ---- comparison ----
+  int  compareTo(const String& o) const { return s_.compare(o.s_); }
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool equals(const char* o) const { return s_ == (o ? o : ""); }
+  bool equalsIgnoreCase(const String& o) const {
+    if (s_.size() != o.s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++)
+      if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    return true;
+  }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0 && p.s_.size() <= s_.size(); }
+  bool startsWith(const String& p, unsigned int offset) const {
+    return offset <= s_.size() && s_.size() - offset >= p.s_.size() &&
+           s_.compare(offset, p.s_.size(), p.s_) == 0;
+  }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return equals(o); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !equals(o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+  bool operator>(const String& o) const { return s_ > o.s_; }
+  bool operator<=(const String& o) const { return s_ <= o.s_; }
+  bool operator>=(const String& o) const { return s_ >= o.s_; }
+
+  // ---- search ----
+  int indexOf(char c, unsigned int from = 0) const { return found(s_.find(c, from)); }
+  int indexOf(const String& p, unsigned int from = 0) const { return found(s_.find(p.s_, from)); }
+  int lastIndexOf(char c) const { return found(s_.rfind(c)); }
+  int lastIndexOf(char c, unsigned int from) const { return found(s_.rfind(c, from)); }
+  int lastIndexOf(const String& p) const { return found(s_.rfind(p.s_)); }
+  int lastIndexOf(const String& p, unsigned int from) const { return found(s_.rfind(p.s_, from)); }
+  String substring(unsigned int from) const { return substring(from, length()); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= s_.size()) return String();
+    if (to > s_.size()) to = (unsigned int)s_.size();
+    return s_.substr(from, to - from);
+  }
+
+  // ---- modification ----
+  void replace(char a, char b) { for (char& c : s_) if (c == a) c = b; }
+  void replace(const String& a, const String& b) {
+    if (a.s_.empty()) return;
+    for (size_t at = 0; (at = s_.find(a.s_, at)) != std::string::npos; at += b.s_.size())
+      s_.replace(at, a.s_.size(), b.s_);
+  }
+  void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+  void remove(unsigned int index, unsigned int n) { if (index < s_.size()) s_.erase(index, n); }
+  void toLowerCase() { for (char& c : s_) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : s_) c = (char)toupper((unsigned char)c); }
+  void trim() {
+    size_t a = 0, b = s_.size();
+    while (a < b && isspace((unsigned char)s_[a])) a++;
+    while (b > a && isspace((unsigned char)s_[b - 1])) b--;
+    s_ = s_.substr(a, b - a);
+  }
+
+  // ---- conversion ----
+  long   toInt() const { return atol(s_.c_str()); }
+  float  toFloat() const { return (float)atof(s_.c_str()); }
+  double toDouble() const { return atof(s_.c_str()); }
+
+private:
+  static int found(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+  template<class T> static std::string number(T v, unsigned char base) {
+    if (base == 10) return std::to_string(v);
+    bool neg = v < 0;
+    unsigned long long u = neg ? 0ULL - (unsigned long long)v : (unsigned long long)v;
+    std::string out;
+    do { out.insert(out.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[u % base]); u /= base; } while (u);
+    return neg ? "-" + out : out;
+  }
+  static std::string fixed(double v, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    return buf;
+  }
+
+  std::string s_;
+};
+
+inline String operator+(const String& a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, const char* b) { String s(a); s += b; return s; }
+inline String operator+(const char* a, const String& b) { String s(a); s += b; return s; }
+template<class T> String operator+(const String& a, T b) { String s(a); s += b; return s; }
+inline bool operator==(const char* a, const String& b) { return b == a; }
+inline bool operator!=(const char* a, const String& b) { return b != a; }
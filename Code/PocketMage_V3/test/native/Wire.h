@@ -0,0 +1,16 @@
+#pragma once
+// I2C bus with nothing on it, see Arduino.h
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool    begin(int = -1, int = -1, uint32_t = 0) { return true; }
+  void    setClock(uint32_t) {}
+  void    beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 2; }  // address NACK
+  size_t  write(uint8_t) { return 1; }
+  uint8_t requestFrom(uint8_t, uint8_t, bool = true) { return 0; }
+  int     available() { return 0; }
+  int     read() { return -1; }
+};
+inline TwoWire Wire;
@@ -0,0 +1,8 @@
+#pragma once
+#include <esp_log.h>
+
+#define log_e(format, ...) ESP_LOGE("", format, ##__VA_ARGS__)
+#define log_w(format, ...) ESP_LOGW("", format, ##__VA_ARGS__)
+#define log_i(format, ...) ESP_LOGI("", format, ##__VA_ARGS__)
+#define log_d(format, ...) ESP_LOGD("", format, ##__VA_ARGS__)
+#define log_v(format, ...) ESP_LOGV("", format, ##__VA_ARGS__)
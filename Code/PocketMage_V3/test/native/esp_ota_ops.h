@@ -0,0 +1,6 @@
+#pragma once
+// No OTA natively, see esp_partition.h
+#include <esp_partition.h>
+
+inline esp_err_t esp_ota_set_boot_partition(const esp_partition_t*) { return ESP_FAIL; }
+inline const esp_partition_t* esp_ota_get_running_partition() { return nullptr; }
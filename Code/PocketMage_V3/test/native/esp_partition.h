@@ -0,0 +1,24 @@
+#pragma once
+// No partition table natively, see Arduino.h
+#include <esp_system.h>
+
+typedef enum { ESP_PARTITION_TYPE_APP, ESP_PARTITION_TYPE_DATA } esp_partition_type_t;
+typedef enum {
+  ESP_PARTITION_SUBTYPE_APP_FACTORY,
+  ESP_PARTITION_SUBTYPE_APP_OTA_0,
+  ESP_PARTITION_SUBTYPE_APP_OTA_1,
+  ESP_PARTITION_SUBTYPE_APP_OTA_2,
+  ESP_PARTITION_SUBTYPE_APP_OTA_3,
+} esp_partition_subtype_t;
+typedef struct {
+  esp_partition_type_t    type;
+  esp_partition_subtype_t subtype;
+  uint32_t                address;
+  uint32_t                size;
+  char                    label[17];
+} esp_partition_t;
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t,
+                                                        esp_partition_subtype_t, const char*) {
+  return nullptr;
+}
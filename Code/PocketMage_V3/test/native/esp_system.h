@@ -0,0 +1,15 @@
+#pragma once
+// Restarting ends the run, see Arduino.h
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int esp_err_t;
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+inline void esp_restart() {
+  fprintf(stderr, "esp_restart\n");
+  exit(0);
+}
+inline uint32_t esp_random() { return (uint32_t)rand(); }
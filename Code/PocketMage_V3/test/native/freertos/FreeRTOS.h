@@ -0,0 +1,40 @@
+#pragma once
+// FreeRTOS on one thread: tasks are never started, semaphores keep their counts and a
+// take that would wait forever aborts, see Arduino.h
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdFAIL  0
+#define pdPASS  1
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define portYIELD_FROM_ISR() do {} while (0)
+#define configASSERT(x) do { if (!(x)) abort(); } while (0)
+
+// Time, moved by delays and the test
+inline uint64_t nativeClockUs = 0;
+inline void nativeAdvance(unsigned long ms) { nativeClockUs += (uint64_t)ms * 1000; }
+
+struct NativeSemaphore {
+  int count;
+  int max;
+};
+typedef NativeSemaphore* SemaphoreHandle_t;
+
+struct NativeTask {
+  void (*fn)(void*);
+  void*    param;
+  uint32_t notified;
+};
+typedef NativeTask* TaskHandle_t;
+
+// The test itself is this task
+inline NativeTask nativeMainTask = {nullptr, nullptr, 0};
@@ -0,0 +1,37 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new NativeSemaphore{0, 1}; }
+inline SemaphoreHandle_t xSemaphoreCreateMutex()  { return new NativeSemaphore{1, 1}; }
+inline SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+  return new NativeSemaphore{(int)initial, (int)max};
+}
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  if (s->count > 0) {
+    s->count--;
+    return pdTRUE;
+  }
+  // nothing else runs that could give it
+  if (wait == portMAX_DELAY) {
+    fprintf(stderr, "xSemaphoreTake: would wait forever\n");
+    abort();
+  }
+  nativeAdvance(wait);
+  return pdFALSE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  if (s->count >= s->max) return pdFALSE;
+  s->count++;
+  return pdTRUE;
+}
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+  return xSemaphoreGive(s);
+}
+
+// Only one task runs natively, so it already holds a recursive mutex it takes
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new NativeSemaphore{1 << 30, 1 << 30}; }
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait) { return xSemaphoreTake(s, wait); }
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) { return xSemaphoreGive(s); }
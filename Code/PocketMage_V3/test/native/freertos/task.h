@@ -0,0 +1,36 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define tskIDLE_PRIORITY 0
+
+// Tasks are created but never run, tests call what the task would
+inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* param,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  TaskHandle_t t = new NativeTask{fn, param, 0};
+  if (handle) *handle = t;
+  return pdPASS;
+}
+inline BaseType_t xTaskCreate(void (*fn)(void*), const char* name, uint32_t stack, void* param,
+                              UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, priority, handle, 0);
+}
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return &nativeMainTask; }
+inline void vTaskDelay(TickType_t ticks) { nativeAdvance(ticks); }
+inline void vTaskDelete(TaskHandle_t) {}
+
+inline void xTaskNotifyGive(TaskHandle_t t) { if (t) t->notified++; }
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+  NativeTask& self = nativeMainTask;
+  if (!self.notified) {
+    if (wait == portMAX_DELAY) {
+      fprintf(stderr, "ulTaskNotifyTake: would wait forever\n");
+      abort();
+    }
+    nativeAdvance(wait);
+    return 0;
+  }
+  const uint32_t n = self.notified;
+  self.notified = clear ? 0 : n - 1;
+  return n;
+}
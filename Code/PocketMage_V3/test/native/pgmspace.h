@@ -0,0 +1,15 @@
+#pragma once
+// Flash and RAM are one address space on the PC, see Arduino.h
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr)   (*(void* const*)(addr))
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strcpy_P strcpy
+#define memcpy_P memcpy
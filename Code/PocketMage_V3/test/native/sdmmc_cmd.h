@@ -0,0 +1,2 @@
+#pragma once
+// SD commands aren't used natively, see SD_MMC.h
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include <bitmapStream.h>
+
+static const uint16_t W = 320, H = 240, ROW = W / 8;
+
+// A wallpaper-like image: white with a black frame, some text-ish noise and a black bar
+static std::vector<uint8_t> wallpaper() {
+  std::vector<uint8_t> bits(ROW * H, 0x00);
+  std::mt19937 rng(7);
+  for (int y = 0; y < H; y++) {
+    for (int c = 0; c < ROW; c++) {
+      uint8_t& b = bits[y * ROW + c];
+      if (y < 4 || y >= H - 4) b = 0xFF;
+      if (c == 0) b |= 0xF0;
+      if (c == ROW - 1) b |= 0x0F;
+      if (y >= 100 && y < 140 && c >= 5 && c < 35) b = rng() & 0xFF;
+      if (y >= 200 && y < 220) b = 0xFF;
+    }
+  }
+  return bits;
+}
+
+// Streams a file through in chunks of the given size, as deepSleep() reads it
+static std::vector<uint8_t> decode(const std::vector<uint8_t>& file, size_t chunk,
+                                   bool compressed, int* rows = nullptr) {
+  BitmapStream<40> bmp;
+  size_t at = 0;
+  if (compressed) {
+    EXPECT_TRUE(bmp.begin(file.data(), file.size()));
+    at = RLE_HEADER;
+  } else {
+    EXPECT_TRUE(bmp.beginRaw(W, H));
+  }
+  std::vector<uint8_t> out(ROW * H, 0xAA);
+  int seen = 0;
+  while (!bmp.done() && at < file.size()) {
+    const size_t n = std::min(chunk, file.size() - at);
+    bmp.feed(file.data() + at, n, [&](uint16_t y, const uint8_t* row, uint16_t w) {
+      EXPECT_EQ(y, seen);
+      EXPECT_EQ(w, W);
+      memcpy(&out[y * ROW], row, ROW);
+      seen++;
+    });
+    at += n;
+  }
+  EXPECT_TRUE(bmp.done());
+  if (rows) *rows = seen;
+  return out;
+}
+
+TEST(bitmap_stream, RawRowsComeOutAsRead) {
+  const std::vector<uint8_t> bits = wallpaper();
+  int rows = 0;
+  EXPECT_EQ(decode(bits, 256, false, &rows), bits);
+  EXPECT_EQ(rows, H);
+  EXPECT_EQ(decode(bits, 7, false), bits);
+}
+
+TEST(bitmap_stream, RleRoundTripsAtAnyChunkSize) {
+  const std::vector<uint8_t> bits = wallpaper();
+  const std::vector<uint8_t> rle = encodeBitmapRle(bits.data(), W, H);
+  for (size_t chunk : {1, 2, 3, 40, 129, 256, 100000}) {
+    EXPECT_EQ(decode(rle, chunk, true), bits) << chunk;
+  }
+}
+
+TEST(bitmap_stream, WallpapersShrink) {
+  const std::vector<uint8_t> bits = wallpaper();
+  const std::vector<uint8_t> rle = encodeBitmapRle(bits.data(), W, H);
+  EXPECT_LT(rle.size(), bits.size() / 3);
+
+  std::vector<uint8_t> white(ROW * H, 0x00);
+  EXPECT_LT(encodeBitmapRle(white.data(), W, H).size(), 200u);
+}
+
+TEST(bitmap_stream, NoiseCostsLittleExtra) {
+  std::mt19937 rng(3);
+  std::vector<uint8_t> bits(ROW * H);
+  for (uint8_t& b : bits) b = rng() & 0xFF;
+  const std::vector<uint8_t> rle = encodeBitmapRle(bits.data(), W, H);
+  EXPECT_LE(rle.size(), RLE_HEADER + bits.size() + bits.size() / 64);
+  EXPECT_EQ(decode(rle, 256, true), bits);
+}
+
+TEST(bitmap_stream, RejectsBadHeaders) {
+  BitmapStream<40> bmp;
+  const uint8_t notRle[RLE_HEADER] = {'P', 'M', 'R', '2', 64, 1, 240, 0};
+  const uint8_t tooWide[RLE_HEADER] = {'P', 'M', 'R', '1', 0x90, 1, 240, 0};
+  const uint8_t empty[RLE_HEADER] = {'P', 'M', 'R', '1', 64, 1, 0, 0};
+  EXPECT_FALSE(bmp.begin(notRle, RLE_HEADER));
+  EXPECT_FALSE(bmp.begin(tooWide, RLE_HEADER));
+  EXPECT_TRUE(bmp.done());
+  EXPECT_FALSE(bmp.begin(empty, RLE_HEADER));
+  EXPECT_FALSE(bmp.begin(notRle, 4));
+}
+
+TEST(bitmap_stream, TruncatedFileStopsShort) {
+  const std::vector<uint8_t> bits = wallpaper();
+  std::vector<uint8_t> rle = encodeBitmapRle(bits.data(), W, H);
+  rle.resize(rle.size() / 2);
+  BitmapStream<40> bmp;
+  ASSERT_TRUE(bmp.begin(rle.data(), rle.size()));
+  int rows = 0;
+  bmp.feed(rle.data() + RLE_HEADER, rle.size() - RLE_HEADER,
+           [&](uint16_t, const uint8_t*, uint16_t) { rows++; });
+  EXPECT_FALSE(bmp.done());
+  EXPECT_GT(rows, 0);
+  EXPECT_LT(rows, H);
+}
+
+TEST(bitmap_stream, TrailingBytesAreIgnored) {
+  const std::vector<uint8_t> bits = wallpaper();
+  std::vector<uint8_t> raw = bits;
+  raw.resize(W * H, 0x55);  // the old buffer size, in case a file was padded to it
+  EXPECT_EQ(decode(raw, 512, false), bits);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <bufferedWriter.h>
+
+// Records each write it gets, can be told to stop accepting bytes like a full card
+struct MockSink {
+  std::string data;
+  std::vector<size_t> writes;
+  size_t room = SIZE_MAX;
+
+  size_t write(const uint8_t* p, size_t n) {
+    writes.push_back(n);
+    const size_t k = n < room ? n : room;
+    data.append((const char*)p, k);
+    room -= k;
+    return k;
+  }
+};
+
+TEST(buffered_writer, Crc32KnownValues) {
+  EXPECT_EQ(crc32Update(0, "123456789", 9), 0xCBF43926u);
+  EXPECT_EQ(crc32Update(0, "", 0), 0u);
+  // Feeding it in pieces gives the same result
+  EXPECT_EQ(crc32Update(crc32Update(0, "1234", 4), "56789", 5), 0xCBF43926u);
+}
+
+TEST(buffered_writer, WritesWholeBuffersThenTheRest) {
+  MockSink sink;
+  uint8_t buf[512];
+  BufferedWriter<MockSink> out(sink, buf, sizeof(buf));
+
+  std::mt19937 rng(5);
+  std::string want;
+  while (want.size() < 5000) {
+    std::string line(rng() % 90, 'a' + rng() % 26);
+    line += "\r\n";
+    want += line;
+    ASSERT_EQ(out.write(line.data(), line.size()), line.size());
+  }
+  ASSERT_TRUE(out.flush());
+
+  EXPECT_EQ(sink.data, want);
+  EXPECT_EQ(out.size(), want.size());
+  EXPECT_EQ(out.crc(), crc32Update(0, want.data(), want.size()));
+  for (size_t i = 0; i + 1 < sink.writes.size(); i++) EXPECT_EQ(sink.writes[i], sizeof(buf));
+  EXPECT_EQ(sink.writes.size(), (want.size() + sizeof(buf) - 1) / sizeof(buf));
+}
+
+TEST(buffered_writer, LargeWriteSpansBuffers) {
+  MockSink sink;
+  uint8_t buf[64];
+  BufferedWriter<MockSink> out(sink, buf, sizeof(buf));
+  std::string big(1000, 'x');
+  out.write('<');
+  out.write(big.data(), big.size());
+  ASSERT_TRUE(out.flush());
+  EXPECT_EQ(sink.data, "<" + big);
+}
+
+TEST(buffered_writer, ShortWriteFailsTheSave) {
+  MockSink sink;
+  sink.room = 100;
+  uint8_t buf[64];
+  BufferedWriter<MockSink> out(sink, buf, sizeof(buf));
+  std::string big(300, 'x');
+  out.write(big.data(), big.size());
+  EXPECT_FALSE(out.flush());
+  EXPECT_FALSE(out.ok());
+  EXPECT_EQ(out.write("more", 4), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include <dirtyRects.h>
+
+#define SCREEN_H 240
+
+static bool covers(const std::vector<DirtyRect>& rects, int x, int y) {
+  for (const DirtyRect& r : rects)
+    if (x >= r.x && x < r.right() && y >= r.y && y < r.bottom()) return true;
+  return false;
+}
+
+TEST(dirty_rects, AlignsToEightPixelRows) {
+  std::vector<DirtyRect> rects;
+  addDirtyRect(rects, {10, 29, 100, 20}, 4, SCREEN_H);
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_EQ(rects[0].y, 24);
+  EXPECT_EQ(rects[0].bottom(), 56);
+  EXPECT_EQ(rects[0].x, 10);
+  EXPECT_EQ(rects[0].w, 100);
+}
+
+TEST(dirty_rects, ClipsToScreen) {
+  std::vector<DirtyRect> rects;
+  addDirtyRect(rects, {0, -6, 50, 20}, 4, SCREEN_H);
+  addDirtyRect(rects, {0, 230, 50, 30}, 4, SCREEN_H);
+  addDirtyRect(rects, {0, 300, 50, 30}, 4, SCREEN_H);  // off screen
+  addDirtyRect(rects, {0, 100, 0, 30}, 4, SCREEN_H);   // empty
+  ASSERT_EQ(rects.size(), 2u);
+  EXPECT_EQ(rects[0].y, 0);
+  EXPECT_EQ(rects[1].bottom(), SCREEN_H);
+}
+
+TEST(dirty_rects, MergesTouchingAreas) {
+  std::vector<DirtyRect> rects;
+  addDirtyRect(rects, {10, 32, 100, 20}, 4, SCREEN_H);   // rows 32..56
+  addDirtyRect(rects, {10, 120, 100, 20}, 4, SCREEN_H);  // far away: own window
+  EXPECT_EQ(rects.size(), 2u);
+  addDirtyRect(rects, {10, 53, 100, 10}, 4, SCREEN_H);   // 48..64 overlaps the first
+  ASSERT_EQ(rects.size(), 2u);
+  EXPECT_EQ(rects[1].y, 32);
+  EXPECT_EQ(rects[1].bottom(), 64);
+  // Bridging both pulls everything into one
+  addDirtyRect(rects, {10, 60, 100, 64}, 4, SCREEN_H);
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_EQ(rects[0].y, 32);
+  EXPECT_EQ(rects[0].bottom(), 144);
+}
+
+TEST(dirty_rects, NeverMoreThanMaxAndCoversEverything) {
+  std::mt19937 rng(3);
+  for (int round = 0; round < 200; round++) {
+    std::vector<DirtyRect> rects, added;
+    const size_t maxRects = 1 + rng() % 4;
+    for (int i = 0; i < 12; i++) {
+      DirtyRect r = {(int)(rng() % 300), (int)(rng() % 230), 1 + (int)(rng() % 60),
+                     1 + (int)(rng() % 40)};
+      added.push_back(r);
+      addDirtyRect(rects, r, maxRects, SCREEN_H);
+      ASSERT_LE(rects.size(), maxRects);
+    }
+    for (const DirtyRect& r : rects) {
+      EXPECT_EQ(r.y % 8, 0);
+      EXPECT_TRUE(r.bottom() % 8 == 0 || r.bottom() == SCREEN_H);
+    }
+    for (const DirtyRect& r : added)
+      for (int y = r.y; y < r.bottom() && y < SCREEN_H; y += 3)
+        for (int x = r.x; x < r.right(); x += 5) ASSERT_TRUE(covers(rects, x, y));
+    // Windows never overlap, nothing is sent to the panel twice
+    for (size_t i = 0; i < rects.size(); i++)
+      for (size_t j = i + 1; j < rects.size(); j++) EXPECT_FALSE(rects[i].overlaps(rects[j]));
+  }
+}
+
+TEST(dirty_rects, SelectionMoveIsSmall) {
+  // Two rows of a 290x176 menu frame against redrawing the whole frame
+  std::vector<DirtyRect> rows, whole;
+  addDirtyRect(rows, {10, 32 - 4, 290, 20 + 8}, 4, SCREEN_H);
+  addDirtyRect(rows, {10, 52 - 4, 290, 20 + 8}, 4, SCREEN_H);
+  addDirtyRect(whole, {10, 32, 290, 176}, 4, SCREEN_H);
+  EXPECT_EQ(rows.size(), 1u);
+  EXPECT_LT(dirtyArea(rows) * 3, dirtyArea(whole));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include <displayList.h>
+
+// Writes every call it gets as text, so a recording can be compared with direct drawing
+struct LogGFX {
+  std::string log;
+  void setFont(const GFXfont* f) { log += "font(" + std::to_string(f != nullptr) + ")"; }
+  void setCursor(int16_t x, int16_t y) { log += "cur(" + num(x, y) + ")"; }
+  size_t write(uint8_t c) {
+    log += (char)c;
+    return 1;
+  }
+  size_t print(const char* s) {
+    size_t n = 0;
+    while (*s) n += write((uint8_t)*s++);
+    return n;
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+    log += "rect(" + num(x, y) + "," + num(w, h) + "," + std::to_string(c) + ")";
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) {
+    log += "h(" + num(x, y) + "," + std::to_string(w) + "," + std::to_string(c) + ")";
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) {
+    log += "v(" + num(x, y) + "," + std::to_string(h) + "," + std::to_string(c) + ")";
+  }
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t c) {
+    log += "circ(" + num(x, y) + "," + std::to_string(r) + "," + std::to_string(c) + ")";
+  }
+
+  static std::string num(int a, int b) { return std::to_string(a) + "," + std::to_string(b); }
+};
+
+template <typename G>
+static void drawPage(G& g) {
+  static const GFXfont font = {};
+  g.setFont(&font);
+  g.setCursor(4, 20);
+  g.print("Title");
+  g.write(' ');
+  g.write('x');
+  g.drawFastHLine(0, 24, 320, 0);
+  g.setFont(nullptr);
+  g.setCursor(4, 40);
+  g.print("body");
+  g.fillRect(1, 2, 3, 4, 1);
+  g.drawFastVLine(10, 30, 12, 0);
+  g.fillCircle(50, 60, 3, 0);
+}
+
+TEST(display_list, ReplayMatchesDirectDrawing) {
+  LogGFX direct, replayed;
+  DisplayList list;
+  drawPage(direct);
+  drawPage(list);
+  list.replay(replayed);
+  EXPECT_EQ(replayed.log, direct.log);
+}
+
+TEST(display_list, AdjacentWritesShareOneOp) {
+  DisplayList list;
+  list.setCursor(0, 0);
+  list.print("hello");
+  list.write('!');
+  EXPECT_EQ(list.size(), 2u);
+  EXPECT_EQ(list.ops()[1].w, 6);
+}
+
+TEST(display_list, ClearStartsOver) {
+  DisplayList list;
+  list.print("old");
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  list.print("new");
+
+  LogGFX g;
+  list.replay(g);
+  EXPECT_EQ(g.log, "new");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <docArena.h>
+#include <gapBuffer.h>
+
+TEST(doc_arena, ReusesFreedBlocksOfTheSameClass) {
+  DocArena arena;
+  void* a = arena.alloc(20);
+  EXPECT_EQ(arena.used(), 32u);  // rounded up to its size class
+  arena.free(a, 20);
+  EXPECT_EQ(arena.used(), 0u);
+  EXPECT_EQ(arena.alloc(32), a);
+  EXPECT_EQ(arena.peak(), 32u);
+}
+
+TEST(doc_arena, BlocksDontOverlap) {
+  DocArena arena;
+  std::vector<std::pair<uint8_t*, size_t>> blocks;
+  std::mt19937 rng(3);
+  for (int i = 0; i < 3000; i++) {
+    const size_t n = 1 + rng() % 1500;
+    uint8_t* p = (uint8_t*)arena.alloc(n);
+    ASSERT_NE(p, nullptr);
+    memset(p, i & 0xFF, n);
+    blocks.push_back({p, n});
+    if (rng() % 3 == 0) {
+      size_t k = rng() % blocks.size();
+      arena.free(blocks[k].first, blocks[k].second);
+      blocks.erase(blocks.begin() + k);
+    }
+  }
+  // Every live block still holds its own fill
+  for (auto& b : blocks) {
+    for (size_t i = 1; i < b.second; i++) ASSERT_EQ(b.first[i], b.first[0]);
+  }
+  for (auto& b : blocks) arena.free(b.first, b.second);
+  EXPECT_EQ(arena.used(), 0u);
+}
+
+TEST(doc_arena, ResetKeepsOneChunk) {
+  DocArena arena;
+  for (int i = 0; i < 1000; i++) arena.alloc(64);
+  EXPECT_GT(arena.reserved(), (size_t)DOC_ARENA_CHUNK * 10);
+  EXPECT_EQ(arena.peak(), 64000u);
+
+  arena.reset();
+  EXPECT_EQ(arena.used(), 0u);
+  EXPECT_EQ(arena.peak(), 0u);
+  EXPECT_LE(arena.reserved(), (size_t)DOC_ARENA_CHUNK + 64);
+  EXPECT_NE(arena.alloc(64), nullptr);
+}
+
+TEST(doc_arena, LargeBlocksAreCounted) {
+  DocArena arena;
+  void* p = arena.alloc(DOC_ARENA_MAX_BLOCK + 1);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(arena.used(), (size_t)DOC_ARENA_MAX_BLOCK + 1);
+  arena.free(p, DOC_ARENA_MAX_BLOCK + 1);
+  EXPECT_EQ(arena.used(), 0u);
+  EXPECT_EQ(arena.reserved(), 0u);
+}
+
+TEST(doc_arena, BacksVectorsAndGapBuffers) {
+  DocArena arena;
+  {
+    std::vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 500; i++) v.push_back(i);
+    EXPECT_EQ(v[499], 499);
+
+    GapBuffer buf(&arena);
+    std::string text;
+    std::mt19937 rng(9);
+    for (int i = 0; i < 5000; i++) {
+      const size_t pos = text.empty() ? 0 : rng() % (text.size() + 1);
+      const char c = 'a' + rng() % 26;
+      ASSERT_TRUE(buf.insert(pos, c, 0));
+      text.insert(pos, 1, c);
+      if (i % 7 == 0) {
+        buf.erase(pos, 2);
+        text.erase(pos, 2);
+      }
+    }
+    std::string got;
+    for (size_t i = 0; i < buf.size(); i++) got += buf.at(i);
+    EXPECT_EQ(got, text);
+    EXPECT_GT(arena.used(), 0u);
+
+    GapBuffer moved = std::move(buf);
+    EXPECT_EQ(moved.size(), text.size());
+  }
+  EXPECT_EQ(arena.used(), 0u);
+}
+
+// Loading note after note only ever keeps one chunk plus what the current note needs
+TEST(doc_arena, RepeatedDocumentsDontGrow) {
+  DocArena arena;
+  std::mt19937 rng(1);
+  size_t firstReserved = 0;
+  for (int doc = 0; doc < 50; doc++) {
+    {
+      std::vector<GapBuffer> paragraphs;
+      for (int p = 0; p < 200; p++) {
+        paragraphs.emplace_back(&arena);
+        const size_t n = 1 + rng() % 200;
+        for (size_t c = 0; c < n; c++) paragraphs.back().insert(c, 'x', 0);
+      }
+    }
+    if (doc == 0) firstReserved = arena.reserved();
+    EXPECT_LE(arena.reserved(), firstReserved * 2);
+    EXPECT_EQ(arena.used(), 0u);
+    arena.reset();
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <docSpans.h>
+
+// The card and the window of a paged document, driven the way TXT_NEW pages it
+struct PagedDoc {
+  std::vector<std::string> base;
+  std::vector<std::string> overlay;
+  std::vector<std::string> window;
+  DocSpans spans;
+  uint32_t written = 0;  // lines appended to the overlay
+
+  explicit PagedDoc(uint32_t lines) {
+    for (uint32_t i = 0; i < lines; i++) base.push_back("line " + std::to_string(i));
+    spans.reset(lines);
+  }
+
+  void read(const std::vector<DocSpan>& spans, std::vector<std::string>& out) const {
+    for (const DocSpan& s : spans)
+      for (uint32_t i = 0; i < s.count; i++)
+        out.push_back(s.file == DOC_BASE ? base[s.first + i] : overlay[s.first + i]);
+  }
+
+  void load(uint32_t first, uint32_t last) {
+    dropBack((uint32_t)window.size());
+    std::vector<DocSpan> r;
+    spans.load(first, last, r);
+    read(r, window);
+  }
+
+  // Edited lines go to the overlay first
+  void pageOut(uint32_t first, uint32_t n) {
+    for (uint32_t i = first; i < first + n; i++) {
+      if (!spans.edited(i)) continue;
+      spans.overlayLine((uint32_t)overlay.size(), (uint32_t)overlay.size() + 1);
+      overlay.push_back(window[i]);
+      written++;
+    }
+  }
+  void dropFront(uint32_t n) {
+    pageOut(0, n);
+    spans.dropFront(n);
+    window.erase(window.begin(), window.begin() + n);
+  }
+  void dropBack(uint32_t n) {
+    pageOut((uint32_t)window.size() - n, n);
+    spans.dropBack(n);
+    window.erase(window.end() - n, window.end());
+  }
+  void pageAbove(uint32_t n) {
+    std::vector<DocSpan> r;
+    std::vector<std::string> page;
+    spans.above(n, r);
+    read(r, page);
+    spans.takeAbove(n);
+    window.insert(window.begin(), page.begin(), page.end());
+  }
+  void pageBelow(uint32_t n) {
+    std::vector<DocSpan> r;
+    spans.below(n, r);
+    read(r, window);
+    spans.takeBelow(n);
+  }
+
+  void change(uint32_t i, const std::string& text) {
+    window[i] = text;
+    spans.changed(i);
+  }
+  void insert(uint32_t i, const std::string& text) {
+    window.insert(window.begin() + i, text);
+    spans.inserted(i);
+  }
+  void erase(uint32_t i) {
+    window.erase(window.begin() + i);
+    spans.erased(i);
+  }
+
+  // What a save would write
+  std::vector<std::string> document() const {
+    std::vector<std::string> doc;
+    read(spans.beforeSpans(), doc);
+    doc.insert(doc.end(), window.begin(), window.end());
+    read(spans.afterSpans(), doc);
+    return doc;
+  }
+};
+
+TEST(doc_spans, ResetPutsTheWholeBaseAfterTheWindow) {
+  DocSpans spans;
+  spans.reset(100);
+  EXPECT_EQ(spans.before(), 0u);
+  EXPECT_EQ(spans.after(), 100u);
+  EXPECT_FALSE(spans.empty());
+  ASSERT_EQ(spans.afterSpans().size(), 1u);
+
+  std::vector<DocSpan> r;
+  spans.load(40, 60, r);
+  ASSERT_EQ(r.size(), 1u);
+  EXPECT_EQ(r[0].first, 40u);
+  EXPECT_EQ(r[0].count, 20u);
+  EXPECT_EQ(spans.before(), 40u);
+  EXPECT_EQ(spans.window(), 20u);
+  EXPECT_EQ(spans.after(), 40u);
+
+  spans.reset(0);
+  EXPECT_TRUE(spans.empty());
+}
+
+TEST(doc_spans, UneditedPagingWritesNothing) {
+  PagedDoc doc(500);
+  doc.load(300, 500);
+  for (int step = 0; step < 4; step++) {
+    doc.pageAbove(64);
+    doc.dropBack(64);
+  }
+  EXPECT_EQ(doc.window.front(), "line 44");
+  doc.pageBelow(64);
+  doc.dropFront(64);
+  EXPECT_EQ(doc.written, 0u);
+  EXPECT_EQ(doc.document(), doc.base);
+  // Still one span each side, nothing got split up
+  EXPECT_EQ(doc.spans.beforeSpans().size(), 1u);
+  EXPECT_EQ(doc.spans.afterSpans().size(), 1u);
+}
+
+TEST(doc_spans, OnlyEditedLinesArePagedOut) {
+  PagedDoc doc(300);
+  doc.load(100, 300);
+  std::vector<std::string> expect = doc.base;
+
+  doc.change(3, "changed");
+  expect[103] = "changed";
+  doc.insert(10, "new");
+  expect.insert(expect.begin() + 110, "new");
+  doc.erase(20);
+  expect.erase(expect.begin() + 120);
+
+  doc.dropFront(64);
+  EXPECT_EQ(doc.written, 2u);  // the changed and the new line, not the other 62
+  EXPECT_EQ(doc.document(), expect);
+
+  // Paged back in they're clean, dropping them again writes nothing
+  doc.pageAbove(64);
+  EXPECT_FALSE(doc.spans.edited(3));
+  EXPECT_EQ(doc.window[3], "changed");
+  doc.dropFront(64);
+  EXPECT_EQ(doc.written, 2u);
+  EXPECT_EQ(doc.document(), expect);
+}
+
+TEST(doc_spans, EditsAtTheEndAreKeptInOrder) {
+  PagedDoc doc(10);
+  doc.load(0, 10);
+  std::vector<std::string> expect = doc.base;
+  for (int i = 0; i < 200; i++) {
+    std::string text = "typed " + std::to_string(i);
+    doc.insert((uint32_t)doc.window.size(), text);
+    expect.push_back(text);
+    if (doc.window.size() > 64) doc.dropFront((uint32_t)doc.window.size() - 64);
+  }
+  EXPECT_EQ(doc.document(), expect);
+  EXPECT_EQ(doc.written, 136u);  // all but the 64 still in the window
+  EXPECT_EQ(doc.spans.before() + doc.spans.window() + doc.spans.after(), 210u);
+
+  // Jumping back to the top reads base and overlay lines alike
+  doc.load(5, 20);
+  EXPECT_EQ(doc.window.front(), "line 5");
+  EXPECT_EQ(doc.window.back(), "typed 9");
+  EXPECT_EQ(doc.document(), expect);
+}
+
+TEST(doc_spans, ReloadingAnEditedWindowKeepsEveryEdit) {
+  PagedDoc doc(1000);
+  doc.load(800, 1000);
+  std::vector<std::string> expect = doc.base;
+  for (uint32_t i = 0; i < 200; i += 7) {
+    doc.change(i, "edit " + std::to_string(i));
+    expect[800 + i] = "edit " + std::to_string(i);
+  }
+  doc.load(0, 192);
+  doc.change(0, "first");
+  expect[0] = "first";
+  doc.load(400, 592);
+  EXPECT_EQ(doc.written, 30u);
+  EXPECT_EQ(doc.document(), expect);
+  EXPECT_EQ(doc.spans.after(), 1000u - 592u);
+}
+
+TEST(doc_spans, OverlayOffsets) {
+  DocSpans spans;
+  spans.reset(5);
+  EXPECT_EQ(spans.overlayOffset(0), 0u);
+  spans.overlayLine(0, 12);
+  spans.overlayLine(12, 30);
+  spans.overlayLine(40, 45);  // a failed append left bytes in between
+  EXPECT_EQ(spans.overlayLines(), 3u);
+  EXPECT_EQ(spans.overlayOffset(1), 12u);
+  EXPECT_EQ(spans.overlayOffset(2), 40u);
+  EXPECT_EQ(spans.overlayOffset(3), 45u);
+  spans.reset(5);
+  EXPECT_EQ(spans.overlayLines(), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include <doubleBuffer.h>
+
+// Every field carries the same value, so a reader that sees a half written frame notices
+struct Frame {
+  uint32_t seq[64];
+};
+
+static void fill(Frame& f, uint32_t v) {
+  for (uint32_t& s : f.seq) s = v;
+}
+
+TEST(double_buffer, EmptyUntilFirstPublish) {
+  DoubleBuffer<Frame> frames;
+  EXPECT_EQ(frames.version(), 0u);
+
+  Frame* f = frames.beginWrite();
+  ASSERT_NE(f, nullptr);
+  fill(*f, 7);
+  frames.publish();
+  EXPECT_EQ(frames.version(), 1u);
+
+  uint32_t version = 0;
+  const Frame& got = frames.acquire(&version);
+  EXPECT_EQ(version, 1u);
+  EXPECT_EQ(got.seq[0], 7u);
+  frames.release();
+}
+
+TEST(double_buffer, WriterSkipsOnlyWhenReaderHoldsTheBackBuffer) {
+  DoubleBuffer<Frame> frames;
+  fill(*frames.beginWrite(), 1);
+  frames.publish();
+
+  const Frame& shown = frames.acquire();
+  // The other buffer is free while the reader draws
+  Frame* f = frames.beginWrite();
+  ASSERT_NE(f, nullptr);
+  fill(*f, 2);
+  frames.publish();
+  // A second frame during the same read would overwrite what the reader holds
+  EXPECT_EQ(frames.beginWrite(), nullptr);
+  EXPECT_EQ(shown.seq[63], 1u);
+  frames.release();
+
+  EXPECT_NE(frames.beginWrite(), nullptr);
+  EXPECT_EQ(frames.acquire().seq[0], 2u);
+  frames.release();
+}
+
+TEST(double_buffer, ConcurrentReaderNeverSeesTornFrames) {
+  DoubleBuffer<Frame> frames;
+  std::atomic<bool> done{false};
+  std::atomic<uint32_t> torn{0}, backwards{0}, reads{0};
+
+  std::thread reader([&] {
+    uint32_t last = 0;
+    while (!done.load()) {
+      if (frames.version() == last) continue;
+      uint32_t version;
+      const Frame& f = frames.acquire(&version);
+      for (uint32_t s : f.seq)
+        if (s != f.seq[0] || s != version) torn++;
+      if (version < last) backwards++;
+      last = version;
+      reads++;
+      frames.release();
+    }
+  });
+
+  uint32_t published = 0, skipped = 0;
+  for (int i = 0; i < 200000; i++) {
+    Frame* f = frames.beginWrite();
+    if (!f) {
+      skipped++;
+      continue;
+    }
+    fill(*f, frames.version() + 1);
+    frames.publish();
+    published++;
+  }
+  done = true;
+  reader.join();
+
+  EXPECT_EQ(torn.load(), 0u);
+  EXPECT_EQ(backwards.load(), 0u);
+  EXPECT_EQ(frames.version(), published);
+  EXPECT_GT(reads.load(), 0u);
+  EXPECT_EQ(published + skipped, 200000u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
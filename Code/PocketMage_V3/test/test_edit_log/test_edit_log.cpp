@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <editLog.h>
+
+// Replays a packed log onto lines the way TXT does at boot, false if it names a line
+// the document doesn't have
+static bool replay(const std::string& log, std::vector<std::string>& lines) {
+  std::istringstream in(log);
+  std::string line;
+  while (std::getline(in, line)) {
+    EditLogOp op;
+    const char* text = parseEditLogLine(line.c_str(), op);
+    if (op.kind != 'I' && op.kind != 'D' && op.kind != 'S')
+      continue;
+    if (!editLogOpFits(op, lines.size()))
+      return false;
+    if (op.kind == 'I')
+      lines.insert(lines.begin() + op.n, "");
+    else if (op.kind == 'D')
+      lines.erase(lines.begin() + op.n);
+    else
+      lines[op.n] = text;
+  }
+  return true;
+}
+
+TEST(edit_log, ParsesOps) {
+  EditLogOp op;
+  EXPECT_EQ(parseEditLogLine("I 12", op), nullptr);
+  EXPECT_EQ(op.kind, 'I');
+  EXPECT_EQ(op.n, 12u);
+
+  const char* text = parseEditLogLine("S 3 # Heading with  spaces", op);
+  EXPECT_EQ(op.kind, 'S');
+  EXPECT_EQ(op.n, 3u);
+  EXPECT_STREQ(text, "# Heading with  spaces");
+
+  // An empty line keeps its separator
+  text = parseEditLogLine("S 7 ", op);
+  EXPECT_STREQ(text, "");
+
+  parseEditLogLine("C 99", op);
+  EXPECT_EQ(op.kind, 'C');
+  EXPECT_EQ(op.n, 99u);
+}
+
+TEST(edit_log, RejectsOtherLines) {
+  EditLogOp op;
+  for (const char* s : {"", "W 10 20 /notes/a.txt", "C ", "S", "Sx 1", "I x", "X 1"}) {
+    parseEditLogLine(s, op);
+    EXPECT_EQ(op.kind, 0) << s;
+  }
+}
+
+TEST(edit_log, ChangedLinesLoggedOnce) {
+  EditLog log;
+  EXPECT_TRUE(log.empty());
+  for (int i = 0; i < 50; i++) log.changed(4);
+  log.changed(2);
+  EXPECT_EQ(log.changedLines(), (std::vector<uint32_t>{2, 4}));
+
+  std::string out;
+  log.pack(out, 1, [](std::string& o, uint32_t line) { o += "line" + std::to_string(line); });
+  EXPECT_EQ(out, "S 2 line2\nS 4 line4\nC 1\n");
+  EXPECT_TRUE(log.empty());
+}
+
+TEST(edit_log, InsertAndEraseRenumberChanges) {
+  EditLog log;
+  log.changed(5);
+  log.inserted(3);  // 5 moves to 6
+  log.changed(8);
+  log.erased(6);    // the changed line is gone, 8 moves to 7
+  EXPECT_EQ(log.changedLines(), (std::vector<uint32_t>{3, 7}));
+}
+
+// Random edits applied to a model document, replayed from the log in batches
+TEST(edit_log, ReplayMatchesEdits) {
+  std::mt19937 rng(11);
+  std::vector<std::string> doc, start;
+  for (int i = 0; i < 40; i++) doc.push_back("line " + std::to_string(i));
+  start = doc;
+
+  EditLog log;
+  std::string packed;
+  uint32_t seq = 0;
+  for (int step = 0; step < 5000; step++) {
+    const uint32_t at = rng() % (doc.size() + 1);
+    const int what = rng() % 10;
+    if (what < 6 && at < doc.size()) {
+      doc[at] += (char)('a' + rng() % 26);
+      log.changed(at);
+    } else if (what < 8) {
+      doc.insert(doc.begin() + at, "new " + std::to_string(step));
+      log.inserted(at);
+    } else if (doc.size() > 1 && at < doc.size()) {
+      doc.erase(doc.begin() + at);
+      log.erased(at);
+    }
+    if (rng() % 50 == 0) {
+      log.pack(packed, ++seq, [&](std::string& o, uint32_t line) { o += doc[line]; });
+    }
+  }
+  log.pack(packed, ++seq, [&](std::string& o, uint32_t line) { o += doc[line]; });
+
+  EXPECT_TRUE(replay(packed, start));
+  EXPECT_EQ(start, doc);
+}
+
+TEST(edit_log, OpsPastTheEndDontFit) {
+  EXPECT_TRUE(editLogOpFits({'I', 3}, 3));  // a new last line
+  EXPECT_FALSE(editLogOpFits({'I', 4}, 3));
+  EXPECT_TRUE(editLogOpFits({'S', 2}, 3));
+  EXPECT_FALSE(editLogOpFits({'S', 3}, 3));
+  EXPECT_FALSE(editLogOpFits({'D', 3}, 3));
+  EXPECT_FALSE(editLogOpFits({'D', 0}, 0));
+
+  // A log for a longer document is rejected
+  std::vector<std::string> lines = {"a", "b", "c"};
+  EXPECT_FALSE(replay("S 1 x\nS 3 d\nC 1\n", lines));
+  EXPECT_FALSE(replay("D 3\nC 1\n", lines));
+  lines = {"a", "b", "c"};
+  EXPECT_TRUE(replay("I 3\nS 3 d\nC 1\n", lines));
+  EXPECT_EQ(lines, (std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
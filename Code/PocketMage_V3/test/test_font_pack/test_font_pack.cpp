@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#include <fontPack.h>
+#include <Fonts/FreeMono9pt8b.h>
+#include <Fonts/FreeSerif9pt8b.h>
+#include <Fonts/FreeSansBold24pt8b.h>
+
+// The SD card: pack files by path
+static std::map<std::string, std::vector<uint8_t>> card;
+static uint32_t fakeMicros = 0;
+static uint32_t clockNow() { return fakeMicros; }
+
+static bool loadFromCard(const char* path, FontCache& cache, GFXfont& font, uint8_t*& block,
+                         size_t& bytes) {
+  auto it = card.find(path);
+  if (it == card.end()) return false;
+  const std::vector<uint8_t>& file = it->second;
+  size_t at = 0;
+  fakeMicros += 1000 + file.size() / 10;  // reading it takes a while
+  return loadFontPack(
+      [&](uint8_t* dst, size_t n) {
+        n = std::min(n, file.size() - at);
+        if (n) memcpy(dst, file.data() + at, n);
+        at += n;
+        return n;
+      },
+      [&](size_t n) { return cache.allocate(n); }, font, block, bytes);
+}
+
+static void sameFont(const GFXfont& a, const GFXfont& b) {
+  ASSERT_EQ(a.first, b.first);
+  ASSERT_EQ(a.last, b.last);
+  EXPECT_EQ(a.yAdvance, b.yAdvance);
+  for (int i = 0; i <= a.last - a.first; i++) {
+    const GFXglyph& x = a.glyph[i];
+    const GFXglyph& y = b.glyph[i];
+    ASSERT_EQ(x.bitmapOffset, y.bitmapOffset) << i;
+    ASSERT_EQ(x.width, y.width) << i;
+    ASSERT_EQ(x.height, y.height) << i;
+    ASSERT_EQ(x.xAdvance, y.xAdvance) << i;
+    ASSERT_EQ(x.xOffset, y.xOffset) << i;
+    ASSERT_EQ(x.yOffset, y.yOffset) << i;
+    ASSERT_EQ(memcmp(a.bitmap + x.bitmapOffset, b.bitmap + y.bitmapOffset,
+                     (x.width * x.height + 7) / 8), 0) << i;
+  }
+}
+
+class font_pack : public ::testing::Test {
+protected:
+  void SetUp() override {
+    card.clear();
+    card["/mono.pmf"]  = encodeFontPack(FreeMono9pt8b);
+    card["/serif.pmf"] = encodeFontPack(FreeSerif9pt8b);
+    card["/h1.pmf"]    = encodeFontPack(FreeSansBold24pt8b);
+    fakeMicros = 0;
+  }
+  static size_t loaded(const char* path) {
+    FontPackHeader h;
+    parseFontPackHeader(card[path].data(), FONT_PACK_HEADER, h);
+    return h.loadedBytes();
+  }
+};
+
+// A stand-in for the 7b fonts compiled into the firmware
+static const GFXfont& fallback = FreeMono9pt8b;
+
+TEST_F(font_pack, LoadsWhatWasPacked) {
+  FontCache cache(64 * 1024, loadFromCard, clockNow);
+  const GFXfont* serif = cache.use(cache.handle("/serif.pmf", &fallback));
+  ASSERT_NE(serif, &fallback);
+  sameFont(*serif, FreeSerif9pt8b);
+  const GFXfont* h1 = cache.use(cache.handle("/h1.pmf", &fallback));
+  sameFont(*h1, FreeSansBold24pt8b);
+  EXPECT_EQ(fontMetrics(h1).width("Heading"),
+            fontMetrics(&FreeSansBold24pt8b).width("Heading"));
+  EXPECT_EQ(cache.used(), loaded("/serif.pmf") + loaded("/h1.pmf"));
+}
+
+TEST_F(font_pack, DamagedPacksFallBack) {
+  std::vector<uint8_t> good = card["/serif.pmf"];
+  card["/magic.pmf"] = good;
+  card["/magic.pmf"][3] = '2';
+  for (size_t cut : {0ul, 5ul, (size_t)FONT_PACK_HEADER, good.size() / 2, good.size() - 1}) {
+    card["/cut.pmf"] = std::vector<uint8_t>(good.begin(), good.begin() + cut);
+    FontCache cache(64 * 1024, loadFromCard, clockNow);
+    EXPECT_EQ(cache.use(cache.handle("/cut.pmf", &fallback)), &fallback) << cut;
+    EXPECT_EQ(cache.used(), 0u);
+  }
+  // a glyph pointing past the bitmap
+  card["/offset.pmf"] = good;
+  card["/offset.pmf"][FONT_PACK_HEADER + 1] = 0xFF;
+
+  FontCache cache(64 * 1024, loadFromCard, clockNow);
+  for (const char* path : {"/magic.pmf", "/offset.pmf", "/missing.pmf"}) {
+    FontHandle* h = cache.handle(path, &fallback);
+    EXPECT_EQ(cache.use(h), &fallback) << path;
+    EXPECT_EQ(cache.use(h), &fallback) << path;  // not tried again
+  }
+  EXPECT_EQ(cache.stats().failures, 3u);
+  EXPECT_EQ(cache.stats().misses, 3u);
+  EXPECT_EQ(cache.used(), 0u);
+
+  // packs copied over since are picked up after clear()
+  card["/missing.pmf"] = good;
+  cache.clear();
+  EXPECT_NE(cache.use(cache.handle("/missing.pmf", &fallback)), &fallback);
+}
+
+TEST_F(font_pack, HandlesAreStable) {
+  FontCache cache(64 * 1024, loadFromCard, clockNow);
+  FontHandle* a = cache.handle("/mono.pmf", &fallback);
+  EXPECT_EQ(cache.handle("/mono.pmf", &fallback), a);
+  EXPECT_NE(cache.handle("/serif.pmf", &fallback), a);
+  const GFXfont* first = cache.use(a);
+  EXPECT_EQ(first, &a->font);
+  cache.clear();
+  EXPECT_FALSE(a->loaded());
+  EXPECT_EQ(a->cur, &fallback);
+  EXPECT_EQ(cache.use(a), first);  // reloaded into the same GFXfont
+  EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+TEST_F(font_pack, EvictsLeastRecentlyUsed) {
+  const size_t budget = loaded("/mono.pmf") + loaded("/h1.pmf") + 100;
+  FontCache cache(budget, loadFromCard, clockNow);
+  FontHandle* mono  = cache.handle("/mono.pmf", &fallback);
+  FontHandle* serif = cache.handle("/serif.pmf", &fallback);
+  FontHandle* h1    = cache.handle("/h1.pmf", &fallback);
+
+  cache.use(mono);
+  cache.use(serif);
+  for (int i = 0; i < 3; i++) cache.nextFrame();
+  cache.use(mono);  // serif is now the oldest
+  for (int i = 0; i < 3; i++) cache.nextFrame();
+  cache.use(h1);
+  EXPECT_TRUE(h1->loaded());
+  EXPECT_TRUE(mono->loaded());
+  EXPECT_FALSE(serif->loaded());
+  EXPECT_EQ(cache.stats().evictions, 1u);
+  EXPECT_LE(cache.used(), budget);
+
+  // the evicted handle is switched to the fallback, using it again reloads the pack
+  EXPECT_EQ(serif->cur, &fallback);
+  EXPECT_EQ(cache.use(serif), &serif->font);
+}
+
+TEST_F(font_pack, FramesInFlightKeepTheirFonts) {
+  FontCache cache(loaded("/mono.pmf") + 100, loadFromCard, clockNow);
+  FontHandle* mono  = cache.handle("/mono.pmf", &fallback);
+  FontHandle* serif = cache.handle("/serif.pmf", &fallback);
+  cache.use(mono);
+  cache.nextFrame();  // published, the e-ink task may be drawing it
+  cache.use(serif);
+  EXPECT_TRUE(mono->loaded());
+  EXPECT_TRUE(serif->loaded());
+  EXPECT_EQ(cache.stats().overBudget, 1u);
+
+  // once neither frame can be on screen any more the budget holds again
+  for (int i = 0; i < 3; i++) cache.nextFrame();
+  cache.use(serif);
+  cache.use(cache.handle("/h1.pmf", &fallback));
+  EXPECT_FALSE(mono->loaded());
+}
+
+TEST_F(font_pack, ReportsHitRateAndFirstUseLatency) {
+  FontCache cache(64 * 1024, loadFromCard, clockNow);
+  FontHandle* mono  = cache.handle("/mono.pmf", &fallback);
+  FontHandle* serif = cache.handle("/serif.pmf", &fallback);
+  for (int word = 0; word < 98; word++) cache.use(word % 2 ? mono : serif);
+  const FontCacheStats& s = cache.stats();
+  EXPECT_EQ(s.misses, 2u);
+  EXPECT_EQ(s.hits, 96u);
+  EXPECT_EQ(s.hitPercent(), 97u);
+  EXPECT_EQ(s.loadUs, fakeMicros);
+  EXPECT_EQ(s.loadUsMax, 1000u + card["/serif.pmf"].size() / 10);
+  EXPECT_EQ(s.loadUsAvg(), fakeMicros / 2);
+}
+
+// The packs shipped for the SD card are what the headers encode to
+TEST(font_pack_files, ShippedPacksMatchTheHeaders) {
+  std::string dir = __FILE__;
+  dir = dir.substr(0, dir.find_last_of('/') + 1) + "../../../../Docs/Fonts (PMF)/";
+  const std::pair<const char*, const GFXfont*> fonts[] = {
+      {"FreeMono9pt8b", &FreeMono9pt8b},
+      {"FreeSerif9pt8b", &FreeSerif9pt8b},
+      {"FreeSansBold24pt8b", &FreeSansBold24pt8b},
+  };
+  for (const auto& f : fonts) {
+    const std::string path = dir + f.first + ".pmf";
+    FILE* file = fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr) << path;
+    std::vector<uint8_t> shipped;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) shipped.insert(shipped.end(), buf, buf + n);
+    fclose(file);
+    EXPECT_EQ(shipped, encodeFontPack(*f.second)) << path << " is stale, rerun tools/gfxfont2pmf.py";
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#include <frameWrap.h>
+#include <Fonts/FreeSerif9pt8b.h>
+#include <Fonts/FreeMono9pt8b.h>
+
+// Old sliceThatFits(): copies the slice into a buffer and measures it after every char
+static size_t legacySlice(const char* s, size_t n, const FontMetrics& fm, int maxTextWidth) {
+  if (!s || n == 0) return 0;
+  static char buf[256];
+  const size_t cap = sizeof(buf) - 1;
+  size_t best = 0, lastSpace = SIZE_MAX;
+  size_t i = 0, len = 0;
+  while (i < n && len < cap) {
+    char c = s[i];
+    if (c == '\n' || c == '\r') return (best > 0) ? best : 1;
+    if (c == ' ') lastSpace = i;
+    buf[len++] = c;
+    buf[len] = '\0';
+    if ((int)fm.bounds(buf, len).w > maxTextWidth) break;
+    best = i + 1;
+    ++i;
+  }
+  const bool overflowed = (i < n) || (len >= cap);
+  if (best == 0) return (n ? 1 : 0);
+  if (overflowed && lastSpace != SIZE_MAX && lastSpace + 1 <= best) return lastSpace + 1;
+  return best;
+}
+
+static std::vector<std::string> makeLines(size_t count, unsigned seed) {
+  static const char* dict[] = {"Help", "press", "FN", "+", "key", "to", "open", "the", "menu,",
+                               "scroll", "with", "touch", "strip.", "~C~", "\xe9t\xe9",
+                               "supercalifragilisticexpialidocious", "\r", "a", "42", "(calc)"};
+  std::mt19937 rng(seed);
+  std::vector<std::string> out;
+  for (size_t i = 0; i < count; i++) {
+    std::string line;
+    const size_t words = rng() % 40;
+    for (size_t w = 0; w < words; w++) {
+      if (w) line += ' ';
+      line += dict[rng() % 20];
+    }
+    out.push_back(line);
+  }
+  return out;
+}
+
+TEST(frame_wrap, SlicesMatchLegacy) {
+  const GFXfont* fonts[] = {&FreeSerif9pt8b, &FreeMono9pt8b};
+  for (const GFXfont* f : fonts) {
+    const FontMetrics& fm = fontMetrics(f);
+    for (int width : {40, 150, 300}) {
+      for (const std::string& line : makeLines(300, width)) {
+        size_t pos = 0;
+        while (pos < line.size()) {
+          const size_t want = legacySlice(line.data() + pos, line.size() - pos, fm, width);
+          const size_t got = sliceThatFits(line.data() + pos, line.size() - pos, fm, width);
+          ASSERT_EQ(got, want) << "[" << line << "] at " << pos << " width " << width;
+          pos += got;
+        }
+      }
+    }
+  }
+  EXPECT_EQ(sliceThatFits("", 0, fontMetrics(&FreeMono9pt8b), 100), 0u);
+  EXPECT_EQ(sliceThatFits("W", 1, fontMetrics(&FreeMono9pt8b), 1), 1u);  // never stuck
+}
+
+TEST(frame_wrap, MeasuresEachLineOnce) {
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  auto lines = makeLines(50, 7);
+  WrapCache cache;
+  int src;
+  cache.use(&src, 0, lines.size(), 200, &FreeSerif9pt8b);
+
+  const uint16_t* ends;
+  size_t n = cache.slices(3, lines[3].data(), lines[3].size(), fm, ends);
+  EXPECT_EQ(cache.measuredLines(), 1u);
+  ASSERT_GT(n, 0u);
+  EXPECT_EQ(ends[n - 1], lines[3].size());
+
+  // Same key: nothing is measured again, the text isn't even looked at
+  cache.use(&src, 0, lines.size(), 200, &FreeSerif9pt8b);
+  EXPECT_TRUE(cache.measured(3));
+  const uint16_t* again;
+  EXPECT_EQ(cache.slices(3, nullptr, 0, fm, again), n);
+  EXPECT_EQ(again[n - 1], lines[3].size());
+
+  // Appending lines keeps what was measured
+  cache.use(&src, 0, lines.size() + 5, 200, &FreeSerif9pt8b);
+  EXPECT_TRUE(cache.measured(3));
+  EXPECT_FALSE(cache.measured(lines.size() + 2));
+}
+
+TEST(frame_wrap, KeyChangesDropSlices) {
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  const std::string line = "one two three four five six seven eight nine ten";
+  WrapCache cache;
+  int a, b;
+  const uint16_t* ends;
+
+  cache.use(&a, 0, 1, 100, &FreeSerif9pt8b);
+  const size_t narrow = cache.slices(0, line.data(), line.size(), fm, ends);
+
+  cache.use(&a, 0, 1, 400, &FreeSerif9pt8b);  // width
+  EXPECT_FALSE(cache.measured(0));
+  EXPECT_LT(cache.slices(0, line.data(), line.size(), fm, ends), narrow);
+
+  cache.use(&a, 1, 1, 400, &FreeSerif9pt8b);  // source cleared and refilled
+  EXPECT_FALSE(cache.measured(0));
+  cache.slices(0, line.data(), line.size(), fm, ends);
+  cache.use(&b, 1, 1, 400, &FreeSerif9pt8b);  // another source
+  EXPECT_FALSE(cache.measured(0));
+  cache.slices(0, line.data(), line.size(), fm, ends);
+  cache.use(&b, 1, 1, 400, &FreeMono9pt8b);   // font
+  EXPECT_FALSE(cache.measured(0));
+}
+
+TEST(frame_wrap, BenchmarkScrollLongSource) {
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  auto lines = makeLines(400, 9);
+  const int width = 300, visible = 12;
+  using clock = std::chrono::steady_clock;
+
+  // Scroll through the whole source one line at a time, redrawing the visible lines
+  size_t before = 0, after = 0;
+  auto t0 = clock::now();
+  for (size_t top = 0; top + visible <= lines.size(); top++) {
+    for (size_t l = top; l < top + visible; l++) {
+      size_t pos = 0;
+      while (pos < lines[l].size()) {
+        pos += legacySlice(lines[l].data() + pos, lines[l].size() - pos, fm, width);
+        before++;
+      }
+    }
+  }
+  auto t1 = clock::now();
+  WrapCache cache;
+  for (size_t top = 0; top + visible <= lines.size(); top++) {
+    cache.use(&lines, 0, lines.size(), width, &FreeSerif9pt8b);
+    for (size_t l = top; l < top + visible; l++) {
+      const uint16_t* ends;
+      after += cache.slices(l, lines[l].data(), lines[l].size(), fm, ends);
+    }
+  }
+  auto t2 = clock::now();
+
+  EXPECT_EQ(before, after);
+  auto usBefore = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  auto usAfter = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+  printf("[ BENCH    ] scroll %zu lines: remeasure %lld us, wrap cache %lld us\n", lines.size(),
+         (long long)usBefore, (long long)usAfter);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <gapBuffer.h>
+
+static std::string textOf(const GapBuffer& b) {
+  std::string s;
+  for (size_t i = 0; i < b.size(); i++) s += b.at(i);
+  return s;
+}
+
+static std::string attrsOf(const GapBuffer& b) {
+  std::string s;
+  for (size_t i = 0; i < b.size(); i++) s += (char)('0' + b.attrAt(i));
+  return s;
+}
+
+TEST(gap_buffer, MatchesStringUnderRandomEdits) {
+  std::mt19937 rng(42);
+  GapBuffer buf;
+  std::string text, attrs;
+
+  for (int step = 0; step < 20000; step++) {
+    const size_t pos = text.empty() ? 0 : rng() % (text.size() + 1);
+    if (rng() % 3 != 0 || text.empty()) {
+      const char c = 'a' + rng() % 26;
+      const uint8_t a = rng() % 4;
+      ASSERT_TRUE(buf.insert(pos, c, a));
+      text.insert(pos, 1, c);
+      attrs.insert(pos, 1, (char)('0' + a));
+    } else {
+      const size_t n = 1 + rng() % 3;
+      buf.erase(pos, n);
+      if (pos < text.size()) {
+        text.erase(pos, n);
+        attrs.erase(pos, n);
+      }
+    }
+    if (step % 1000 == 0) {
+      ASSERT_EQ(textOf(buf), text);
+      ASSERT_EQ(attrsOf(buf), attrs);
+    }
+  }
+  EXPECT_EQ(textOf(buf), text);
+  EXPECT_EQ(attrsOf(buf), attrs);
+}
+
+TEST(gap_buffer, ContiguousSpansAcrossTheGap) {
+  GapBuffer buf;
+  buf.insert(0, "hello world", 11, 0);
+  buf.insert(5, ',', 0);  // gap now sits after "hello,"
+  EXPECT_EQ(std::string(buf.contiguous(3, 6), 6), "lo, wo");
+  EXPECT_EQ(textOf(buf), "hello, world");
+
+  char out[8] = {};
+  EXPECT_EQ(buf.copy(out, 7, 8), 5u);
+  EXPECT_EQ(std::string(out, 5), "world");
+}
+
+TEST(gap_buffer, AttributesAndMoves) {
+  GapBuffer a;
+  a.insert(0, "bold", 4, 0);
+  a.setAttr(1, 2, 1);
+  EXPECT_EQ(attrsOf(a), "0110");
+
+  GapBuffer b(std::move(a));
+  EXPECT_EQ(a.size(), 0u);
+  EXPECT_EQ(textOf(b), "bold");
+
+  b.shrinkToFit();
+  EXPECT_EQ(b.capacity(), 4u);
+  EXPECT_TRUE(b.insert(4, '!', 2));
+  EXPECT_EQ(attrsOf(b), "01102");
+
+  b.clear();
+  EXPECT_TRUE(b.empty());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <inputEvents.h>
+
+// One pass of the input loop at now, the way waitInput() and processKB() drive the pacer
+static void pass(InputPacer& pacer, uint32_t now, bool keysWaiting = false) {
+  pacer.beginPass(now);
+  pacer.endPass(keysWaiting);
+}
+
+TEST(input_events, IdleLoopWakesRarely) {
+  InputPacer pacer;
+  pass(pacer, 5000);
+  EXPECT_EQ(pacer.waitMs(5000), (uint32_t)INPUT_IDLE_MS);
+  EXPECT_EQ(pacer.waitMs(5400), INPUT_IDLE_MS - 400u);
+  EXPECT_EQ(pacer.waitMs(7000), 0u);  // overdue
+  EXPECT_FALSE(pacer.active(5000));
+}
+
+TEST(input_events, InputKeepsTheOldPeriodForAWhile) {
+  InputPacer pacer;
+  pass(pacer, 1000);
+  pacer.seen(1010);
+  pass(pacer, 1010);
+  EXPECT_TRUE(pacer.active(1010));
+  EXPECT_EQ(pacer.waitMs(1010), (uint32_t)INPUT_POLL_MS);
+
+  pass(pacer, 1010 + INPUT_ACTIVE_MS - 10);
+  EXPECT_EQ(pacer.waitMs(1010 + INPUT_ACTIVE_MS - 10), (uint32_t)INPUT_POLL_MS);  // still active
+  pass(pacer, 1010 + INPUT_ACTIVE_MS);
+  EXPECT_EQ(pacer.waitMs(1010 + INPUT_ACTIVE_MS), (uint32_t)INPUT_IDLE_MS);
+}
+
+TEST(input_events, BurstOfKeysDoesNotWait) {
+  InputPacer pacer;
+  pacer.seen(100);
+  pass(pacer, 100, true);
+  EXPECT_EQ(pacer.waitMs(100), 0u);
+  pass(pacer, 101, true);
+  EXPECT_EQ(pacer.waitMs(101), 0u);
+  pass(pacer, 102, false);  // drained
+  EXPECT_EQ(pacer.waitMs(102), (uint32_t)INPUT_POLL_MS);
+}
+
+TEST(input_events, AppsAskForTheirNextPass) {
+  InputPacer pacer;
+  pacer.beginPass(10000);
+  pacer.wakeAt(15000);  // typing timeout
+  pacer.wakeAt(10400);  // blink, earlier wins
+  pacer.wakeAt(12000);
+  pacer.endPass(false);
+  EXPECT_EQ(pacer.waitMs(10000), 400u);
+
+  // served by the pass at 10400, the later requests were dropped with it
+  pass(pacer, 10400);
+  EXPECT_EQ(pacer.waitMs(10400), (uint32_t)INPUT_IDLE_MS);
+
+  // a pass woken early by a key keeps the request
+  pacer.wakeAt(11000);
+  pacer.seen(10500);
+  pass(pacer, 10500);
+  EXPECT_EQ(pacer.waitMs(10500), (uint32_t)INPUT_POLL_MS);
+  pass(pacer, 10550);
+  pacer.seen(0);  // long ago
+  EXPECT_EQ(pacer.waitMs(10550), 450u);
+}
+
+TEST(input_events, MillisWrapAround) {
+  InputPacer pacer;
+  const uint32_t now = 0xFFFFFF00u;
+  pass(pacer, now);
+  pacer.wakeAt(now + 0x200);  // past the wrap
+  EXPECT_EQ(pacer.waitMs(now), 0x200u);
+  pacer.seen(now);
+  EXPECT_EQ(pacer.waitMs(now + 0x10), INPUT_POLL_MS - 0x10u);
+  EXPECT_TRUE(pacer.active(now + 0x180));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
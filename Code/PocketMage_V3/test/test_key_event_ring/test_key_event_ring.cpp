@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <keyEventRing.h>
+
+static KeyEvent key(uint8_t code, bool pressed = true, uint32_t ms = 0) {
+  KeyEvent e;
+  e.keyCode = code;
+  e.pressed = pressed;
+  e.ms      = ms;
+  return e;
+}
+
+TEST(key_event_ring, KeepsOrderAndEveryField) {
+  KeyEventRing<8> ring;
+  KeyEvent e;
+  EXPECT_FALSE(ring.pop(e));
+
+  KeyEvent shiftA = key(0x04, true, 1234);
+  shiftA.modifiers = 0x02;
+  ring.push(shiftA);
+  ring.push(key(0x04, false, 1300));
+  EXPECT_EQ(ring.size(), 2u);
+
+  ASSERT_TRUE(ring.pop(e));
+  EXPECT_EQ(e.keyCode, 0x04);
+  EXPECT_EQ(e.modifiers, 0x02);
+  EXPECT_TRUE(e.pressed);
+  EXPECT_EQ(e.ms, 1234u);
+  ASSERT_TRUE(ring.pop(e));
+  EXPECT_FALSE(e.pressed);
+  EXPECT_EQ(e.ms, 1300u);
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(key_event_ring, FullRingDropsTheNewEvent) {
+  KeyEventRing<4> ring;
+  for (uint8_t i = 0; i < 6; i++) ring.push(key(i));
+  EXPECT_EQ(ring.dropped(), 2u);
+  EXPECT_EQ(ring.highWater(), 4u);
+
+  // what was queued is kept, in order
+  KeyEvent e;
+  for (uint8_t i = 0; i < 4; i++) {
+    ASSERT_TRUE(ring.pop(e));
+    EXPECT_EQ(e.keyCode, i);
+  }
+  EXPECT_FALSE(ring.pop(e));
+
+  // wraps around the end
+  for (uint8_t i = 10; i < 13; i++) EXPECT_TRUE(ring.push(key(i)));
+  for (uint8_t i = 10; i < 13; i++) {
+    ASSERT_TRUE(ring.pop(e));
+    EXPECT_EQ(e.keyCode, i);
+  }
+  EXPECT_EQ(ring.dropped(), 2u);
+}
+
+TEST(key_event_ring, HidTaskAndLoopRunTogether) {
+  // the HID callback pushing as fast as a keyboard can't, the loop draining it
+  KeyEventRing<KB_USB_EVENTS> ring;
+  const uint32_t events = 200000;
+  uint32_t full = 0;
+  std::thread hid([&] {
+    for (uint32_t i = 0; i < events; i++) {
+      while (!ring.push(key((uint8_t)i, i & 1, i))) {
+        full++;
+        std::this_thread::yield();
+      }
+    }
+  });
+  uint32_t next = 0;
+  while (next < events) {
+    KeyEvent e;
+    if (!ring.pop(e)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(e.ms, next);  // none lost, none out of order
+    ASSERT_EQ(e.keyCode, (uint8_t)next);
+    ASSERT_EQ(e.pressed, (bool)(next & 1));
+    next++;
+  }
+  hid.join();
+  EXPECT_EQ(ring.dropped(), full);
+  EXPECT_LE(ring.highWater(), (uint32_t)KB_USB_EVENTS);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
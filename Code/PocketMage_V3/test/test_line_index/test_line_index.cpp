@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <lineIndex.h>
+
+// Naive model: what refreshAllLineIndexes() used to compute on every edit
+struct NaiveIndex {
+  std::vector<uint16_t> counts;
+  uint32_t firstLine(size_t block) const {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < block; i++) sum += counts[i];
+    return sum;
+  }
+  size_t blockAt(uint32_t line) const {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+      sum += counts[i];
+      if (sum > line) return i;
+    }
+    return counts.size();
+  }
+};
+
+static void expectSame(const LineIndex& idx, const NaiveIndex& ref) {
+  ASSERT_EQ(idx.size(), ref.counts.size());
+  for (size_t b = 0; b <= ref.counts.size(); b++) ASSERT_EQ(idx.firstLine(b), ref.firstLine(b));
+  const uint32_t total = ref.firstLine(ref.counts.size());
+  ASSERT_EQ(idx.total(), total);
+  for (uint32_t l = 0; l <= total; l++) ASSERT_EQ(idx.blockAt(l), ref.blockAt(l)) << "line " << l;
+}
+
+TEST(line_index, MatchesLinearScanUnderEdits) {
+  std::mt19937 rng(1234);
+  LineIndex idx;
+  NaiveIndex ref;
+  idx.clear();
+
+  for (int step = 0; step < 2000; step++) {
+    const uint16_t lines = rng() % 4;  // blank lines have 0
+    switch (rng() % 4) {
+      case 0:
+        idx.push_back(lines);
+        ref.counts.push_back(lines);
+        break;
+      case 1: {
+        size_t at = ref.counts.empty() ? 0 : rng() % ref.counts.size();
+        idx.insert(at, lines);
+        ref.counts.insert(ref.counts.begin() + at, lines);
+        break;
+      }
+      case 2:
+        if (!ref.counts.empty()) {
+          size_t at = rng() % ref.counts.size();
+          idx.set(at, lines);
+          ref.counts[at] = lines;
+        }
+        break;
+      case 3:
+        if (!ref.counts.empty()) {
+          size_t at = rng() % ref.counts.size();
+          idx.erase(at);
+          ref.counts.erase(ref.counts.begin() + at);
+        }
+        break;
+    }
+    if (step % 100 == 0) expectSame(idx, ref);
+  }
+  expectSame(idx, ref);
+
+  LineIndex rebuilt;
+  rebuilt.rebuild(ref.counts.size(), [&](size_t i) { return ref.counts[i]; });
+  expectSame(rebuilt, ref);
+}
+
+TEST(line_index, SkipsBlankBlocks) {
+  LineIndex idx;
+  const uint16_t counts[] = {0, 2, 0, 0, 1};
+  idx.rebuild(5, [&](size_t i) { return counts[i]; });
+  EXPECT_EQ(idx.blockAt(0), 1u);
+  EXPECT_EQ(idx.blockAt(1), 1u);
+  EXPECT_EQ(idx.blockAt(2), 4u);
+  EXPECT_EQ(idx.blockAt(3), 5u);  // past the end
+  EXPECT_EQ(idx.firstLine(4), 2u);
+}
+
+// Per keystroke work: word wrap on the last paragraph, then scroll to it
+static long long typingCost(size_t paragraphs, bool incremental) {
+  using clock = std::chrono::steady_clock;
+  const int keystrokes = 2000;
+  NaiveIndex ref;
+  ref.counts.assign(paragraphs, 3);
+  LineIndex idx;
+  idx.rebuild(paragraphs, [](size_t) { return (uint16_t)3; });
+
+  volatile uint32_t sink = 0;
+  auto t0 = clock::now();
+  for (int k = 0; k < keystrokes; k++) {
+    const size_t last = paragraphs - 1;
+    const uint16_t lines = 3 + (k & 1);
+    if (incremental) {
+      idx.set(last, lines);
+      sink = sink + idx.firstLine(last) + idx.blockAt(idx.total() / 2);
+    } else {
+      ref.counts[last] = lines;
+      sink = sink + ref.firstLine(last) + ref.blockAt(ref.firstLine(paragraphs) / 2);
+    }
+  }
+  auto t1 = clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / keystrokes;
+}
+
+TEST(line_index, BenchmarkTypingLatency) {
+  const long long small = typingCost(20, true);
+  const long long large = typingCost(5000, true);
+  const long long naive = typingCost(5000, false);
+  printf("[ BENCH    ] per keystroke: 20 lines %lld ns, 5000 lines %lld ns, full walk %lld ns\n",
+         small, large, naive);
+  EXPECT_LT(large, naive);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <markdownParse.h>
+
+struct Word {
+  size_t start, len;
+  uint8_t attr;
+  bool operator==(const Word& o) const {
+    return start == o.start && len == o.len && attr == o.attr;
+  }
+};
+
+struct Parsed {
+  char style;
+  std::string text, attrs;
+  std::vector<Word> words;
+};
+
+static Parsed parse(const std::string& line) {
+  Parsed p;
+  MdBlock b = classifyMarkdownLine(line.data(), line.size());
+  p.style = b.style;
+  size_t n = parseMarkdownInline(
+      line.data() + b.start, b.len,
+      [&](const char* s, size_t len, uint8_t attr) {
+        p.text.append(s, len);
+        p.attrs.append(len, (char)('0' + attr));
+      },
+      [&](size_t start, size_t len, uint8_t attr) { p.words.push_back({start, len, attr}); });
+  EXPECT_EQ(n, p.text.size());
+  return p;
+}
+
+// The String based parser TXT used before, kept as the reference
+static Parsed reference(std::string line) {
+  auto starts = [&](const char* p) { return line.compare(0, strlen(p), p) == 0; };
+  auto ends = [&](const char* p) {
+    size_t n = strlen(p);
+    return line.size() >= n && line.compare(line.size() - n, n, p) == 0;
+  };
+  size_t b = 0, e = line.size();
+  while (b < e && isspace((unsigned char)line[b])) b++;
+  while (e > b && isspace((unsigned char)line[e - 1])) e--;
+  line = line.substr(b, e - b);
+
+  Parsed p;
+  p.style = 'T';
+  std::string content = line;
+  if (line.empty()) p.style = 'B';
+  else if (starts("### ")) { p.style = '3'; content = line.substr(4); }
+  else if (starts("## ")) { p.style = '2'; content = line.substr(3); }
+  else if (starts("# ")) { p.style = '1'; content = line.substr(2); }
+  else if (starts("> ")) { p.style = '>'; content = line.substr(2); }
+  else if (starts("- ")) { p.style = '-'; content = line.substr(2); }
+  else if (line == "---") p.style = 'H';
+  else if (starts("```")) { p.style = 'C'; content = line.substr(3); }
+  else if (starts("`") && ends("`")) {
+    p.style = 'C';
+    if (line.size() >= 2) content = line.substr(1, line.size() - 2);
+  } else if (line.size() > 2 && isdigit((unsigned char)line[0]) && line[1] == '.' && line[2] == ' ') {
+    p.style = 'L';
+    content = line.substr(3);
+  }
+
+  uint8_t attr = 0;
+  for (size_t i = 0; i < content.size();) {
+    if (content[i] == '*') {
+      size_t run = 1;
+      while (run < 3 && i + run < content.size() && content[i + run] == '*') run++;
+      attr ^= (run == 3) ? (MD_BOLD | MD_ITALIC) : (run == 2) ? MD_BOLD : MD_ITALIC;
+      i += run;
+      continue;
+    }
+    p.text += content[i++];
+    p.attrs += (char)('0' + attr);
+  }
+  for (size_t i = 0; i < p.text.size();) {
+    if (p.text[i] == ' ') {
+      i++;
+      continue;
+    }
+    size_t end = i + 1;
+    while (end < p.text.size() && p.text[end] != ' ' && p.attrs[end] == p.attrs[i]) end++;
+    p.words.push_back({i, end - i, (uint8_t)(p.attrs[i] - '0')});
+    i = end;
+  }
+  return p;
+}
+
+static void expectSame(const std::string& line) {
+  Parsed got = parse(line), want = reference(line);
+  EXPECT_EQ(got.style, want.style) << line;
+  EXPECT_EQ(got.text, want.text) << line;
+  EXPECT_EQ(got.attrs, want.attrs) << line;
+  EXPECT_TRUE(got.words == want.words) << line;
+}
+
+TEST(markdown_parse, BlockStyles) {
+  EXPECT_EQ(parse("# Title").style, '1');
+  EXPECT_EQ(parse("## Title").style, '2');
+  EXPECT_EQ(parse("### Title").style, '3');
+  EXPECT_EQ(parse("#### Title").style, 'T');
+  EXPECT_EQ(parse("> quote").style, '>');
+  EXPECT_EQ(parse("- item").style, '-');
+  EXPECT_EQ(parse("7. item").style, 'L');
+  EXPECT_EQ(parse("```code").style, 'C');
+  EXPECT_EQ(parse("`code`").style, 'C');
+  EXPECT_EQ(parse("---").style, 'H');
+  EXPECT_EQ(parse("  \t\r").style, 'B');
+  EXPECT_EQ(parse("plain").style, 'T');
+  EXPECT_EQ(parse("## Title").text, "Title");
+  EXPECT_EQ(parse("`code`").text, "code");
+}
+
+TEST(markdown_parse, Emphasis) {
+  Parsed p = parse("a **bold** *it* ***both*** x");
+  EXPECT_EQ(p.text, "a bold it both x");
+  EXPECT_EQ(p.attrs, "0011110220333300");
+  ASSERT_EQ(p.words.size(), 5u);
+  EXPECT_TRUE((p.words[1] == Word{2, 4, MD_BOLD}));
+  EXPECT_TRUE((p.words[3] == Word{10, 4, MD_BOLD | MD_ITALIC}));
+
+  // A format change inside a word splits it
+  p = parse("he**llo**");
+  ASSERT_EQ(p.words.size(), 2u);
+  EXPECT_TRUE((p.words[1] == Word{2, 3, MD_BOLD}));
+}
+
+TEST(markdown_parse, MatchesReferenceOnRandomLines) {
+  std::mt19937 rng(7);
+  const char alphabet[] = "ab *#>-`1. \t";
+  for (int i = 0; i < 20000; i++) {
+    std::string line;
+    const size_t n = rng() % 24;
+    for (size_t c = 0; c < n; c++) line += alphabet[rng() % (sizeof(alphabet) - 1)];
+    expectSame(line);
+  }
+}
+
+TEST(markdown_parse, PathologicalLines) {
+  std::string stars, alternating, words;
+  for (int i = 0; i < 4096; i++) stars += '*';
+  for (int i = 0; i < 2048; i++) alternating += "*a";
+  for (int i = 0; i < 1024; i++) words += "**b** ";
+  expectSame(stars);
+  expectSame(alternating);
+  expectSame(words);
+  expectSame("- " + alternating);
+}
+
+// ---------- Benchmark ----------
+
+static double nsPerByte(const std::string& line, int reps) {
+  double best = 1e30;
+  for (int r = 0; r < 5; r++) {
+    size_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) {
+      MdBlock b = classifyMarkdownLine(line.data(), line.size());
+      sink += parseMarkdownInline(
+          line.data() + b.start, b.len, [&](const char*, size_t n, uint8_t) { sink += n; },
+          [&](size_t, size_t n, uint8_t) { sink += n; });
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    EXPECT_GT(sink, 0u);
+    best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+  }
+  return best / reps / line.size();
+}
+
+TEST(markdown_parse, BenchmarkIsLinear) {
+  auto alternating = [](size_t bytes) {
+    std::string s;
+    while (s.size() < bytes) s += "*a";
+    return s;
+  };
+  const std::string small = alternating(4096), large = alternating(64 * 1024);
+  const double smallNs = nsPerByte(small, 400), largeNs = nsPerByte(large, 25);
+  printf("markdown_parse: 4 KB alternating '*': %.2f ns/byte, 64 KB: %.2f ns/byte\n", smallNs,
+         largeNs);
+
+  std::string prose;
+  while (prose.size() < 4096) prose += "The **quick** brown *fox* jumps over the ***lazy*** dog. ";
+  printf("markdown_parse: 4 KB prose: %.2f ns/byte\n", nsPerByte(prose, 400));
+
+  // 16x the input at the same cost per byte, a quadratic scan would be ~16x per byte
+  EXPECT_LT(largeNs, smallNs * 4);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
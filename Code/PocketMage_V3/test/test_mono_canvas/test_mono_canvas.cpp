@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+
+#define PROGMEM
+#include <monoCanvas.h>
+#include <wordWrap.h>
+#include <Fonts/FreeSerif9pt8b.h>
+#include <Fonts/FreeMonoBold9pt8b.h>
+
+// A status bar and a page of wrapped text as workloads, the firmware's own screens are
+// compared to golden images in test_screens
+static void drawStatusBar(MonoCanvas& d, const char* text) {
+  d.fillRect(0, d.height() - 26, d.width(), 26, GxEPD_WHITE);
+  d.drawRect(0, d.height() - 20, d.width(), 20, GxEPD_BLACK);
+  d.setFont(&FreeMonoBold9pt8b);
+  d.setCursor(4, d.height() - 6);
+  d.print(text);
+}
+
+static void drawNote(MonoCanvas& d, const std::string& text) {
+  const GFXfont* font = &FreeSerif9pt8b;
+  const int fontHeight = fontMetrics(font).bounds("H").h, spacing = 6;
+  d.setFullWindow();
+  d.fillScreen(GxEPD_WHITE);
+  d.setFont(font);
+  int row = 0;
+  wrapText(text.data(), text.size(), fontMetrics(font), d.width() - 5,
+           [&](const char* s, size_t n, uint8_t) {
+             d.setCursor(0, fontHeight + (fontHeight + spacing) * row++);
+             d.write((const uint8_t*)s, n);
+           });
+  drawStatusBar(d, "note.txt  142 words");
+}
+
+static const char* NOTE =
+    "PocketMage keeps notes on the SD card and shows them on a 3.1\" e-ink panel. "
+    "Lines wrap at the last space that fits, long words are cut.\n\n"
+    "Supercalifragilisticexpialidocious-and-then-some words still fit.\n"
+    "Accents: \xe9t\xe9, stra\xdf" "e, na\xefve.";
+
+TEST(mono_canvas, TextBoundsMatchFontMetrics) {
+  MonoCanvas d;
+  for (const GFXfont* f : {&FreeSerif9pt8b, &FreeMonoBold9pt8b}) {
+    d.setFont(f);
+    for (const char* s : {"H", "hello world", "(draft) e-ink 42!", "\xe9t\xe9", " "}) {
+      int16_t x1, y1;
+      uint16_t w, h;
+      d.getTextBounds(s, 0, 0, &x1, &y1, &w, &h);
+      const TextBounds b = fontMetrics(f).bounds(s);
+      EXPECT_EQ(x1, b.x1) << s;
+      EXPECT_EQ(y1, b.y1) << s;
+      EXPECT_EQ(w, b.w) << s;
+      EXPECT_EQ(h, b.h) << s;
+    }
+  }
+}
+
+TEST(mono_canvas, InkStaysInsideTextBounds) {
+  MonoCanvas d;
+  d.setFont(&FreeSerif9pt8b);
+  const char* s = "Quick (brown) fox, jumpy!";
+  d.setCursor(20, 40);
+  d.print(s);
+  EXPECT_GT(d.blackPixels(), 0u);
+  int16_t x1, y1;
+  uint16_t w, h;
+  d.getTextBounds(s, 20, 40, &x1, &y1, &w, &h);
+  for (int y = 0; y < d.height(); y++)
+    for (int x = 0; x < d.width(); x++)
+      if (d.pixel(x, y)) {
+        ASSERT_GE(x, x1);
+        ASSERT_LT(x, x1 + w);
+        ASSERT_GE(y, y1);
+        ASSERT_LT(y, y1 + h);
+      }
+  // the cursor moved by the advances
+  EXPECT_EQ(d.getCursorX(), 20 + fontMetrics(&FreeSerif9pt8b).advance(s, strlen(s)));
+}
+
+TEST(mono_canvas, PartialWindowClipsAndAligns) {
+  MonoCanvas d;
+  d.setPartialWindow(10, 13, 50, 10);  // rows 8..24 once aligned
+  d.firstPage();
+  do {
+    d.fillRect(0, 0, d.width(), d.height(), GxEPD_BLACK);
+  } while (d.nextPage());
+
+  EXPECT_EQ(d.blackPixels(), 50u * 16u);
+  EXPECT_TRUE(d.pixel(10, 8));
+  EXPECT_FALSE(d.pixel(9, 8));
+  EXPECT_FALSE(d.pixel(10, 24));
+  ASSERT_EQ(d.refreshes().size(), 1u);
+  const CanvasRefresh& r = d.refreshes()[0];
+  EXPECT_EQ(r.x, 10);
+  EXPECT_EQ(r.y, 8);
+  EXPECT_EQ(r.w, 50);
+  EXPECT_EQ(r.h, 16);
+  EXPECT_FALSE(r.full);
+  EXPECT_EQ(r.changed, 50u * 16u);
+}
+
+TEST(mono_canvas, RefreshCountsChangedPixels) {
+  MonoCanvas d;
+  drawNote(d, NOTE);
+  const uint32_t ink = d.blackPixels();
+  d.display(false);
+  d.display(true);  // nothing new
+  ASSERT_EQ(d.refreshes().size(), 2u);
+  EXPECT_TRUE(d.refreshes()[0].full);
+  EXPECT_EQ(d.refreshes()[0].changed, ink);
+  EXPECT_EQ(d.refreshes()[1].changed, 0u);
+
+  // new status text only changes pixels at the bottom
+  d.clearRefreshes();
+  drawStatusBar(d, "saved");
+  d.displayWindow(0, d.height() - 20, d.width(), 20);
+  d.display(true);
+  ASSERT_EQ(d.refreshes().size(), 2u);
+  EXPECT_GT(d.refreshes()[0].changed, 0u);
+  EXPECT_EQ(d.refreshes()[1].changed, 0u);
+}
+
+TEST(mono_canvas, PbmRoundTrip) {
+  MonoCanvas d, back;
+  drawNote(d, NOTE);
+  const std::string path = testing::TempDir() + "mono_canvas.pbm";
+  ASSERT_TRUE(d.writePBM(path.c_str()));
+  ASSERT_TRUE(back.readPBM(path.c_str()));
+  EXPECT_EQ(back.bits(), d.bits());
+  EXPECT_FALSE(back.readPBM("/nonexistent/screen.pbm"));
+}
+
+TEST(mono_canvas, CirclesAndRoundRects) {
+  MonoCanvas d;
+  d.fillCircle(50, 50, 10, GxEPD_BLACK);
+  EXPECT_TRUE(d.pixel(50, 40));
+  EXPECT_TRUE(d.pixel(60, 50));
+  EXPECT_FALSE(d.pixel(50, 39));
+  EXPECT_FALSE(d.pixel(58, 42));  // outside the arc
+  EXPECT_EQ(d.blackPixels(), 349u);
+
+  d.fillScreen(GxEPD_WHITE);
+  d.drawRoundRect(100, 100, 40, 20, 5, GxEPD_BLACK);
+  EXPECT_TRUE(d.pixel(105, 100));
+  EXPECT_TRUE(d.pixel(100, 105));
+  EXPECT_TRUE(d.pixel(139, 114));
+  EXPECT_FALSE(d.pixel(100, 100));  // corners are rounded off
+  EXPECT_FALSE(d.pixel(139, 119));
+  EXPECT_FALSE(d.pixel(120, 110));  // not filled
+}
+
+TEST(mono_canvas, BenchmarkRenderNote) {
+  using clock = std::chrono::steady_clock;
+  MonoCanvas d;
+  const int screens = 200;
+  auto t0 = clock::now();
+  for (int i = 0; i < screens; i++) drawNote(d, NOTE);
+  auto t1 = clock::now();
+  auto us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  printf("[ BENCH    ] note screen: %lld us per render\n", (long long)(us / screens));
+  EXPECT_GT(d.blackPixels(), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <oledCompositor.h>
+
+static OledPost line(const char* text, uint8_t flags = OLED_BAR) {
+  OledPost p;
+  p.layer = OLED_LINE;
+  p.flags = flags;
+  p.setText(text, true);
+  return p;
+}
+
+static OledPost toast(const char* text, uint32_t ms) {
+  OledPost p;
+  p.layer = OLED_TOAST;
+  p.flags = OLED_INFO;
+  p.ms    = ms;
+  p.setText(text);
+  return p;
+}
+
+TEST(oled_compositor, LongLinesKeepTheirEnd) {
+  std::string s(200, 'a');
+  s += "end";
+  OledPost p = line(s.c_str());
+  EXPECT_EQ(strlen(p.text), OLED_TEXT_LEN - 1u);
+  EXPECT_STREQ(p.text + OLED_TEXT_LEN - 4, "end");
+  p.setLabel(s.c_str());
+  EXPECT_EQ(strlen(p.label), OLED_LABEL_LEN - 1u);
+  EXPECT_EQ(p.label[0], 'a');
+}
+
+TEST(oled_compositor, MailboxKeepsOrderAndCountsDrops) {
+  OledMailbox<int, 4> box;
+  for (int i = 0; i < 6; i++) box.post(i);
+  EXPECT_EQ(box.dropped(), 2u);
+  int v;
+  for (int i = 0; i < 4; i++) {
+    ASSERT_TRUE(box.take(v));
+    EXPECT_EQ(v, i);
+  }
+  EXPECT_FALSE(box.take(v));
+  EXPECT_TRUE(box.post(9));
+  ASSERT_TRUE(box.take(v));
+  EXPECT_EQ(v, 9);
+}
+
+TEST(oled_compositor, MailboxTakesFromSeveralTasks) {
+  // the input loop, the e-ink task and an install task posting at once
+  OledMailbox<uint32_t, OLED_MAILBOX> box;
+  const uint32_t perTask = 5000;
+  std::atomic<uint32_t> full{0};
+  std::vector<std::thread> tasks;
+  for (uint32_t t = 0; t < 3; t++) {
+    tasks.emplace_back([&box, &full, t] {
+      for (uint32_t i = 0; i < perTask; i++) {
+        while (!box.post(t << 24 | i)) {
+          full++;
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  uint32_t next[3] = {0, 0, 0};
+  uint32_t got = 0;
+  while (got < 3 * perTask) {
+    uint32_t v;
+    if (!box.take(v)) {
+      std::this_thread::yield();
+      continue;
+    }
+    const uint32_t t = v >> 24;
+    ASSERT_LT(t, 3u);
+    ASSERT_EQ(v & 0xFFFFFF, next[t]);  // each task's posts in order, none lost
+    next[t]++;
+    got++;
+  }
+  for (std::thread& t : tasks) t.join();
+  EXPECT_EQ(box.dropped(), full.load());  // counted every time a task found it full
+}
+
+TEST(oled_compositor, FramesArePaced) {
+  OledScene scene;
+  EXPECT_EQ(scene.waitMs(0, 33), OLED_FOREVER);
+  scene.apply(line("a"), 100);
+  EXPECT_EQ(scene.waitMs(100, 33), 0u);  // the first frame goes right away
+  scene.drawn(100);
+
+  scene.apply(line("ab"), 110);
+  EXPECT_EQ(scene.waitMs(110, 33), 23u);
+  EXPECT_EQ(scene.waitMs(133, 33), 0u);
+  scene.drawn(133);
+
+  // the same line posted every pass changes nothing, only the clock is redrawn
+  scene.apply(line("ab"), 140);
+  EXPECT_EQ(scene.waitMs(140, 33), OLED_REFRESH_MS - 7);
+  OledPost noInfo = line("abc");
+  noInfo.setLabel("Input Filename");
+  scene.apply(noInfo, 150);
+  scene.drawn(166);
+  EXPECT_EQ(scene.waitMs(200, 33), OLED_FOREVER);
+}
+
+TEST(oled_compositor, LineEndWarningBlinks) {
+  OledScene scene;
+  OledPost p = line("almost full", OLED_BAR | OLED_WARN);
+  p.setLabel("no info bar");
+  scene.apply(p, 1000);
+  scene.drawn(1000);
+  EXPECT_EQ(scene.waitMs(1010, 33), 1200u - 1010u);
+  scene.drawn(1200);
+  EXPECT_EQ(scene.waitMs(1200, 33), 400u);
+}
+
+TEST(oled_compositor, ToastsExpireWithoutWaiting) {
+  OledScene scene;
+  scene.apply(line("typing"), 0);
+  scene.drawn(0);
+  scene.apply(toast("Saved", 2000), 100);
+  EXPECT_EQ(scene.waitMs(100, 33), 0u);
+  EXPECT_EQ(scene.top(100).layer, OLED_TOAST);
+  scene.drawn(100);
+
+  // nothing else posted: back to the line once it expires
+  EXPECT_EQ(scene.waitMs(200, 33), 1000u - 100u);  // the info bar clock
+  scene.drawn(1100);
+  EXPECT_EQ(scene.waitMs(1900, 33), 200u);
+  EXPECT_EQ(scene.top(2100).layer, OLED_LINE);
+  EXPECT_EQ(scene.waitMs(2100, 33), 0u);
+  scene.drawn(2100);
+  EXPECT_STREQ(scene.top(2100).text, "typing");
+}
+
+TEST(oled_compositor, TypingDismissesAToast) {
+  OledScene scene;
+  scene.apply(line("a"), 0);
+  scene.apply(toast("Saved", 5000), 0);
+  scene.drawn(0);
+
+  // shown for at least OLED_TOAST_MIN_MS
+  scene.apply(line("ab"), 100);
+  EXPECT_EQ(scene.top(100).layer, OLED_TOAST);
+  scene.apply(line("ab"), OLED_TOAST_MIN_MS);  // same line, not typing
+  EXPECT_EQ(scene.top(OLED_TOAST_MIN_MS).layer, OLED_TOAST);
+  scene.apply(line("abc"), OLED_TOAST_MIN_MS + 10);
+  EXPECT_EQ(scene.top(OLED_TOAST_MIN_MS + 10).layer, OLED_LINE);
+
+  // a zero length toast takes one down
+  scene.apply(toast("Loading", 60000), 1000);
+  EXPECT_EQ(scene.top(1000).layer, OLED_TOAST);
+  scene.apply(toast("", 0), 1001);
+  EXPECT_EQ(scene.top(1001).layer, OLED_LINE);
+}
+
+TEST(oled_compositor, CustomFramesAlwaysRedraw) {
+  OledScene scene;
+  OledPost custom;
+  custom.layer = OLED_CUSTOM;
+  scene.apply(custom, 0);
+  scene.drawn(0);
+  EXPECT_EQ(scene.waitMs(40, 33), OLED_FOREVER);  // no info bar of ours to refresh
+  scene.apply(custom, 50);
+  EXPECT_EQ(scene.waitMs(50, 33), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
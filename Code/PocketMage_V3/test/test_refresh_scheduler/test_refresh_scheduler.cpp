@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <refreshScheduler.h>
+
+static const uint32_t TEXT_PX = RefreshScheduler::estimate(REFRESH_TEXT);
+static const uint32_t ROW_PX  = 320 * 24;
+
+static RefreshScheduler makeScheduler(uint8_t fullRefreshAfter = 5) {
+  RefreshScheduler s;
+  s.setBudgets(fullRefreshAfter * TEXT_PX, 20 * ROW_PX);
+  return s;
+}
+
+TEST(refresh_scheduler, TextMatchesFullRefreshAfter) {
+  // same pattern as the old counter: N fast updates, then a slow one
+  RefreshScheduler s = makeScheduler();
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 5; i++) EXPECT_FALSE(s.full(REFRESH_TEXT, false).slow) << round << i;
+    EXPECT_TRUE(s.full(REFRESH_TEXT, false).slow) << round;
+  }
+  EXPECT_EQ(s.fastCount(), 15u);
+  EXPECT_EQ(s.slowCount(), 3u);
+}
+
+TEST(refresh_scheduler, HeavierHintsCleanUpSooner) {
+  RefreshScheduler menu = makeScheduler(), image = makeScheduler();
+  int menuFast = 0, imageFast = 0;
+  while (!menu.full(REFRESH_MENU, false).slow) menuFast++;
+  while (!image.full(REFRESH_IMAGE, false).slow) imageFast++;
+  EXPECT_EQ(menuFast, 3);
+  EXPECT_EQ(imageFast, 2);
+}
+
+TEST(refresh_scheduler, SmallChangesRarelyNeedSlowUpdates) {
+  RefreshScheduler s = makeScheduler();
+  for (int i = 0; i < 100; i++) EXPECT_FALSE(s.full(REFRESH_TEXT, false, 900).slow) << i;
+  EXPECT_EQ(s.fullGhost(), 90000u);
+}
+
+TEST(refresh_scheduler, ForcedSlowUpdateClearsGhosting) {
+  RefreshScheduler s = makeScheduler();
+  s.full(REFRESH_IMAGE, false);
+  RefreshDecision d = s.full(REFRESH_TEXT, true);
+  EXPECT_TRUE(d.slow);
+  EXPECT_EQ(d.ghost, RefreshScheduler::SCREEN_PX);
+  EXPECT_EQ(s.fullGhost(), 0u);
+  EXPECT_FALSE(s.full(REFRESH_TEXT, false).slow);
+}
+
+TEST(refresh_scheduler, PartialBudgetClearedByAnyFullUpdate) {
+  RefreshScheduler s = makeScheduler();
+  for (int i = 0; i < 20; i++) {
+    EXPECT_TRUE(s.partialAllowed()) << i;
+    s.partial(ROW_PX);
+  }
+  EXPECT_FALSE(s.partialAllowed());
+  // partial windows don't count toward the slow update
+  EXPECT_FALSE(s.full(REFRESH_TEXT, false).slow);
+  EXPECT_TRUE(s.partialAllowed());
+  EXPECT_EQ(s.partialCount(), 20u);
+
+  // windows that change little last longer
+  for (int i = 0; i < 200; i++) s.partial(ROW_PX / 20);
+  EXPECT_TRUE(s.partialAllowed());
+}
+
+TEST(refresh_scheduler, CoalescesQueuedRequests) {
+  RefreshScheduler s = makeScheduler();
+  EXPECT_FALSE(s.due(0, 150, 600));
+  s.request(REFRESH_TEXT, 1000);
+  s.request(REFRESH_MENU, 1100);
+  s.request(REFRESH_TEXT, 1200);
+  EXPECT_TRUE(s.pending());
+  EXPECT_FALSE(s.due(1300, 150, 600));
+  EXPECT_EQ(s.dueIn(1300, 150, 600), 50u);
+  EXPECT_TRUE(s.due(1350, 150, 600));
+  EXPECT_EQ(s.dueIn(1350, 150, 600), 0u);
+
+  RefreshDecision d = s.full(REFRESH_TEXT, false);
+  EXPECT_EQ(d.hint, REFRESH_MENU);
+  EXPECT_EQ(d.coalesced, 3);
+  EXPECT_FALSE(s.pending());
+  EXPECT_EQ(s.fullGhost(), RefreshScheduler::estimate(REFRESH_MENU));
+
+  // an immediate update with nothing queued coalesces nothing
+  EXPECT_EQ(s.full(REFRESH_TEXT, false).coalesced, 0);
+}
+
+TEST(refresh_scheduler, SteadyRequestsStillGoOut) {
+  RefreshScheduler s = makeScheduler();
+  uint32_t now = 0xFFFFFF00;  // millis() wraps on the way
+  s.request(REFRESH_TEXT, now);
+  int asked = 0;
+  while (!s.due(now, 150, 600)) {
+    EXPECT_EQ(s.dueIn(now, 150, 600), asked < 5 ? 150u : 100u);  // then the max wait is closer
+    now += 100;
+    s.request(REFRESH_TEXT, now);
+    asked++;
+  }
+  EXPECT_EQ(asked, 6);
+}
+
+TEST(refresh_scheduler, DroppedAndCleanedFramesAreForgotten) {
+  RefreshScheduler s = makeScheduler();
+  s.request(REFRESH_IMAGE, 0);
+  s.drop();
+  EXPECT_FALSE(s.pending());
+  EXPECT_EQ(s.dropped(), 1u);
+  EXPECT_EQ(s.full(REFRESH_TEXT, false).hint, REFRESH_TEXT);
+
+  s.request(REFRESH_MENU, 0);
+  s.partial(ROW_PX);
+  s.cleaned();
+  EXPECT_FALSE(s.pending());
+  EXPECT_EQ(s.fullGhost(), 0u);
+  EXPECT_EQ(s.partialGhost(), 0u);
+}
+
+TEST(refresh_scheduler, SkippedAndPartialUpdatesTakeTheQueue) {
+  RefreshScheduler s = makeScheduler();
+  s.request(REFRESH_MENU, 0);
+  s.request(REFRESH_TEXT, 10);
+  EXPECT_EQ(s.hintWith(REFRESH_TEXT), REFRESH_MENU);
+  s.skip();
+  EXPECT_FALSE(s.pending());
+  EXPECT_EQ(s.skippedCount(), 1u);
+  EXPECT_EQ(s.hintWith(REFRESH_TEXT), REFRESH_TEXT);
+
+  s.request(REFRESH_TEXT, 20);
+  s.request(REFRESH_TEXT, 30);
+  EXPECT_EQ(s.take(), 2);
+  EXPECT_EQ(s.take(), 0);
+  EXPECT_EQ(s.fastCount() + s.slowCount(), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <textSource.h>
+
+template<class Src>
+static std::string lineAt(const Src& src, size_t i) {
+  LineView lv = src.line(i);
+  EXPECT_EQ(lv.ptr[lv.len], '\0');
+  return std::string(lv.ptr, lv.len);
+}
+
+static void push(RingArenaSource<8, 64>& src, const std::string& s, uint8_t flags = LF_NONE) {
+  src.pushLine(s.data(), (uint16_t)s.size(), flags);
+}
+
+TEST(ring_source, KeepsLinesInOrder) {
+  RingArenaSource<8, 64> src;
+  EXPECT_EQ(src.size(), 0u);
+  push(src, "one");
+  push(src, "two", LF_RIGHT);
+  push(src, "");
+  ASSERT_EQ(src.size(), 3u);
+  EXPECT_EQ(lineAt(src, 0), "one");
+  EXPECT_EQ(lineAt(src, 1), "two");
+  EXPECT_EQ(src.line(1).flags, LF_RIGHT);
+  EXPECT_EQ(lineAt(src, 2), "");
+  // appending keeps line i the same line
+  EXPECT_EQ(src.version(), 0u);
+  EXPECT_EQ(src.pushed(), 3u);
+}
+
+TEST(ring_source, DropsOldestWhenLinesRunOut) {
+  RingArenaSource<8, 64> src;
+  for (int i = 0; i < 11; i++) push(src, std::to_string(i));
+  ASSERT_EQ(src.size(), 8u);
+  for (size_t i = 0; i < 8; i++) EXPECT_EQ(lineAt(src, i), std::to_string(i + 3));
+  EXPECT_EQ(src.evicted(), 3u);
+  EXPECT_EQ(src.version(), 3u);
+}
+
+TEST(ring_source, WrapsAroundTheBuffer) {
+  RingArenaSource<8, 64> src;
+  const std::string a(20, 'a'), b(20, 'b'), c(20, 'c'), d(30, 'd');
+  push(src, a);  // 0..21
+  push(src, b);  // 21..42
+  push(src, c);  // 42..63
+  ASSERT_EQ(src.size(), 3u);
+  EXPECT_EQ(src.version(), 0u);
+
+  // doesn't fit at the end, starts over at 0 once "a" and "b" are gone
+  push(src, d);
+  ASSERT_EQ(src.size(), 2u);
+  EXPECT_EQ(lineAt(src, 0), c);
+  EXPECT_EQ(lineAt(src, 1), d);
+  EXPECT_EQ(src.line(1).ptr, src.line(0).ptr - 42);
+  EXPECT_GT(src.version(), 0u);
+
+  push(src, "e");  // fits between d and c
+  ASSERT_EQ(src.size(), 3u);
+  EXPECT_EQ(lineAt(src, 0), c);
+  EXPECT_EQ(lineAt(src, 2), "e");
+}
+
+TEST(ring_source, CutsLinesLongerThanTheBuffer) {
+  RingArenaSource<8, 64> src;
+  push(src, "short");
+  push(src, std::string(100, 'x'));
+  ASSERT_EQ(src.size(), 1u);
+  EXPECT_EQ(lineAt(src, 0), std::string(63, 'x'));
+}
+
+TEST(ring_source, ClearStartsOver) {
+  RingArenaSource<8, 64> src;
+  push(src, "one");
+  const uint32_t v = src.version(), n = src.pushed();
+  src.clear();
+  EXPECT_EQ(src.size(), 0u);
+  EXPECT_GT(src.version(), v);
+  EXPECT_GT(src.pushed(), n);
+  push(src, "two");
+  EXPECT_EQ(lineAt(src, 0), "two");
+}
+
+TEST(ring_source, MatchesNewestLinesThatFit) {
+  std::mt19937 rng(5);
+  RingArenaSource<16, 256> src;
+  std::deque<std::string> want;
+  size_t wantBytes = 0;
+  uint32_t lastVersion = 0;
+  for (int i = 0; i < 5000; i++) {
+    std::string s(rng() % 70, (char)('a' + i % 26));
+    const size_t before = want.size();
+    src.pushLine(s.data(), (uint16_t)s.size());
+
+    // the ring holds the newest lines, never more than fit, and drops lines only when
+    // a good part of the buffer is in use
+    want.push_back(s);
+    wantBytes += s.size() + 1;
+    while (want.size() > src.size()) {
+      wantBytes -= want.front().size() + 1;
+      want.pop_front();
+    }
+    ASSERT_LE(src.size(), 16u);
+    ASSERT_LE(wantBytes, 256u);
+    if (src.size() <= before) {
+      ASSERT_TRUE(src.size() == 16 || wantBytes + 2 * 71 > 256) << i;
+    }
+    for (size_t l = 0; l < want.size(); l++) ASSERT_EQ(lineAt(src, l), want[l]) << i;
+
+    // lines were only dropped if version() says so
+    if (src.size() <= before) EXPECT_GT(src.version(), lastVersion);
+    else EXPECT_EQ(src.version(), lastVersion);
+    lastVersion = src.version();
+  }
+  EXPECT_EQ(src.pushed(), 5000u);
+  EXPECT_EQ(src.evicted(), 5000u - src.size());
+}
+
+TEST(ring_source, PushFromAnotherTask) {
+  RingArenaSource<32, 512> src;
+  std::thread writer([&] {
+    for (int i = 0; i < 20000; i++) {
+      const std::string s = "line " + std::to_string(i);
+      src.pushLine(s.data(), (uint16_t)s.size());
+    }
+  });
+  // a locked reader always sees consecutive lines
+  size_t checks = 0;
+  do {
+    bool consecutive = true;
+    src.lock();
+    for (size_t i = 1; i < src.size(); i++) {
+      const int a = std::stoi(lineAt(src, i - 1).substr(5));
+      const int b = std::stoi(lineAt(src, i).substr(5));
+      consecutive &= b == a + 1;
+    }
+    src.unlock();
+    ASSERT_TRUE(consecutive);
+    checks++;
+  } while (src.pushed() < 20000);
+  writer.join();
+  EXPECT_GT(checks, 0u);
+  EXPECT_EQ(lineAt(src, src.size() - 1), "line 19999");
+}
+
+TEST(ring_source, SnapshotOutlivesPushes) {
+  RingArenaSource<8, 64> src;
+  for (int i = 0; i < 6; i++) push(src, "line " + std::to_string(i), i == 3 ? LF_CENTER : LF_NONE);
+
+  SnapshotSource snap;
+  src.lock();
+  snap.take(src, 2, 5);
+  src.unlock();
+  EXPECT_EQ(snap.size(), 6u);
+  EXPECT_EQ(snap.version(), src.version());
+
+  // pushes that drop the copied lines from the ring don't touch the copy
+  for (int i = 6; i < 20; i++) push(src, "line " + std::to_string(i));
+  EXPECT_EQ(lineAt(snap, 2), "line 2");
+  EXPECT_EQ(lineAt(snap, 3), "line 3");
+  EXPECT_EQ(snap.line(3).flags, LF_CENTER);
+  EXPECT_EQ(lineAt(snap, 4), "line 4");
+  EXPECT_EQ(lineAt(snap, 5), "");  // outside the range
+  EXPECT_EQ(lineAt(snap, 1), "");
+
+  snap.take(src, 0, 100);  // clamped to the source
+  EXPECT_EQ(lineAt(snap, src.size() - 1), "line 19");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,26 @@
+// The firmware the screens draw through, built for the PC against test/native. Sources
+// whose file-local log tags share a name are in firmware_*.cpp
+#include "../../lib/PocketMage/src/pocketmage_eink.cpp"
+#include "../../lib/PocketMage/src/frames.cpp"
+#include "../../lib/PocketMage/src/pocketmage_sd.cpp"
+#include "../../lib/PocketMage/src/pocketmage_bz.cpp"
+#include "../../lib/PocketMage/src/libAssets.cpp"
+#include "../../lib/PocketMage/src/MP2722.cpp"
+#include "../../src/globals.cpp"
+#include "../../src/assets.cpp"
+
+// No keyboard, and the apps these screens don't open
+Adafruit_TCA8418 keypad;
+static PocketmageKB pm_kb(keypad);
+PocketmageKB& KB() { return pm_kb; }
+char PocketmageKB::updateKeypress() { return 0; }
+void PocketmageKB::postInput(uint8_t, uint8_t) {}
+void PocketmageKB::postInputFromISR(uint8_t) {}
+void setupKB(int) {}
+
+void HOME_INIT() {}
+void JOURNAL_INIT() {}
+void einkHandler(void*) {}
+void loadState(bool) {}
+String fileWizardMini(bool, String) { return ""; }
+String getCurrentJournal() { return "/journal/2026-10-16.txt"; }
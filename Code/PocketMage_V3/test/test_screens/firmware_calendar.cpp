@@ -0,0 +1,2 @@
+// The calendar app, its file-local names clash with TXT_NEW.cpp's
+#include "../../src/OS_APPS/CALENDAR.cpp"
@@ -0,0 +1,2 @@
+// pocketmage_clock.cpp on its own, its log tag shares a name with another source's
+#include "../../lib/PocketMage/src/pocketmage_clock.cpp"
@@ -0,0 +1,2 @@
+// pocketmage_sys.cpp on its own, its log tag shares a name with another source's
+#include "../../lib/PocketMage/src/pocketmage_sys.cpp"
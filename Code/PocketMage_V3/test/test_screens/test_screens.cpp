@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <stdlib.h>
+#include <string>
+
+// The TXT app, its editor state is checked directly. The rest of the firmware it draws
+// through is in firmware*.cpp
+#include "../../src/OS_APPS/TXT_NEW.cpp"
+
+namespace fsys = std::filesystem;
+
+static std::string here() {
+  std::string dir = __FILE__;
+  return dir.substr(0, dir.find_last_of('/') + 1);
+}
+
+// Golden images live next to this file. PM_UPDATE_GOLDEN=1 writes them instead of comparing
+static std::string goldenPath(const char* name, const char* ext = ".pbm") {
+  return here() + "golden/" + name + ext;
+}
+
+static void expectGolden(const MonoCanvas& got, const char* name) {
+  const std::string path = goldenPath(name);
+  if (getenv("PM_UPDATE_GOLDEN")) {
+    ASSERT_TRUE(got.writePBM(path.c_str())) << path;
+    return;
+  }
+  MonoCanvas want;
+  ASSERT_TRUE(want.readPBM(path.c_str())) << path << " missing, run with PM_UPDATE_GOLDEN=1";
+
+  int differ = 0, left = MonoCanvas::WIDTH, top = MonoCanvas::HEIGHT, right = -1, bottom = -1;
+  for (int y = 0; y < MonoCanvas::HEIGHT; y++) {
+    for (int x = 0; x < MonoCanvas::WIDTH; x++) {
+      if (got.pixel(x, y) == want.pixel(x, y)) continue;
+      differ++;
+      if (x < left) left = x;
+      if (x > right) right = x;
+      if (y < top) top = y;
+      if (y > bottom) bottom = y;
+    }
+  }
+  if (differ) got.writePBM(goldenPath(name, ".actual.pbm").c_str());
+  EXPECT_EQ(differ, 0) << name << ": pixels differ in [" << left << "," << top << " - " << right
+                       << "," << bottom << "], see " << goldenPath(name, ".actual.pbm");
+}
+
+// What the panel shows, after the refresh went through the shadow and the driver
+static const MonoCanvas& panel() { return display.epd2.screen; }
+
+static void writeFile(const char* path, const std::string& text) {
+  File f = SD_MMC.open(path, FILE_WRITE);
+  ASSERT_TRUE(f) << path;
+  f.write((const uint8_t*)text.data(), text.size());
+  f.close();
+}
+
+static const char* NOTE =
+    "# Field notes\n"
+    "PocketMage keeps notes on the SD card and shows them on a **3.1\" e-ink** panel. "
+    "Lines wrap at the last space that fits, *long words* are cut.\n"
+    "## Lists\n"
+    "- A list item long enough to wrap onto a second line under its bullet\n"
+    "- Numbers: 1, 22, 333 and 4444\n"
+    "> Quoted, ***bold italic*** too\n"
+    "Last line.\n";
+
+static const char* EVENTS =
+    "Dentist|20261007|09:00|1:00|NO|Bring forms\n"
+    "Standup|20261012|10:00|0:15|WEEKLY MO|\n"
+    "Rent|20261001|00:00|0:00|MONTHLY 1|\n"
+    "Launch|20261016|14:00|2:00|NO|PocketMage demo\n";
+
+// Each test gets a fresh SD card holding the font packs, and a white panel. The boot steps
+// are setupEink()'s without its tasks, refreshes then run on the caller
+class screens : public testing::Test {
+protected:
+  static void SetUpTestSuite() {
+    display.init(115200);
+    display.setRotation(3);
+    display.setFullWindow();
+    display.setTextColor(GxEPD_BLACK);
+    EINK().setTXTFont(&FreeMonoBold9pt7b);
+    EINK().setFullRefreshAfter(FULL_REFRESH_AFTER);
+  }
+
+  void SetUp() override {
+    const std::string sd = testing::TempDir() + "screens_sd";
+    fsys::remove_all(sd);
+    fsys::create_directories(sd + FONT_DIR);
+    fsys::create_directories(sd + "/sys");
+    for (const auto& pack : fsys::directory_iterator(here() + "../../../../Docs/Fonts (PMF)/"))
+      fsys::copy_file(pack.path(), sd + FONT_DIR + pack.path().filename().string());
+    nativeSdMount(sd);
+
+    CLOCK().getRTC().adjust(DateTime(2026, 10, 16, 9, 30, 0));
+    display.setFullWindow();
+    display.fillScreen(GxEPD_WHITE);
+    EINK().forceSlowFullUpdate(true);
+    EINK().refresh();
+    ASSERT_EQ(panel().blackPixels(), 0u);
+  }
+
+  static void openNote() {
+    writeFile("/note.txt", NOTE);
+    SD().setEditingFile("/note.txt");
+    TXT_INIT();
+  }
+  static void drawNote() {
+    ASSERT_TRUE(publishFrame());
+    einkHandler_TXT_NEW();
+  }
+};
+
+TEST_F(screens, StatusBar) {
+  EINK().drawStatusBar("Type Letter A-D:");
+  EINK().refresh();
+  expectGolden(panel(), "status_bar");
+}
+
+TEST_F(screens, TxtNote) {
+  openNote();
+  drawNote();
+  EXPECT_GT(panel().blackPixels(), 0u);
+  expectGolden(panel(), "txt_note");
+}
+
+// The note is laid out in the family it's drawn in, not the one before TXT_INIT()
+TEST_F(screens, TxtWidthsMatchFontStyle) {
+  fontStyle = sans;
+  openNote();
+  EXPECT_EQ(fontStyle, serif);
+  ASSERT_FALSE(docLines.empty());
+  for (DocLine& dl : docLines) {
+    for (const WordSpan& w : dl.words) {
+      const TextBounds b = pickMetrics(dl.style, w.bold(), w.italic())
+                               .bounds(dl.text.contiguous(w.start, w.len), w.len);
+      EXPECT_EQ(w.px, b.w) << std::string(dl.text.contiguous(w.start, w.len), w.len);
+    }
+  }
+}
+
+TEST_F(screens, TestFrame) {
+  std::vector<Frame*> frames = {&testTextScreen};
+  einkFramesDynamic(frames, true);
+  expectGolden(panel(), "test_frame");
+}
+
+TEST_F(screens, CalendarMonth) {
+  writeFile("/sys/events.txt", EVENTS);
+  CALENDAR_INIT();
+  einkHandler_CALENDAR();
+  expectGolden(panel(), "calendar_month");
+}
+
+// Timings depend on the machine, they're printed rather than checked
+TEST_F(screens, BenchmarkScreens) {
+  using clock = std::chrono::steady_clock;
+  const int runs = 20;
+  auto bench = [&](const char* name, const std::function<void()>& draw) {
+    auto t0 = clock::now();
+    for (int i = 0; i < runs; i++) draw();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - t0).count();
+    printf("[ BENCH    ] %s: %lld us per screen\n", name, (long long)(us / runs));
+  };
+
+  openNote();
+  bench("txt note", [] {
+    fullRefreshRequests++;
+    drawNote();
+  });
+
+  writeFile("/sys/events.txt", EVENTS);
+  CALENDAR_INIT();
+  bench("calendar month", [] {
+    newState = true;
+    einkHandler_CALENDAR();
+  });
+
+  std::vector<Frame*> frames = {&testTextScreen};
+  bench("test frame", [&] { einkFramesDynamic(frames, true); });
+  EXPECT_GT(panel().blackPixels(), 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include <shadowFrame.h>
+
+// The PocketMage panel: 240x320 native, drawn rotated to 320x240
+using Shadow = ShadowFrame<240, 320>;
+
+static void fillRect(Shadow& s, int x, int y, int w, int h, bool black = true) {
+  for (int j = y; j < y + h; j++)
+    for (int i = x; i < x + w; i++) s.drawPixel(i, j, black);
+}
+
+static Shadow* blankPanel() {
+  Shadow* s = new Shadow;
+  s->setRotation(3);
+  s->setFullWindow();
+  s->fill(false);
+  s->pushAll();
+  return s;
+}
+
+static bool covers(const std::vector<DirtyRect>& rects, int x, int y) {
+  for (const DirtyRect& r : rects)
+    if (x >= r.x && x < r.right() && y >= r.y && y < r.bottom()) return true;
+  return false;
+}
+
+TEST(shadow_frame, UnknownUntilFirstPush) {
+  Shadow s;
+  s.setRotation(3);
+  EXPECT_FALSE(s.known());
+  s.pushAll();
+  EXPECT_TRUE(s.known());
+  s.forget();
+  EXPECT_FALSE(s.known());
+}
+
+TEST(shadow_frame, SameFrameChangesNothing) {
+  Shadow* s = blankPanel();
+  fillRect(*s, 20, 30, 100, 12);
+  s->pushAll();
+  // redrawn from scratch, same content
+  s->fill(false);
+  fillRect(*s, 20, 30, 100, 12);
+  std::vector<DirtyRect> rects;
+  EXPECT_EQ(s->diff(rects, 2), 0u);
+  EXPECT_TRUE(rects.empty());
+  delete s;
+}
+
+TEST(shadow_frame, FindsTheChangedRow) {
+  Shadow* s = blankPanel();
+  EXPECT_EQ(s->width(), 320);
+  EXPECT_EQ(s->height(), 240);
+  fillRect(*s, 10, 50, 90, 11);
+
+  std::vector<DirtyRect> rects;
+  EXPECT_EQ(s->diff(rects, 2), 90u * 11u);
+  ASSERT_EQ(rects.size(), 1u);
+  const DirtyRect& r = rects[0];
+  EXPECT_EQ(r.x, 10);
+  EXPECT_EQ(r.w, 90);
+  EXPECT_EQ(r.y, 48);
+  EXPECT_EQ(r.bottom(), 64);
+  delete s;
+}
+
+TEST(shadow_frame, KeepsDistantChangesApart) {
+  Shadow* s = blankPanel();
+  fillRect(*s, 0, 20, 200, 10);    // a text row
+  fillRect(*s, 4, 225, 60, 10);    // the status bar
+  std::vector<DirtyRect> two, one;
+  const uint32_t changed = s->diff(two, 2);
+  EXPECT_EQ(changed, 200u * 10u + 60u * 10u);
+  ASSERT_EQ(two.size(), 2u);
+  EXPECT_LT(dirtyArea(two), 320L * 240L / 4);
+  EXPECT_EQ(s->diff(one, 1), changed);
+  ASSERT_EQ(one.size(), 1u);
+  for (int y : {20, 29, 225, 234}) {
+    EXPECT_TRUE(covers(two, 5, y)) << y;
+    EXPECT_TRUE(covers(one, 5, y)) << y;
+  }
+  delete s;
+}
+
+TEST(shadow_frame, PushedRegionIsNoLongerChanged) {
+  Shadow* s = blankPanel();
+  fillRect(*s, 0, 20, 200, 10);
+  fillRect(*s, 4, 225, 60, 10);
+  s->pushRegion(0, 224, 320, 16);  // displayWindow() of the status bar only
+  std::vector<DirtyRect> rects;
+  EXPECT_EQ(s->diff(rects, 2), 200u * 10u);
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_LT(rects[0].bottom(), 224);
+  delete s;
+}
+
+TEST(shadow_frame, DiffWithinAWindow) {
+  Shadow* s = blankPanel();
+  fillRect(*s, 0, 20, 200, 10);
+  fillRect(*s, 4, 225, 60, 10);
+  std::vector<DirtyRect> rects;
+  EXPECT_EQ(s->diff({0, 220, 320, 20}, rects, 1), 60u * 10u);
+  ASSERT_EQ(rects.size(), 1u);
+  EXPECT_EQ(rects[0].x, 4);
+  EXPECT_EQ(rects[0].w, 60);
+  EXPECT_GE(rects[0].y, 216);
+
+  rects.clear();
+  EXPECT_EQ(s->diff({0, 100, 320, 40}, rects, 1), 0u);
+  EXPECT_TRUE(rects.empty());
+  delete s;
+}
+
+TEST(shadow_frame, PartialWindowMatchesFullFrame) {
+  // what frames.cpp does: draw into a partial window and push it page by page
+  Shadow* s = blankPanel();
+  s->setPartialWindow(30, 37, 100, 20);
+  s->fill(false);
+  fillRect(*s, 0, 0, 320, 240);  // clipped to the window
+  s->pushWindow();
+
+  // the same pixels drawn into the full buffer: nothing left to send
+  s->setFullWindow();
+  s->fill(false);
+  fillRect(*s, 30, 32, 100, 32);
+  std::vector<DirtyRect> rects;
+  EXPECT_EQ(s->diff(rects, 2), 0u);
+  delete s;
+}
+
+TEST(shadow_frame, NativeRectIsWhatPushRegionCopies) {
+  // the refresh task sends nativeRect() straight from shownBytes()
+  Shadow* s = blankPanel();
+  fillRect(*s, 30, 41, 50, 7);
+  const DirtyRect n = s->nativeRect({30, 41, 50, 7});
+  EXPECT_EQ(n.x % 8, 0);
+  EXPECT_EQ(n.w % 8, 0);
+  EXPECT_EQ(n.h, 50);
+  EXPECT_EQ(n.y, 320 - 30 - 50);
+  s->pushRegion(30, 41, 50, 7);
+  uint32_t ink = 0;
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 240; x++) {
+      if (!(s->shownBytes()[y * 30 + x / 8] & (0x80 >> (x & 7)))) continue;
+      EXPECT_TRUE(x >= n.x && x < n.right() && y >= n.y && y < n.bottom()) << x << "," << y;
+      ink++;
+    }
+  }
+  EXPECT_EQ(ink, 50u * 7u);
+  delete s;
+}
+
+TEST(shadow_frame, EveryRotationFindsThePixel) {
+  for (uint8_t rot = 0; rot < 4; rot++) {
+    Shadow* s = new Shadow;
+    s->setRotation(rot);
+    s->setFullWindow();
+    s->fill(false);
+    s->pushAll();
+    const int x = s->width() - 7, y = 13;
+    s->drawPixel(x, y, true);
+    std::vector<DirtyRect> rects;
+    EXPECT_EQ(s->diff(rects, 1), 1u) << (int)rot;
+    EXPECT_TRUE(covers(rects, x, y)) << (int)rot;
+    EXPECT_LE(dirtyArea(rects), 8L * 8L) << (int)rot;
+    delete s;
+  }
+}
+
+TEST(shadow_frame, BenchmarkDiff) {
+  using clock = std::chrono::steady_clock;
+  Shadow* s = blankPanel();
+  for (int row = 0; row < 10; row++) fillRect(*s, 0, row * 20, 250, 12);
+  s->pushAll();
+  fillRect(*s, 0, 200, 180, 12);
+  std::vector<DirtyRect> rects;
+  const int runs = 2000;
+  uint32_t changed = 0;
+  auto t0 = clock::now();
+  for (int i = 0; i < runs; i++) {
+    rects.clear();
+    changed += s->diff(rects, 2);
+  }
+  auto t1 = clock::now();
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  printf("[ BENCH    ] frame diff: %lld ns per frame\n", (long long)(ns / runs));
+  EXPECT_EQ(changed, runs * 180u * 12u);
+  delete s;
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#include <textMetrics.h>
+#include <Fonts/FreeSerif9pt8b.h>
+#include <Fonts/FreeSansBoldOblique24pt8b.h>
+#include <Fonts/FreeMono9pt8b.h>
+
+// Reference: Adafruit_GFX::getTextBounds() for GFX fonts (textsize 1, wrap on, 320px wide)
+static void gfxTextBounds(const GFXfont* f, const char* str, int16_t x, int16_t y, int16_t* x1,
+                          int16_t* y1, uint16_t* w, uint16_t* h) {
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  *x1 = x; *y1 = y; *w = *h = 0;
+  uint8_t c;
+  while ((c = *str++)) {
+    if (c == '\n') { x = 0; y += f->yAdvance; continue; }
+    if (c == '\r' || c < f->first || c > f->last) continue;
+    const GFXglyph* g = &f->glyph[c - f->first];
+    if ((x + (g->xOffset + g->width)) > 320) { x = 0; y += f->yAdvance; }
+    int16_t gx1 = x + g->xOffset, gy1 = y + g->yOffset;
+    int16_t gx2 = gx1 + g->width - 1, gy2 = gy1 + g->height - 1;
+    if (gx1 < minx) minx = gx1;
+    if (gy1 < miny) miny = gy1;
+    if (gx2 > maxx) maxx = gx2;
+    if (gy2 > maxy) maxy = gy2;
+    x += g->xAdvance;
+  }
+  if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+  if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
+
+static std::vector<std::string> makeNote(size_t words) {
+  static const char* dict[] = {"PocketMage", "the", "quick", "brown", "fox", "jumps", "over",
+                               "lazy", "dog,", "journal", "entry", "(draft)", "e-ink", "42",
+                               "\xe9t\xe9", "stra\xdf" "e", "markdown", "wrap", "width", "!"};
+  std::vector<std::string> out;
+  out.reserve(words);
+  for (size_t i = 0; i < words; i++) out.push_back(dict[(i * 7 + i / 3) % 20]);
+  return out;
+}
+
+// Old DocLine::splitToLines(): two getTextBounds() calls per word
+static int layoutWithGetTextBounds(const GFXfont* f, const std::vector<std::string>& words) {
+  int lines = 1, lineWidth = 0;
+  for (auto& w : words) {
+    int16_t x1, y1;
+    uint16_t wpx, hpx, spx;
+    gfxTextBounds(f, w.c_str(), 0, 0, &x1, &y1, &wpx, &hpx);
+    gfxTextBounds(f, "n", 0, 0, &x1, &y1, &spx, &hpx);
+    int add = wpx + spx;
+    if (lineWidth > 0 && lineWidth + add > 320) { lines++; lineWidth = 0; }
+    lineWidth += add;
+  }
+  return lines;
+}
+
+// New path: glyph table sum, space width cached once
+static int layoutWithMetrics(const GFXfont* f, const std::vector<std::string>& words) {
+  const FontMetrics& fm = fontMetrics(f);
+  const int spx = fm.width("n");
+  int lines = 1, lineWidth = 0;
+  for (auto& w : words) {
+    int add = fm.width(w.data(), w.size()) + spx;
+    if (lineWidth > 0 && lineWidth + add > 320) { lines++; lineWidth = 0; }
+    lineWidth += add;
+  }
+  return lines;
+}
+
+TEST(text_metrics, MatchesGetTextBoundsForEveryGlyph) {
+  const GFXfont* fonts[] = {&FreeSerif9pt8b, &FreeSansBoldOblique24pt8b, &FreeMono9pt8b};
+  for (const GFXfont* f : fonts) {
+    const FontMetrics& fm = fontMetrics(f);
+    for (int c = f->first; c <= f->last; c++) {
+      char s[2] = {(char)c, 0};
+      int16_t x1, y1;
+      uint16_t w, h;
+      gfxTextBounds(f, s, 0, 0, &x1, &y1, &w, &h);
+      TextBounds b = fm.bounds(s, 1);
+      EXPECT_EQ(b.w, w) << "char " << c;
+      EXPECT_EQ(b.h, h) << "char " << c;
+      EXPECT_EQ(b.x1, x1) << "char " << c;
+      EXPECT_EQ(b.y1, y1) << "char " << c;
+    }
+  }
+}
+
+TEST(text_metrics, MatchesGetTextBoundsForWords) {
+  for (auto& w : makeNote(200)) {
+    int16_t x1, y1;
+    uint16_t pw, ph;
+    gfxTextBounds(&FreeSerif9pt8b, w.c_str(), 0, 0, &x1, &y1, &pw, &ph);
+    TextBounds b = fontMetrics(&FreeSerif9pt8b).bounds(w.data(), w.size());
+    EXPECT_EQ(b.w, pw) << w;
+    EXPECT_EQ(b.h, ph) << w;
+  }
+}
+
+TEST(text_metrics, TwoPartBoundsMatchJoinedText) {
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  for (auto& w : makeNote(200)) {
+    const std::string joined = w + "<";
+    TextBounds a = fm.bounds(joined.data(), joined.size());
+    TextBounds b = fm.bounds(w.data(), w.size(), "<", 1);
+    EXPECT_EQ(a.x1, b.x1) << w;
+    EXPECT_EQ(a.y1, b.y1) << w;
+    EXPECT_EQ(a.w, b.w) << w;
+    EXPECT_EQ(a.h, b.h) << w;
+  }
+  TextBounds only = fm.bounds("", 0, "<", 1);
+  EXPECT_EQ(only.w, fm.width("<"));
+}
+TEST(text_metrics, CachesOneTablePerFont) {
+  EXPECT_EQ(&fontMetrics(&FreeMono9pt8b), &fontMetrics(&FreeMono9pt8b));
+  EXPECT_NE(&fontMetrics(&FreeMono9pt8b), &fontMetrics(&FreeSerif9pt8b));
+  EXPECT_EQ(fontMetrics(nullptr).width("abc"), 0);
+}
+TEST(text_metrics, FullTableLogsOnce) {
+  // every font a pack and its fallback can be, plus the UI fonts
+  EXPECT_GE(MAX_FONT_METRICS, MAX_FONT_PACKS * 2 + MAX_UI_FONTS);
+
+  FontMetricsTable<2> table;
+  GFXfont copies[4] = {FreeMono9pt8b, FreeMono9pt8b, FreeMono9pt8b, FreeMono9pt8b};
+  testing::internal::CaptureStderr();
+  EXPECT_GT(table.get(&copies[0]).width("abc"), 0);
+  EXPECT_GT(table.get(&copies[1]).width("abc"), 0);
+  EXPECT_FALSE(table.overflowed());
+  EXPECT_EQ(table.get(&copies[2]).width("abc"), 0);
+  EXPECT_EQ(table.get(&copies[3]).width("abc"), 0);
+  EXPECT_GT(table.get(&copies[1]).width("abc"), 0);
+  const std::string log = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(table.overflowed());
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_NE(log.find("MAX_FONT_METRICS"), std::string::npos) << log;
+  EXPECT_EQ(log.find("MAX_FONT_METRICS"), log.rfind("MAX_FONT_METRICS")) << log;
+}
+
+TEST(text_metrics, BenchmarkReflowLongNote) {
+  auto words = makeNote(50000);  // ~300 KB note
+  using clock = std::chrono::steady_clock;
+
+  auto t0 = clock::now();
+  int before = layoutWithGetTextBounds(&FreeSerif9pt8b, words);
+  auto t1 = clock::now();
+  int after = layoutWithMetrics(&FreeSerif9pt8b, words);
+  auto t2 = clock::now();
+
+  EXPECT_EQ(before, after);
+  auto usBefore = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  auto usAfter = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+  printf("[ BENCH    ] reflow %zu words: getTextBounds %lld us, glyph tables %lld us\n",
+         words.size(), (long long)usBefore, (long long)usAfter);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
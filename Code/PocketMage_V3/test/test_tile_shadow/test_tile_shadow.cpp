@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <tileShadow.h>
+
+// The 256x32 OLED: 32x4 tiles of 8 bytes, one byte per column
+using Shadow = TileShadow<32, 4>;
+
+struct Area {
+  uint8_t tx, ty, tw, th;
+};
+
+static void setPixel(std::vector<uint8_t>& buf, int x, int y) {
+  buf[(y / 8) * 256 + x] |= 1 << (y % 8);
+}
+
+static std::vector<Area> commit(Shadow& s, const std::vector<uint8_t>& buf) {
+  std::vector<Area> areas;
+  s.commit(buf.data(), [&](uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    areas.push_back({tx, ty, tw, th});
+  });
+  return areas;
+}
+
+TEST(tile_shadow, FirstCommitSendsEverything) {
+  Shadow s;
+  std::vector<uint8_t> buf(Shadow::BYTES, 0);
+  std::vector<Area> areas = commit(s, buf);
+  ASSERT_EQ(areas.size(), 1u);
+  EXPECT_EQ(areas[0].tw, 32);
+  EXPECT_EQ(areas[0].th, 4);
+  EXPECT_TRUE(commit(s, buf).empty());
+  EXPECT_EQ(s.skipped(), 1u);
+
+  s.forget();
+  EXPECT_EQ(commit(s, buf).size(), 1u);
+  EXPECT_EQ(s.tilesSent(), 2u * 128u);
+}
+
+TEST(tile_shadow, SendsOnlyTheChangedTile) {
+  Shadow s;
+  std::vector<uint8_t> buf(Shadow::BYTES, 0);
+  commit(s, buf);
+  setPixel(buf, 100, 13);
+  std::vector<Area> areas = commit(s, buf);
+  ASSERT_EQ(areas.size(), 1u);
+  EXPECT_EQ(areas[0].tx, 12);
+  EXPECT_EQ(areas[0].ty, 1);
+  EXPECT_EQ(areas[0].tw, 1);
+  EXPECT_EQ(areas[0].th, 1);
+  EXPECT_TRUE(commit(s, buf).empty());
+}
+
+TEST(tile_shadow, NearbyTilesShareOneArea) {
+  Shadow s;
+  std::vector<uint8_t> buf(Shadow::BYTES, 0);
+  commit(s, buf);
+  setPixel(buf, 8, 0);    // tile 1
+  setPixel(buf, 30, 0);   // tile 3, two apart
+  setPixel(buf, 200, 0);  // tile 25, far away
+  std::vector<Area> areas = commit(s, buf);
+  ASSERT_EQ(areas.size(), 2u);
+  EXPECT_EQ(areas[0].tx, 1);
+  EXPECT_EQ(areas[0].tw, 3);
+  EXPECT_EQ(areas[1].tx, 25);
+  EXPECT_EQ(areas[1].tw, 1);
+}
+
+TEST(tile_shadow, TypingSendsAFractionOfTheBuffer) {
+  // oledLine(): text grows by a char, the cursor and the progress bar move along
+  Shadow s;
+  std::vector<uint8_t> buf(Shadow::BYTES, 0);
+  commit(s, buf);
+  for (int c = 0; c < 30; c++) {
+    std::fill(buf.begin(), buf.end(), 0);
+    const int textEnd = c * 8;
+    for (int x = 0; x < textEnd; x++)
+      for (int y = 4; y < 20; y += 3) setPixel(buf, x, y);     // the line so far
+    for (int y = 1; y < 23; y++) setPixel(buf, textEnd + 2, y);  // cursor
+    for (int x = 0; x < c * 8; x++) setPixel(buf, x, 0);         // progress bar
+    for (int x = 0; x < 60; x++) setPixel(buf, x, 30);           // info bar, unchanged
+    commit(s, buf);
+  }
+  // every commit after the first sends a handful of the 128 tiles
+  EXPECT_LT(s.tilesSent() - 128, 30u * 12u);
+  EXPECT_LT(s.sentPercent(), 15u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
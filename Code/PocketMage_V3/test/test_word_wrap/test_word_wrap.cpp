@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#include <wordWrap.h>
+#include <Fonts/FreeSerif9pt8b.h>
+
+#define WRAP_LIMIT (320 - 5)
+
+struct Line {
+  std::string text;
+  uint8_t brk;
+  bool operator==(const Line& o) const { return text == o.text && brk == o.brk; }
+};
+
+// Old stringToVector(): measures the whole line before every character and splits the
+// line with substrings. Newlines left out, it mangled lines that ended in one
+static std::vector<std::string> legacyWrap(const std::string& in, const FontMetrics& fm) {
+  std::vector<std::string> lines;
+  std::string cur;
+  for (char c : in) {
+    uint16_t w = fm.bounds(cur.data(), cur.size()).w;
+    if (w >= WRAP_LIMIT && !cur.empty()) {
+      if (cur.back() == ' ') {
+        lines.push_back(cur);
+        cur = "";
+      } else {
+        size_t lastSpace = cur.rfind(' ');
+        if (lastSpace != std::string::npos) {
+          std::string partial = cur.substr(lastSpace + 1);
+          lines.push_back(cur.substr(0, lastSpace));
+          cur = partial;
+        } else {
+          lines.push_back(cur);
+          cur = "";
+        }
+      }
+    }
+    cur += c;
+  }
+  if (!cur.empty()) lines.push_back(cur);
+  return lines;
+}
+
+static std::vector<Line> wrap(const std::string& in) {
+  std::vector<Line> lines;
+  wrapText(in.data(), in.size(), fontMetrics(&FreeSerif9pt8b), WRAP_LIMIT,
+           [&](const char* s, size_t n, uint8_t brk) { lines.push_back({std::string(s, n), brk}); });
+  return lines;
+}
+
+static std::string join(const std::vector<Line>& lines) {
+  std::string out;
+  for (size_t i = 0; i < lines.size(); i++) {
+    out += lines[i].text;
+    if (i + 1 < lines.size()) out += wrapJoin(lines[i].brk);
+  }
+  return out;
+}
+
+static std::string makeText(size_t bytes, unsigned seed, bool newlines) {
+  static const char* dict[] = {"PocketMage", "the", "quick", "brown", "fox", "jumps", "over",
+                               "lazy", "dog,", "journal", "entry", "(draft)", "e-ink", "42",
+                               "markdown", "wrap", "width", "!", "a", "supercalifragilistic"};
+  std::mt19937 rng(seed);
+  std::string out;
+  while (out.size() < bytes) {
+    const unsigned r = rng() % 100;
+    if (r == 0) {
+      out += std::string(60 + rng() % 40, 'W');  // longer than a line
+    } else {
+      out += dict[rng() % 20];
+    }
+    out += (newlines && rng() % 12 == 0) ? (rng() % 3 ? "\n" : "\n\n") : " ";
+  }
+  return out;
+}
+
+TEST(word_wrap, MatchesLegacyWrapping) {
+  const std::string text = makeText(20000, 1, false);
+  std::vector<std::string> legacy = legacyWrap(text, fontMetrics(&FreeSerif9pt8b));
+  std::vector<Line> lines = wrap(text);
+  ASSERT_EQ(lines.size(), legacy.size());
+  for (size_t i = 0; i < lines.size(); i++) EXPECT_EQ(lines[i].text, legacy[i]) << "line " << i;
+}
+
+TEST(word_wrap, LinesFitAndBreakAtSpaces) {
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  for (const Line& l : wrap(makeText(20000, 2, true))) {
+    // A line only passes the limit by the glyph that crossed it
+    if (l.text.find(' ') != std::string::npos && l.brk != WRAP_HARD) {
+      EXPECT_LT(fm.width(l.text.data(), l.text.size() - 1), WRAP_LIMIT) << l.text;
+    }
+    EXPECT_EQ(l.text.find('\n'), std::string::npos);
+  }
+}
+
+TEST(word_wrap, NewlinesAreHardBreaks) {
+  std::vector<Line> lines = wrap("hello world\nfoo\n\nbar\n");
+  std::vector<Line> want = {{"hello world", WRAP_HARD}, {"foo", WRAP_HARD}, {"", WRAP_HARD},
+                            {"bar", WRAP_HARD}, {"", WRAP_HARD}};
+  EXPECT_EQ(lines, want);
+  EXPECT_TRUE(wrap("").empty());
+}
+
+TEST(word_wrap, BreakKinds) {
+  std::string longWord(200, 'm');
+  std::vector<Line> lines = wrap(longWord);
+  ASSERT_GT(lines.size(), 1u);
+  EXPECT_EQ(lines[0].brk, WRAP_SOFT);
+  EXPECT_EQ(lines.back().brk, WRAP_HARD);
+
+  bool sawSpace = false;
+  for (const Line& l : wrap(makeText(4000, 3, false))) sawSpace |= l.brk == WRAP_SPACE;
+  EXPECT_TRUE(sawSpace);
+}
+
+TEST(word_wrap, JoinGivesBackTheText) {
+  for (unsigned seed = 10; seed < 20; seed++) {
+    const std::string text = makeText(5000, seed, seed % 2);
+    EXPECT_EQ(join(wrap(text)), text) << "seed " << seed;
+  }
+  EXPECT_EQ(join(wrap("trailing\n")), "trailing\n");
+  EXPECT_EQ(join(wrap("\n\n")), "\n\n");
+}
+
+TEST(word_wrap, Benchmark100KB) {
+  const std::string text = makeText(100 * 1024, 4, false);
+  const FontMetrics& fm = fontMetrics(&FreeSerif9pt8b);
+  using clock = std::chrono::steady_clock;
+
+  auto t0 = clock::now();
+  std::vector<std::string> legacy = legacyWrap(text, fm);
+  auto t1 = clock::now();
+  std::vector<Line> lines = wrap(text);
+  auto t2 = clock::now();
+
+  EXPECT_EQ(lines.size(), legacy.size());
+  auto usBefore = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  auto usAfter = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+  printf("[ BENCH    ] wrap %zu B into %zu lines: remeasure %lld us, streaming %lld us\n",
+         text.size(), lines.size(), (long long)usBefore, (long long)usAfter);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  if (RUN_ALL_TESTS());
+  // Always return zero-code and allow PlatformIO to parse results
+  return 0;
+}
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Converts a PocketMage background to the compressed .rle format read at deep sleep.
+Takes the .bin image2cpp exports (320x240, Invert Image Colors, no bit swap) or,
+with Pillow installed, any image file, which is thresholded to 1 bit.
+"""
+
+import argparse
+import sys
+from pathlib import Path
+
+WIDTH, HEIGHT = 320, 240
+ROW_BYTES = (WIDTH + 7) // 8
+
+
+def load_bits(path: Path, threshold: int) -> bytes:
+    """Raw rows, MSB first, 1 = black."""
+    if path.suffix.lower() == ".bin":
+        data = path.read_bytes()
+        if len(data) < ROW_BYTES * HEIGHT:
+            raise ValueError(f"{path} is {len(data)} bytes, expected {ROW_BYTES * HEIGHT}")
+        return data[:ROW_BYTES * HEIGHT]
+
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError("converting images needs Pillow (pip install pillow), or pass a .bin")
+    img = Image.open(path).convert("L")
+    if img.size != (WIDTH, HEIGHT):
+        raise ValueError(f"{path} is {img.size[0]}x{img.size[1]}, expected {WIDTH}x{HEIGHT}")
+    px = img.load()
+    out = bytearray(ROW_BYTES * HEIGHT)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if px[x, y] < threshold:
+                out[y * ROW_BYTES + x // 8] |= 0x80 >> (x % 8)
+    return bytes(out)
+
+
+def encode(bits: bytes) -> bytes:
+    """PackBits, the same as encodeBitmapRle() in bitmapStream.h."""
+    out = bytearray(b"PMR1")
+    out += WIDTH.to_bytes(2, "little") + HEIGHT.to_bytes(2, "little")
+    n, i = len(bits), 0
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and bits[i + run] == bits[i]:
+            run += 1
+        if run >= 2:
+            out += bytes((257 - run, bits[i]))
+            i += run
+            continue
+        lit = 1
+        # literals until the next run of two or more
+        while i + lit < n and lit < 128 and not (
+                i + lit + 1 < n and bits[i + lit] == bits[i + lit + 1]):
+            lit += 1
+        out.append(lit - 1)
+        out += bits[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def decode(data: bytes) -> bytes:
+    """Inverse of encode(), used to check the output."""
+    if data[:4] != b"PMR1":
+        raise ValueError("not a PocketMage .rle file")
+    w = int.from_bytes(data[4:6], "little")
+    h = int.from_bytes(data[6:8], "little")
+    size = (w + 7) // 8 * h
+    out, i = bytearray(), 8
+    while len(out) < size and i < len(data):
+        c = data[i]
+        i += 1
+        if c < 128:
+            out += data[i:i + c + 1]
+            i += c + 1
+        elif c > 128:
+            out += bytes([data[i]]) * (257 - c)
+            i += 1
+    return bytes(out[:size])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert PocketMage backgrounds to .rle")
+    parser.add_argument("inputs", nargs="+", type=Path, help=".bin from image2cpp, or an image")
+    parser.add_argument("-o", "--output", type=Path, help="Output file (one input only)")
+    parser.add_argument("--threshold", type=int, default=128,
+                        help="Gray level below which image pixels are black (default 128)")
+    args = parser.parse_args()
+
+    if args.output and len(args.inputs) > 1:
+        parser.error("--output takes a single input")
+
+    failed = False
+    for src in args.inputs:
+        dst = args.output or src.with_suffix(".rle")
+        try:
+            bits = load_bits(src, args.threshold)
+        except (OSError, ValueError) as e:
+            print(f"Error: {e}", file=sys.stderr)
+            failed = True
+            continue
+        rle = encode(bits)
+        assert decode(rle) == bits
+        dst.write_bytes(rle)
+        print(f"{src.name} -> {dst.name}: {len(bits)} -> {len(rle)} bytes")
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Converts Adafruit GFXfont headers (Fonts/*.h, fontconvert output) to PocketMage .pmf
+font packs. Copy the packs to /assets/fonts on the SD card; TXT loads them from there.
+The packs for the fonts in lib/PocketMage/include/Fonts are kept in Docs/Fonts (PMF),
+regenerate them there when those headers change.
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+BITMAPS = re.compile(r"uint8_t\s+(\w+)Bitmaps\[\]\s*(?:PROGMEM)?\s*=\s*\{(.*?)\};", re.S)
+GLYPHS = re.compile(r"GFXglyph\s+\w+Glyphs\[\]\s*(?:PROGMEM)?\s*=\s*\{(.*)\}\s*;", re.S)
+GLYPH = re.compile(r"\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,"
+                   r"\s*(-?\d+)\s*,\s*(-?\d+)\s*\}")
+FONT = re.compile(r"GFXfont\s+(\w+)\s*(?:PROGMEM)?\s*=\s*\{[^}]*?Glyphs\s*,"
+                  r"\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\}", re.S)
+
+
+def parse_header(text: str):
+    """Returns (name, first, last, yAdvance, glyphs, bitmap) of the GFXfont in text."""
+    text = re.sub(r"//[^\n]*", "", text)
+    bitmaps = BITMAPS.search(text)
+    font = FONT.search(text)
+    if not bitmaps or not font:
+        raise ValueError("no GFXfont found")
+    glyph_block = GLYPHS.search(text[:font.start()])
+    if not glyph_block:
+        raise ValueError("no glyph table found")
+
+    bitmap = bytes(int(v, 0) for v in bitmaps.group(2).replace("\n", " ").split(",")
+                   if v.strip())
+    glyphs = [tuple(int(v) for v in g) for g in GLYPH.findall(glyph_block.group(1))]
+    name, first, last, y_advance = font.group(1), *(int(v, 0) for v in font.groups()[1:])
+    if len(glyphs) != last - first + 1:
+        raise ValueError(f"{len(glyphs)} glyphs for chars {first:#x}-{last:#x}")
+    return name, first, last, y_advance, glyphs, bitmap
+
+
+def encode(first: int, last: int, y_advance: int, glyphs, bitmap: bytes) -> bytes:
+    """Pack bytes, the same as encodeFontPack() in fontPack.h."""
+    size = max(off + (w * h + 7) // 8 for off, w, h, *_ in glyphs)
+    if size > len(bitmap):
+        raise ValueError("glyphs point past the bitmap")
+    out = bytearray(b"PMF1")
+    out += first.to_bytes(2, "little") + last.to_bytes(2, "little")
+    out += bytes((y_advance, 0)) + size.to_bytes(4, "little")
+    for off, w, h, x_advance, x_offset, y_offset in glyphs:
+        out += off.to_bytes(2, "little")
+        out += bytes((w, h, x_advance, x_offset & 0xFF, y_offset & 0xFF))
+    out += bitmap[:size]
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert GFXfont headers to .pmf font packs")
+    parser.add_argument("headers", nargs="+", type=Path, help="GFXfont .h files")
+    parser.add_argument("-o", "--out-dir", type=Path, default=Path("."),
+                        help="Directory for the packs (default: current directory)")
+    parser.add_argument("--name", help="Pack name instead of the GFXfont's, to replace a font "
+                        "TXT uses (one header only)")
+    args = parser.parse_args()
+
+    if args.name and len(args.headers) > 1:
+        parser.error("--name takes a single header")
+
+    args.out_dir.mkdir(parents=True, exist_ok=True)
+    failed = False
+    for src in args.headers:
+        try:
+            name, first, last, y_advance, glyphs, bitmap = parse_header(src.read_text())
+            pack = encode(first, last, y_advance, glyphs, bitmap)
+        except (OSError, ValueError) as e:
+            print(f"Error: {src.name}: {e}", file=sys.stderr)
+            failed = True
+            continue
+        dst = args.out_dir / f"{args.name or name}.pmf"
+        dst.write_bytes(pack)
+        print(f"{src.name} -> {dst.name}: {len(pack)} bytes")
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()